@@ -0,0 +1,97 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_HASH_GUARD
+#define SAPPHIRE_CORE_HASH_GUARD
+
+#include <string>
+#include <type_traits>
+
+#include <Core/Types/Int.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Core/Algorithms/Hash.hpp
+	*
+	*	\brief \b Definition of Sapphire's \b Hash algorithms.
+	*
+	*	\ingroup Algorithms
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Fast 64-bit hash of a <b>block of memory</b> (wyhash).
+	*
+	*	Non-cryptographic, good avalanche: suitable for open-addressing tables.
+	*	Keys up to 16 bytes are hashed with 2 multiplications.
+	*
+	*	\param[in] _data	Memory to hash.
+	*	\param[in] _size	Size of memory in bytes.
+	*	\param[in] _seed	Hash seed.
+	*
+	*	\return 64-bit hash.
+	*/
+	uint64 Hash64(const void* _data, uint64 _size, uint64 _seed = 0u) noexcept;
+
+	/**
+	*	\brief 64-bit hash of an integer value (bijective mix).
+	*
+	*	\param[in] _value	Value to hash.
+	*
+	*	\return 64-bit hash.
+	*/
+	constexpr uint64 HashMix(uint64 _value) noexcept;
+
+	/**
+	*	\brief Combine a hash into a seed (ex: hash of structure members).
+	*
+	*	\param[in] _seed	Current hash.
+	*	\param[in] _hash	Hash to combine.
+	*
+	*	\return combined hash.
+	*/
+	constexpr uint64 HashCombine(uint64 _seed, uint64 _hash) noexcept;
+
+
+	/**
+	*	\brief Default 64-bit hash functor.
+	*
+	*	Integers, enums and pointers are mixed. Floating points are mixed by value:
+	*	-0.0 and 0.0 hash the same (equal values).
+	*	Other types are hashed by value bytes with Hash64 only if their bytes uniquely represent
+	*	their value (no padding, no floating point member).
+	*	Specialize for other types (ex: combine the member hashes).
+	*
+	*	\tparam T	Type to hash.
+	*/
+	template <typename T>
+	struct Hash
+	{
+		static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value ||
+			std::has_unique_object_representations<T>::value,
+			"Hash<T> must be specialized for types with padding or floating point members!");
+
+		uint64 operator()(const T& _value) const noexcept;
+	};
+
+	/**
+	*	\brief Hash functor specialization for strings (hash of characters).
+	*
+	*	\tparam CharT	Character type.
+	*/
+	template <typename CharT>
+	struct Hash<std::basic_string<CharT>>
+	{
+		uint64 operator()(const std::basic_string<CharT>& _str) const noexcept;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Algorithms/Hash.inl>
+
+#endif // GUARD
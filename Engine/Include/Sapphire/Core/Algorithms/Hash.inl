@@ -0,0 +1,175 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <cstring> // std::memcpy
+
+#include <Core/Support/Compilers.hpp>
+
+#if SA_MSVC
+	#include <intrin.h>
+#endif
+
+namespace Sa
+{
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// wyhash secret constants.
+		static constexpr uint64 sHashSecret[4]{ 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+		/// 64x64 -> 128 multiplication, folded in _lhs (low) and _rhs (high).
+		inline void HashMum(uint64& _lhs, uint64& _rhs) noexcept
+		{
+#if SA_MSVC && SA_x64
+			_lhs = _umul128(_lhs, _rhs, &_rhs);
+#elif SA_GNU || SA_CLANG
+			const unsigned __int128 res = static_cast<unsigned __int128>(_lhs) * _rhs;
+
+			_lhs = static_cast<uint64>(res);
+			_rhs = static_cast<uint64>(res >> 64u);
+#else
+			// Portable 32-bit halves multiplication.
+			const uint64 lhsHi = _lhs >> 32u, lhsLo = static_cast<uint32>(_lhs);
+			const uint64 rhsHi = _rhs >> 32u, rhsLo = static_cast<uint32>(_rhs);
+
+			const uint64 hh = lhsHi * rhsHi, hl = lhsHi * rhsLo, lh = lhsLo * rhsHi, ll = lhsLo * rhsLo;
+			const uint64 mid = hl + (ll >> 32u) + static_cast<uint32>(lh);
+
+			_lhs = (mid << 32u) | static_cast<uint32>(ll);
+			_rhs = hh + (mid >> 32u) + (lh >> 32u);
+#endif
+		}
+
+		inline uint64 HashMumMix(uint64 _lhs, uint64 _rhs) noexcept
+		{
+			HashMum(_lhs, _rhs);
+
+			return _lhs ^ _rhs;
+		}
+
+		inline uint64 HashRead8(const uint8* _data) noexcept
+		{
+			uint64 res;
+			std::memcpy(&res, _data, sizeof(uint64));
+			return res;
+		}
+
+		inline uint64 HashRead4(const uint8* _data) noexcept
+		{
+			uint32 res;
+			std::memcpy(&res, _data, sizeof(uint32));
+			return res;
+		}
+	}
+
+	/// \endcond Internal
+
+
+	inline uint64 Hash64(const void* _data, uint64 _size, uint64 _seed) noexcept
+	{
+		using namespace Internal;
+
+		const uint8* data = static_cast<const uint8*>(_data);
+
+		_seed ^= HashMumMix(_seed ^ sHashSecret[0], sHashSecret[1]);
+
+		uint64 a = 0u;
+		uint64 b = 0u;
+
+		if (_size <= 16u)
+		{
+			if (_size >= 4u)
+			{
+				// 2 overlapping reads of 4 bytes at both ends.
+				const uint64 offset = (_size >> 3u) << 2u;
+
+				a = (HashRead4(data) << 32u) | HashRead4(data + offset);
+				b = (HashRead4(data + _size - 4u) << 32u) | HashRead4(data + _size - 4u - offset);
+			}
+			else if (_size > 0u)
+				a = (uint64(data[0]) << 16u) | (uint64(data[_size >> 1u]) << 8u) | data[_size - 1u];
+		}
+		else
+		{
+			uint64 size = _size;
+
+			if (size > 48u)
+			{
+				uint64 seed1 = _seed;
+				uint64 seed2 = _seed;
+
+				do
+				{
+					_seed = HashMumMix(HashRead8(data) ^ sHashSecret[1], HashRead8(data + 8u) ^ _seed);
+					seed1 = HashMumMix(HashRead8(data + 16u) ^ sHashSecret[2], HashRead8(data + 24u) ^ seed1);
+					seed2 = HashMumMix(HashRead8(data + 32u) ^ sHashSecret[3], HashRead8(data + 40u) ^ seed2);
+
+					data += 48u;
+					size -= 48u;
+				} while (size > 48u);
+
+				_seed ^= seed1 ^ seed2;
+			}
+
+			while (size > 16u)
+			{
+				_seed = HashMumMix(HashRead8(data) ^ sHashSecret[1], HashRead8(data + 8u) ^ _seed);
+
+				data += 16u;
+				size -= 16u;
+			}
+
+			a = HashRead8(data + size - 16u);
+			b = HashRead8(data + size - 8u);
+		}
+
+		a ^= sHashSecret[1];
+		b ^= _seed;
+
+		HashMum(a, b);
+
+		return HashMumMix(a ^ sHashSecret[0] ^ _size, b ^ sHashSecret[1]);
+	}
+
+	constexpr uint64 HashMix(uint64 _value) noexcept
+	{
+		// splitmix64 finalizer.
+		_value = (_value ^ (_value >> 30u)) * 0xbf58476d1ce4e5b9ull;
+		_value = (_value ^ (_value >> 27u)) * 0x94d049bb133111ebull;
+
+		return _value ^ (_value >> 31u);
+	}
+
+	constexpr uint64 HashCombine(uint64 _seed, uint64 _hash) noexcept
+	{
+		return HashMix(_seed ^ (_hash + 0x9e3779b97f4a7c15ull + (_seed << 6u) + (_seed >> 2u)));
+	}
+
+
+	template <typename T>
+	uint64 Hash<T>::operator()(const T& _value) const noexcept
+	{
+		if constexpr (std::is_integral<T>::value || std::is_enum<T>::value)
+			return HashMix(static_cast<uint64>(_value));
+		else if constexpr (std::is_pointer<T>::value)
+			return HashMix(reinterpret_cast<uint64>(_value));
+		else if constexpr (std::is_floating_point<T>::value)
+		{
+			// Normalize -0.0 to 0.0 (equal values). Exact for float and double.
+			const double value = _value == T(0) ? 0.0 : static_cast<double>(_value);
+
+			uint64 bits = 0u;
+			std::memcpy(&bits, &value, sizeof(double));
+
+			return HashMix(bits);
+		}
+		else
+			return Hash64(&_value, sizeof(T));
+	}
+
+	template <typename CharT>
+	uint64 Hash<std::basic_string<CharT>>::operator()(const std::basic_string<CharT>& _str) const noexcept
+	{
+		return Hash64(_str.data(), _str.size() * sizeof(CharT));
+	}
+}
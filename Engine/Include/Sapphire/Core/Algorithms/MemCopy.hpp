@@ -11,6 +11,8 @@
 
 #include <Core/Debug/Debug.hpp>
 
+#include <Core/Algorithms/MemStream.hpp>
+
 namespace Sa
 {
 	/**
@@ -44,6 +46,43 @@ namespace Sa
 		std::memcpy(_dest, _src, _num * sizeof(T));
 	}
 
+	/**
+	*	\brief Copy a <b>block of memory</b> from src to dest of num object, without parameter checks.
+	*
+	*	Use in hot loops where pointers are already known valid.
+	*
+	*	\tparam T			Type of memory.
+	*
+	*	\param[in] _src		Source to copy from.
+	*	\param[out] _dest	Destination to copy to.
+	*	\param[in] _num		Number of T to copy.
+	*/
+	template <typename T>
+	void MemCopyUnchecked(const T* _src, T* _dest, uint64 _num) noexcept
+	{
+		std::memcpy(_dest, _src, _num * sizeof(T));
+	}
+
+	/**
+	*	\brief Copy a <b>block of memory</b> from src to dest of num object with non-temporal stores.
+	*
+	*	Bypass caches: use for large copies and uploads into mapped GPU memory (see MemStreamCopy).
+	*
+	*	\tparam T			Type of memory.
+	*
+	*	\param[in] _src		Source to copy from.
+	*	\param[out] _dest	Destination to copy to.
+	*	\param[in] _num		Number of T to copy.
+	*/
+	template <typename T>
+	void MemCopyStream(const T* _src, T* _dest, uint64 _num)
+	{
+		SA_ASSERT(_src, Nullptr, Tools, L"_src nullptr!");
+		SA_ASSERT(_dest, Nullptr, Tools, L"_dest nullptr!");
+
+		MemStreamCopy(_src, _dest, _num * sizeof(T));
+	}
+
 
 	/** \} */
 }
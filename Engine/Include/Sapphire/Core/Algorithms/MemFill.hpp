@@ -6,11 +6,14 @@
 #define SAPPHIRE_CORE_MEM_FILL_GUARD
 
 #include <algorithm>
+#include <type_traits>
 
 #include <Core/Types/Int.hpp>
 
 #include <Core/Debug/Debug.hpp>
 
+#include <Core/Algorithms/MemStream.hpp>
+
 namespace Sa
 {
 	/**
@@ -43,6 +46,48 @@ namespace Sa
 		std::fill(_dest, _dest + _num, _val);
 	}
 
+	/**
+	*	\brief Fill a <b>block of memory</b> with val, without parameter checks.
+	*
+	*	Use in hot loops where pointers are already known valid.
+	*
+	*	\tparam T			Type of memory.
+	*
+	*	\param[out] _dest	Destination to fill.
+	*	\param[in] _val		Value to fill with.
+	*	\param[in] _num		Number of T to fill.
+	*/
+	template <typename T>
+	void MemFillUnchecked(T* _dest, const T& _val, uint64 _num) noexcept
+	{
+		std::fill(_dest, _dest + _num, _val);
+	}
+
+	/**
+	*	\brief Fill a <b>block of memory</b> with val with non-temporal stores.
+	*
+	*	Bypass caches: use for large fills (see MemStreamFill).
+	*	Types with a size not dividing 32 use std::fill.
+	*
+	*	\tparam T			Trivially copyable type of memory.
+	*
+	*	\param[out] _dest	Destination to fill.
+	*	\param[in] _val		Value to fill with.
+	*	\param[in] _num		Number of T to fill.
+	*/
+	template <typename T>
+	void MemFillStream(T* _dest, const T& _val, uint64 _num)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "MemFillStream requires a trivially copyable type!");
+
+		SA_ASSERT(_dest, Nullptr, Tools, L"_dest nullptr!");
+
+		if constexpr (sizeof(T) <= 32u && 32u % sizeof(T) == 0u)
+			MemStreamFill(_dest, &_val, sizeof(T), _num * sizeof(T));
+		else
+			std::fill(_dest, _dest + _num, _val);
+	}
+
 
 	/** \} */
 }
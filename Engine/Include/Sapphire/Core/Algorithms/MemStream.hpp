@@ -0,0 +1,62 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_MEM_STREAM_GUARD
+#define SAPPHIRE_CORE_MEM_STREAM_GUARD
+
+#include <Core/Config.hpp>
+
+#include <Core/Types/Int.hpp>
+#include <Core/Types/Char.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Core/Algorithms/MemStream.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>non-temporal memory</b> algorithms.
+	*
+	*	Streaming stores bypass the caches: use for large copies (bigger than the last level cache)
+	*	and uploads into write-combined mapped GPU memory, which are never read back by the CPU.
+	*	Small sizes fall back to std::mem*.
+	*
+	*	\ingroup Algorithms
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Copy a <b>block of memory</b> from src to dest with non-temporal stores.
+	*
+	*	Use AVX2 or SSE2 (selected at runtime), std::memcpy on other architectures.
+	*	Memory must not overlap.
+	*
+	*	\param[in] _src		Source to copy from.
+	*	\param[out] _dest	Destination to copy to.
+	*	\param[in] _size	Size in bytes.
+	*/
+	SA_ENGINE_API void MemStreamCopy(const void* _src, void* _dest, uint64 _size) noexcept;
+
+	/**
+	*	\brief Fill a <b>block of memory</b> with a repeated pattern with non-temporal stores.
+	*
+	*	\param[out] _dest			Destination to fill.
+	*	\param[in] _pattern			Pattern to repeat.
+	*	\param[in] _patternSize		Size of pattern in bytes: 1, 2, 4, 8, 16 or 32.
+	*	\param[in] _size			Size to fill in bytes (multiple of _patternSize).
+	*/
+	SA_ENGINE_API void MemStreamFill(void* _dest, const void* _pattern, uint32 _patternSize, uint64 _size) noexcept;
+
+	/**
+	*	\brief \e Getter of the instruction set used by MemStream algorithms.
+	*
+	*	\return "AVX2", "SSE2" or "Scalar".
+	*/
+	SA_ENGINE_API const char8* GetMemStreamISA() noexcept;
+
+
+	/** \} */
+}
+
+#endif // GUARD
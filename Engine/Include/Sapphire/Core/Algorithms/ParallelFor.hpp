@@ -0,0 +1,103 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_PARALLEL_FOR_GUARD
+#define SAPPHIRE_CORE_PARALLEL_FOR_GUARD
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Thread/JobSystem.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Core/Algorithms/ParallelFor.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b> Parallel For </b> algorithm.
+	*
+	*	\ingroup Algorithms
+	*	\{
+	*/
+
+
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// Target number of chunks per worker: balance load without flooding the deques.
+		constexpr uint32 ParallelChunksPerWorker = 4u;
+
+		/**
+		*	\brief Compute the number of elements processed per job.
+		*
+		*	\param[in] _num		Total number of elements.
+		*	\param[in] _grain	Min number of elements per job.
+		*
+		*	\return number of elements per job (_num if the range must be processed serially).
+		*/
+		inline uint32 ComputeParallelChunkSize(uint32 _num, uint32 _grain) noexcept
+		{
+			const uint32 workerNum = JobSystem::GetWorkerNum();
+
+			// Scalar fallback.
+			if (workerNum <= 1u || _num <= _grain)
+				return _num;
+
+			const uint32 chunkNum = workerNum * ParallelChunksPerWorker;
+			const uint32 chunkSize = (_num + chunkNum - 1u) / chunkNum;
+
+			return chunkSize > _grain ? chunkSize : (_grain ? _grain : 1u);
+		}
+	}
+
+	/// \endcond Internal
+
+
+	/**
+	*	\brief Execute _func for each index of [_begin, _end[ on the JobSystem.
+	*
+	*	The range is split in contiguous chunks of at least _grain elements.
+	*	The calling thread processes the last chunk and helps until completion.
+	*	Run serially if the range is not bigger than _grain or the JobSystem is not initialized.
+	*
+	*	\tparam F			Type of the callable.
+	*
+	*	\param[in] _begin	First index.
+	*	\param[in] _end		Past-the-end index.
+	*	\param[in] _grain	Min number of elements per job.
+	*	\param[in] _func	Callable to execute: void(uint32 _index). Must be thread-safe.
+	*/
+	template <typename F>
+	void ParallelFor(uint32 _begin, uint32 _end, uint32 _grain, F&& _func)
+	{
+		if (_end <= _begin)
+			return;
+
+		const uint32 chunkSize = Internal::ComputeParallelChunkSize(_end - _begin, _grain);
+
+		JobCounter counter;
+		uint32 start = _begin;
+
+		for (; _end - start > chunkSize; start += chunkSize)
+		{
+			const uint32 end = start + chunkSize;
+
+			JobSystem::Run([&_func, start, end]()
+			{
+				for (uint32 i = start; i < end; ++i)
+					_func(i);
+			}, &counter);
+		}
+
+		for (uint32 i = start; i < _end; ++i)
+			_func(i);
+
+		JobSystem::Wait(counter);
+	}
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,94 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_PARALLEL_REDUCE_GUARD
+#define SAPPHIRE_CORE_PARALLEL_REDUCE_GUARD
+
+#include <vector>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Algorithms/ParallelFor.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Core/Algorithms/ParallelReduce.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b> Parallel Reduce </b> algorithm.
+	*
+	*	\ingroup Algorithms
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Reduce _map(i) for each index of [_begin, _end[ with _reduce on the JobSystem.
+	*
+	*	Each chunk is reduced in order, then partial results are reduced in chunk order:
+	*	the result is deterministic for a given worker number (even for floating point).
+	*	Run serially if the range is not bigger than _grain or the JobSystem is not initialized.
+	*
+	*	\tparam T				Type of the reduced value.
+	*	\tparam Map				Type of the map callable.
+	*	\tparam Reduce			Type of the reduce callable.
+	*
+	*	\param[in] _begin		First index.
+	*	\param[in] _end			Past-the-end index.
+	*	\param[in] _grain		Min number of elements per job.
+	*	\param[in] _identity	Identity value of _reduce (ex: 0 for sum).
+	*	\param[in] _map			Value of an index: T(uint32 _index). Must be thread-safe.
+	*	\param[in] _reduce		Associative reduction: T(const T& _lhs, const T& _rhs).
+	*
+	*	\return reduced value.
+	*/
+	template <typename T, typename Map, typename Reduce>
+	T ParallelReduce(uint32 _begin, uint32 _end, uint32 _grain, T _identity, Map&& _map, Reduce&& _reduce)
+	{
+		if (_end <= _begin)
+			return _identity;
+
+		const uint32 num = _end - _begin;
+		const uint32 chunkSize = Internal::ComputeParallelChunkSize(num, _grain);
+		const uint32 chunkNum = (num + chunkSize - 1u) / chunkSize;
+
+		// Scalar fallback.
+		if (chunkNum == 1u)
+		{
+			T result = _identity;
+
+			for (uint32 i = _begin; i < _end; ++i)
+				result = _reduce(result, _map(i));
+
+			return result;
+		}
+
+		std::vector<T> partials(chunkNum, _identity);
+
+		ParallelFor(0u, chunkNum, 1u, [&](uint32 _chunk)
+		{
+			const uint32 start = _begin + _chunk * chunkSize;
+			const uint32 end = _end - start > chunkSize ? start + chunkSize : _end;
+
+			T partial = _identity;
+
+			for (uint32 i = start; i < end; ++i)
+				partial = _reduce(partial, _map(i));
+
+			partials[_chunk] = partial;
+		});
+
+		T result = _identity;
+
+		for (const T& partial : partials)
+			result = _reduce(result, partial);
+
+		return result;
+	}
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,116 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_PARALLEL_SCAN_GUARD
+#define SAPPHIRE_CORE_PARALLEL_SCAN_GUARD
+
+#include <vector>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Debug/Debug.hpp>
+
+#include <Core/Algorithms/ParallelFor.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Core/Algorithms/ParallelScan.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b> Parallel Scan </b> (prefix sum) algorithm.
+	*
+	*	\ingroup Algorithms
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Inclusive scan of _src into _dest on the JobSystem: _dest[i] = _src[0] op ... op _src[i].
+	*
+	*	Three passes: reduce each chunk, scan chunk totals serially, scan each chunk with its offset.
+	*	_src and _dest may be the same array (in-place scan).
+	*	Run serially if _num is not bigger than _grain or the JobSystem is not initialized.
+	*
+	*	\tparam T				Type of element.
+	*	\tparam Op				Type of the associative operation.
+	*
+	*	\param[in] _src			Source to scan.
+	*	\param[out] _dest		Destination of the scan (_num elements).
+	*	\param[in] _num			Number of elements.
+	*	\param[in] _grain		Min number of elements per job.
+	*	\param[in] _identity	Identity value of _op (ex: 0 for sum).
+	*	\param[in] _op			Associative operation: T(const T& _lhs, const T& _rhs).
+	*/
+	template <typename T, typename Op>
+	void ParallelScan(const T* _src, T* _dest, uint32 _num, uint32 _grain, T _identity, Op&& _op)
+	{
+		SA_ASSERT(_src, Nullptr, Tools, L"_src nullptr!");
+		SA_ASSERT(_dest, Nullptr, Tools, L"_dest nullptr!");
+
+		if (_num == 0u)
+			return;
+
+		const uint32 chunkSize = Internal::ComputeParallelChunkSize(_num, _grain);
+		const uint32 chunkNum = (_num + chunkSize - 1u) / chunkSize;
+
+		// Scalar fallback.
+		if (chunkNum == 1u)
+		{
+			T sum = _identity;
+
+			for (uint32 i = 0u; i < _num; ++i)
+			{
+				sum = _op(sum, _src[i]);
+				_dest[i] = sum;
+			}
+
+			return;
+		}
+
+		// Chunk totals (the last chunk total is never used as offset).
+		std::vector<T> offsets(chunkNum, _identity);
+
+		ParallelFor(0u, chunkNum - 1u, 1u, [&](uint32 _chunk)
+		{
+			const uint32 start = _chunk * chunkSize;
+
+			T sum = _identity;
+
+			for (uint32 i = start; i < start + chunkSize; ++i)
+				sum = _op(sum, _src[i]);
+
+			offsets[_chunk] = sum;
+		});
+
+		// Exclusive scan of chunk totals.
+		T offset = _identity;
+
+		for (uint32 i = 0u; i < chunkNum; ++i)
+		{
+			const T total = offsets[i];
+
+			offsets[i] = offset;
+			offset = _op(offset, total);
+		}
+
+		ParallelFor(0u, chunkNum, 1u, [&](uint32 _chunk)
+		{
+			const uint32 start = _chunk * chunkSize;
+			const uint32 end = _num - start > chunkSize ? start + chunkSize : _num;
+
+			T sum = offsets[_chunk];
+
+			for (uint32 i = start; i < end; ++i)
+			{
+				sum = _op(sum, _src[i]);
+				_dest[i] = sum;
+			}
+		});
+	}
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,125 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_PARALLEL_SORT_GUARD
+#define SAPPHIRE_CORE_PARALLEL_SORT_GUARD
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Debug/Debug.hpp>
+
+#include <Core/Algorithms/Move.hpp>
+#include <Core/Algorithms/ParallelFor.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Core/Algorithms/ParallelSort.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b> Parallel Sort </b> algorithm.
+	*
+	*	\ingroup Algorithms
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Sort _data in place on the JobSystem (merge sort).
+	*
+	*	Sort chunks in parallel, then merge pairs of runs in parallel passes through a temporary buffer.
+	*	Run std::sort serially if _num is not bigger than _grain or the JobSystem is not initialized.
+	*	Not stable.
+	*
+	*	\tparam T			Type of element. Must be move constructible and move assignable.
+	*	\tparam Compare		Type of the comparison callable.
+	*
+	*	\param[in, out] _data	Elements to sort.
+	*	\param[in] _num			Number of elements.
+	*	\param[in] _grain		Min number of elements per job.
+	*	\param[in] _comp		Strict weak ordering: bool(const T& _lhs, const T& _rhs).
+	*/
+	template <typename T, typename Compare>
+	void ParallelSort(T* _data, uint32 _num, uint32 _grain, Compare _comp)
+	{
+		SA_ASSERT(_data || _num == 0u, Nullptr, Tools, L"_data nullptr!");
+
+		const uint32 chunkSize = _num ? Internal::ComputeParallelChunkSize(_num, _grain) : 0u;
+
+		// Scalar fallback.
+		if (chunkSize == _num)
+		{
+			std::sort(_data, _data + _num, _comp);
+			return;
+		}
+
+		const uint32 chunkNum = (_num + chunkSize - 1u) / chunkSize;
+
+		ParallelFor(0u, chunkNum, 1u, [&](uint32 _chunk)
+		{
+			const uint32 start = _chunk * chunkSize;
+			const uint32 end = _num - start > chunkSize ? start + chunkSize : _num;
+
+			std::sort(_data + start, _data + end, _comp);
+		});
+
+
+		// Merge sorted runs by pairs, ping-ponging between _data and buffer.
+		std::vector<T> buffer(_num);
+
+		T* src = _data;
+		T* dst = buffer.data();
+
+		for (uint32 width = chunkSize; width < _num; width = _num - width > width ? width * 2u : _num)
+		{
+			const uint32 pairNum = (_num + 2u * width - 1u) / (2u * width);
+
+			ParallelFor(0u, pairNum, 1u, [&](uint32 _pair)
+			{
+				const uint32 lo = _pair * 2u * width;
+				const uint32 mid = _num - lo > width ? lo + width : _num;
+				const uint32 hi = _num - mid > width ? mid + width : _num;
+
+				std::merge(std::make_move_iterator(src + lo), std::make_move_iterator(src + mid),
+					std::make_move_iterator(src + mid), std::make_move_iterator(src + hi),
+					dst + lo, _comp);
+			});
+
+			std::swap(src, dst);
+		}
+
+		// Result ended in the buffer.
+		if (src != _data)
+		{
+			ParallelFor(0u, _num, _grain, [&](uint32 _index)
+			{
+				_data[_index] = Move(src[_index]);
+			});
+		}
+	}
+
+	/**
+	*	\brief Sort _data in ascending order on the JobSystem (merge sort).
+	*
+	*	\tparam T			Type of element. Must be move constructible, move assignable and have operator<.
+	*
+	*	\param[in, out] _data	Elements to sort.
+	*	\param[in] _num			Number of elements.
+	*	\param[in] _grain		Min number of elements per job.
+	*/
+	template <typename T>
+	void ParallelSort(T* _data, uint32 _num, uint32 _grain = 4096u)
+	{
+		ParallelSort(_data, _num, _grain, std::less<T>());
+	}
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -26,6 +26,78 @@
 #endif
 
 
+#ifndef SA_ASSERT_TRACE_SUCCESS
+
+	/// Toogle output of successful assertions (AssertSuccess level) Sapphire's preprocessor.
+	#define SA_ASSERT_TRACE_SUCCESS 0
+
+#endif
+
+
+#ifndef SA_LOG_MIN_LEVEL
+
+	/**
+	*	Minimum compiled log level Sapphire's preprocessor.
+	*	Lower level logs compile to nothing: 0 Normal, 1 Infos, 2 Warning, 3 Error.
+	*/
+	#define SA_LOG_MIN_LEVEL 0
+
+#endif
+
+/**
+*	SA_LOG_CHANNELS: compiled log channel list Sapphire's preprocessor (ex: L"Default", L"Rendering").
+*	Logs of other channels compile to nothing. All channels are compiled if not defined.
+*/
+
+
+#ifndef SA_LOG_ASYNC
+
+	/// Toogle asynchronous logging (background sink thread) Sapphire's preprocessor.
+	#define SA_LOG_ASYNC 1
+
+#endif
+
+
+#ifndef SA_FLIGHT_RECORDER
+
+	/// Toogle crash-dumped ring of recent logs, frames and GPU submissions Sapphire's preprocessor.
+	#define SA_FLIGHT_RECORDER 1
+
+#endif
+
+
+#ifndef SA_PROFILING
+
+	/// Toogle CPU profiler zones (SA_PROFILE_SCOPE) Sapphire's preprocessor.
+	#define SA_PROFILING SA_DEBUG
+
+#endif
+
+
+#ifndef SA_PROFILING_CPU_CLOCK
+
+	/// Toogle profiler timing with the calibrated CPU counter (CpuClock) instead of Time::NanoSeconds() Sapphire's preprocessor.
+	#define SA_PROFILING_CPU_CLOCK 0
+
+#endif
+
+
+#ifndef SA_LOCK_STATS
+
+	/// Toogle lock contention counters Sapphire's preprocessor.
+	#define SA_LOCK_STATS SA_DEBUG
+
+#endif
+
+
+#ifndef SA_MEMORY_GLOBAL_NEW
+
+	/// Toogle global new / delete replacement by the tagged TLSF Heap Sapphire's preprocessor.
+	#define SA_MEMORY_GLOBAL_NEW 0
+
+#endif
+
+
 /// Sapphire global namespace
 namespace Sa
 {
@@ -77,6 +149,22 @@ namespace Sa
 */
 
 
+/**
+*	\defgroup Containers Containers
+*	Sapphire Container classes.
+*
+*	\ingroup Core
+*/
+
+
+/**
+*	\defgroup Memory Memory
+*	Sapphire Memory allocation classes.
+*
+*	\ingroup Core
+*/
+
+
 /**
 *	\defgroup Time Time
 *	Sapphire Time-relative classes.
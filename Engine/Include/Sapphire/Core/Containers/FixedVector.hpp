@@ -0,0 +1,226 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_FIXED_VECTOR_GUARD
+#define SAPPHIRE_CORE_FIXED_VECTOR_GUARD
+
+#include <initializer_list>
+
+#include <Collections/Debug>
+
+#include <Core/Types/Int.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file FixedVector.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>fixed-capacity vector</b> type.
+	*
+	*	\ingroup Containers
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Vector with <b>inline storage</b> of N elements, never allocates.
+	*
+	*	Exceeding the capacity is asserted.
+	*
+	*	\tparam T	Type of element.
+	*	\tparam N	Capacity.
+	*/
+	template <typename T, uint32 N>
+	class FixedVector
+	{
+		static_assert(N > 0u, "FixedVector capacity must not be 0!");
+
+		/// Element number.
+		uint32 mSize = 0u;
+
+		/// Inline storage.
+		alignas(T) uint8 mData[N * sizeof(T)];
+
+	public:
+		/// STL value type.
+		using value_type = T;
+
+		/// Capacity.
+		static constexpr uint32 Capacity = N;
+
+		/**
+		*	\brief \e Default constructor.
+		*/
+		FixedVector() = default;
+
+		/**
+		*	\brief \e Value constructor: _size copies of _value.
+		*
+		*	\param[in] _size	Element number.
+		*	\param[in] _value	Element value.
+		*/
+		explicit FixedVector(uint32 _size, const T& _value = T());
+
+		/**
+		*	\brief \e Value constructor from an initializer list.
+		*
+		*	\param[in] _list	Elements.
+		*/
+		FixedVector(std::initializer_list<T> _list);
+
+		/**
+		*	\brief \e Move constructor.
+		*
+		*	\param[in] _other	Other vector to move.
+		*/
+		FixedVector(FixedVector&& _other);
+
+		/**
+		*	\brief \e Copy constructor.
+		*
+		*	\param[in] _other	Other vector to copy.
+		*/
+		FixedVector(const FixedVector& _other);
+
+		/**
+		*	\brief \e Destructor.
+		*/
+		~FixedVector();
+
+
+		/**
+		*	\brief \e Getter of the number of elements.
+		*
+		*	\return element number.
+		*/
+		uint32 Size() const noexcept;
+
+		/**
+		*	\brief Whether the vector is empty.
+		*
+		*	\return true if no element.
+		*/
+		bool IsEmpty() const noexcept;
+
+		/**
+		*	\brief Whether the vector is full.
+		*
+		*	\return true if Size() == Capacity.
+		*/
+		bool IsFull() const noexcept;
+
+
+		/**
+		*	\brief \b Resize: default construct or destroy elements.
+		*
+		*	\param[in] _size	New element number (<= Capacity).
+		*/
+		void Resize(uint32 _size);
+
+		/**
+		*	\brief \b Destroy every element.
+		*/
+		void Clear() noexcept;
+
+
+		/**
+		*	\brief \b Construct an element in place at the end.
+		*
+		*	\param[in] _args	Constructor arguments.
+		*
+		*	\return new element.
+		*/
+		template <typename... Args>
+		T& EmplaceBack(Args&&... _args);
+
+		/**
+		*	\brief \b Copy an element at the end.
+		*
+		*	\param[in] _elem	Element to copy.
+		*/
+		void PushBack(const T& _elem);
+
+		/**
+		*	\brief \b Move an element at the end.
+		*
+		*	\param[in] _elem	Element to move.
+		*/
+		void PushBack(T&& _elem);
+
+		/**
+		*	\brief \b Copy _num elements at the end.
+		*
+		*	\param[in] _elems	Elements to copy.
+		*	\param[in] _num		Element number.
+		*/
+		void Append(const T* _elems, uint32 _num);
+
+		/**
+		*	\brief \b Destroy the last element.
+		*/
+		void PopBack();
+
+		/**
+		*	\brief \b Erase an element: following elements are shifted.
+		*
+		*	\param[in] _index	Index of the element.
+		*/
+		void Erase(uint32 _index);
+
+
+		T* Data() noexcept;
+		const T* Data() const noexcept;
+
+		T* begin() noexcept;
+		const T* begin() const noexcept;
+
+		T* end() noexcept;
+		const T* end() const noexcept;
+
+
+		/**
+		*	\brief \e Move operator=.
+		*
+		*	\param[in] _rhs		Other vector to move.
+		*
+		*	\return this instance.
+		*/
+		FixedVector& operator=(FixedVector&& _rhs);
+
+		/**
+		*	\brief \e Copy operator=.
+		*
+		*	\param[in] _rhs		Other vector to copy.
+		*
+		*	\return this instance.
+		*/
+		FixedVector& operator=(const FixedVector& _rhs);
+
+
+		/**
+		*	\brief \e Access operator by index (asserted in range).
+		*
+		*	\param[in] _index	Index of the element.
+		*
+		*	\return element.
+		*/
+		T& operator[](uint32 _index);
+
+		/**
+		*	\brief \e Const access operator by index (asserted in range).
+		*
+		*	\param[in] _index	Index of the element.
+		*
+		*	\return element.
+		*/
+		const T& operator[](uint32 _index) const;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Containers/FixedVector.inl>
+
+#endif // GUARD
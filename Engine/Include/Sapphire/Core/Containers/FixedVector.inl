@@ -0,0 +1,234 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <new>
+
+#include <Core/Algorithms/Move.hpp>
+#include <Core/Algorithms/Forward.hpp>
+
+namespace Sa
+{
+//{ Constructors
+
+	template <typename T, uint32 N>
+	FixedVector<T, N>::FixedVector(uint32 _size, const T& _value)
+	{
+		SA_ASSERT(_size <= N, OutOfRange, Tools, _size, 0u, N);
+
+		for (; mSize < _size; ++mSize)
+			new(Data() + mSize) T(_value);
+	}
+
+	template <typename T, uint32 N>
+	FixedVector<T, N>::FixedVector(std::initializer_list<T> _list)
+	{
+		Append(_list.begin(), static_cast<uint32>(_list.size()));
+	}
+
+	template <typename T, uint32 N>
+	FixedVector<T, N>::FixedVector(FixedVector&& _other)
+	{
+		for (; mSize < _other.mSize; ++mSize)
+			new(Data() + mSize) T(Move(_other.Data()[mSize]));
+
+		_other.Clear();
+	}
+
+	template <typename T, uint32 N>
+	FixedVector<T, N>::FixedVector(const FixedVector& _other)
+	{
+		Append(_other.Data(), _other.mSize);
+	}
+
+	template <typename T, uint32 N>
+	FixedVector<T, N>::~FixedVector()
+	{
+		Clear();
+	}
+
+//}
+
+	template <typename T, uint32 N>
+	uint32 FixedVector<T, N>::Size() const noexcept
+	{
+		return mSize;
+	}
+
+	template <typename T, uint32 N>
+	bool FixedVector<T, N>::IsEmpty() const noexcept
+	{
+		return mSize == 0u;
+	}
+
+	template <typename T, uint32 N>
+	bool FixedVector<T, N>::IsFull() const noexcept
+	{
+		return mSize == N;
+	}
+
+
+	template <typename T, uint32 N>
+	void FixedVector<T, N>::Resize(uint32 _size)
+	{
+		SA_ASSERT(_size <= N, OutOfRange, Tools, _size, 0u, N);
+
+		for (uint32 i = mSize; i < _size; ++i)
+			new(Data() + i) T();
+
+		for (uint32 i = _size; i < mSize; ++i)
+			Data()[i].~T();
+
+		mSize = _size;
+	}
+
+	template <typename T, uint32 N>
+	void FixedVector<T, N>::Clear() noexcept
+	{
+		for (uint32 i = 0u; i < mSize; ++i)
+			Data()[i].~T();
+
+		mSize = 0u;
+	}
+
+//{ Elements
+
+	template <typename T, uint32 N>
+	template <typename... Args>
+	T& FixedVector<T, N>::EmplaceBack(Args&&... _args)
+	{
+		SA_ASSERT(mSize < N, OutOfRange, Tools, mSize, 0u, N - 1u);
+
+		return *new(Data() + mSize++) T(Forward<Args>(_args)...);
+	}
+
+	template <typename T, uint32 N>
+	void FixedVector<T, N>::PushBack(const T& _elem)
+	{
+		EmplaceBack(_elem);
+	}
+
+	template <typename T, uint32 N>
+	void FixedVector<T, N>::PushBack(T&& _elem)
+	{
+		EmplaceBack(Move(_elem));
+	}
+
+	template <typename T, uint32 N>
+	void FixedVector<T, N>::Append(const T* _elems, uint32 _num)
+	{
+		SA_ASSERT(mSize + _num <= N, OutOfRange, Tools, mSize + _num, 0u, N);
+
+		for (uint32 i = 0u; i < _num; ++i)
+			new(Data() + mSize + i) T(_elems[i]);
+
+		mSize += _num;
+	}
+
+	template <typename T, uint32 N>
+	void FixedVector<T, N>::PopBack()
+	{
+		SA_ASSERT(mSize, InvalidParam, Tools, L"PopBack on empty vector!");
+
+		Data()[--mSize].~T();
+	}
+
+	template <typename T, uint32 N>
+	void FixedVector<T, N>::Erase(uint32 _index)
+	{
+		SA_ASSERT(_index < mSize, OutOfRange, Tools, _index, 0u, mSize - 1u);
+
+		T* const data = Data();
+
+		for (uint32 i = _index + 1u; i < mSize; ++i)
+			data[i - 1u] = Move(data[i]);
+
+		data[--mSize].~T();
+	}
+
+
+	template <typename T, uint32 N>
+	T* FixedVector<T, N>::Data() noexcept
+	{
+		return reinterpret_cast<T*>(mData);
+	}
+
+	template <typename T, uint32 N>
+	const T* FixedVector<T, N>::Data() const noexcept
+	{
+		return reinterpret_cast<const T*>(mData);
+	}
+
+	template <typename T, uint32 N>
+	T* FixedVector<T, N>::begin() noexcept
+	{
+		return Data();
+	}
+
+	template <typename T, uint32 N>
+	const T* FixedVector<T, N>::begin() const noexcept
+	{
+		return Data();
+	}
+
+	template <typename T, uint32 N>
+	T* FixedVector<T, N>::end() noexcept
+	{
+		return Data() + mSize;
+	}
+
+	template <typename T, uint32 N>
+	const T* FixedVector<T, N>::end() const noexcept
+	{
+		return Data() + mSize;
+	}
+
+//}
+
+//{ Operators
+
+	template <typename T, uint32 N>
+	FixedVector<T, N>& FixedVector<T, N>::operator=(FixedVector&& _rhs)
+	{
+		if (this == &_rhs)
+			return *this;
+
+		Clear();
+
+		for (; mSize < _rhs.mSize; ++mSize)
+			new(Data() + mSize) T(Move(_rhs.Data()[mSize]));
+
+		_rhs.Clear();
+
+		return *this;
+	}
+
+	template <typename T, uint32 N>
+	FixedVector<T, N>& FixedVector<T, N>::operator=(const FixedVector& _rhs)
+	{
+		if (this == &_rhs)
+			return *this;
+
+		Clear();
+		Append(_rhs.Data(), _rhs.mSize);
+
+		return *this;
+	}
+
+
+	template <typename T, uint32 N>
+	T& FixedVector<T, N>::operator[](uint32 _index)
+	{
+		SA_ASSERT(_index < mSize, OutOfRange, Tools, _index, 0u, mSize - 1u);
+
+		return Data()[_index];
+	}
+
+	template <typename T, uint32 N>
+	const T& FixedVector<T, N>::operator[](uint32 _index) const
+	{
+		SA_ASSERT(_index < mSize, OutOfRange, Tools, _index, 0u, mSize - 1u);
+
+		return Data()[_index];
+	}
+
+//}
+}
@@ -0,0 +1,130 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_FLAT_HASH_MAP_GUARD
+#define SAPPHIRE_CORE_FLAT_HASH_MAP_GUARD
+
+#include <Core/Containers/FlatHashTable.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file FlatHashMap.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>flat hash map</b> type.
+	*
+	*	\ingroup Containers
+	*	\{
+	*/
+
+
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// Key getter of a map slot.
+		struct FlatHashMapKeyOf
+		{
+			template <typename PairT>
+			const auto& operator()(const PairT& _pair) const noexcept { return _pair.first; }
+		};
+	}
+
+	/// \endcond Internal
+
+
+	/**
+	*	\brief <b>Open-addressing hash map</b>: key / value pairs stored inline.
+	*
+	*	Much faster than std::unordered_map (no node allocation, SIMD probing)
+	*	but pointers and iterators are invalidated by any insertion.
+	*	Iteration yields std::pair<const Key, Value>.
+	*
+	*	\tparam Key		Key type. Must be equality comparable.
+	*	\tparam Value	Value type.
+	*	\tparam HashT	Hash functor.
+	*/
+	template <typename Key, typename Value, typename HashT = Hash<Key>>
+	class FlatHashMap : public Internal::FlatHashTable<Key, std::pair<const Key, Value>, Internal::FlatHashMapKeyOf, HashT>
+	{
+		using Base = Internal::FlatHashTable<Key, std::pair<const Key, Value>, Internal::FlatHashMapKeyOf, HashT>;
+
+	public:
+		/**
+		*	\brief \e Getter of the value of a key.
+		*
+		*	\param[in] _key		Key to find.
+		*
+		*	\return value, nullptr if not found.
+		*/
+		Value* Find(const Key& _key) noexcept;
+
+		/**
+		*	\brief \e Const getter of the value of a key.
+		*
+		*	\param[in] _key		Key to find.
+		*
+		*	\return value, nullptr if not found.
+		*/
+		const Value* Find(const Key& _key) const noexcept;
+
+		/**
+		*	\brief Whether a key is in the map.
+		*
+		*	\param[in] _key		Key to find.
+		*
+		*	\return true if found.
+		*/
+		bool Contains(const Key& _key) const noexcept;
+
+
+		/**
+		*	\brief \b Construct a value in place if the key is not in the map.
+		*
+		*	\tparam Args		Value constructor argument types.
+		*	\param[in] _key		Key to insert.
+		*	\param[in] _args	Value constructor arguments (unused if the key exists).
+		*
+		*	\return value of the key and whether it has been inserted.
+		*/
+		template <typename... Args>
+		std::pair<Value*, bool> Emplace(const Key& _key, Args&&... _args);
+
+		/**
+		*	\brief \b Insert a value if the key is not in the map.
+		*
+		*	\param[in] _key		Key to insert.
+		*	\param[in] _value	Value to insert.
+		*
+		*	\return true if inserted, false if the key already exists (value unchanged).
+		*/
+		bool Insert(const Key& _key, Value _value);
+
+		/**
+		*	\brief \b Remove a key.
+		*
+		*	\param[in] _key		Key to remove.
+		*
+		*	\return false if the key was not found.
+		*/
+		bool Remove(const Key& _key);
+
+
+		/**
+		*	\brief \e Access operator by key: default construct the value if not found.
+		*
+		*	\param[in] _key		Key to access.
+		*
+		*	\return value of the key.
+		*/
+		Value& operator[](const Key& _key);
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Containers/FlatHashMap.inl>
+
+#endif // GUARD
@@ -0,0 +1,74 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <tuple>
+
+#include <Core/Algorithms/Forward.hpp>
+
+namespace Sa
+{
+	template <typename Key, typename Value, typename HashT>
+	Value* FlatHashMap<Key, Value, HashT>::Find(const Key& _key) noexcept
+	{
+		const uint64 index = Base::FindIndex(_key, HashT{}(_key));
+
+		return index != Base::mCapacity ? &Base::mSlots[index].second : nullptr;
+	}
+
+	template <typename Key, typename Value, typename HashT>
+	const Value* FlatHashMap<Key, Value, HashT>::Find(const Key& _key) const noexcept
+	{
+		const uint64 index = Base::FindIndex(_key, HashT{}(_key));
+
+		return index != Base::mCapacity ? &Base::mSlots[index].second : nullptr;
+	}
+
+	template <typename Key, typename Value, typename HashT>
+	bool FlatHashMap<Key, Value, HashT>::Contains(const Key& _key) const noexcept
+	{
+		return Base::FindIndex(_key, HashT{}(_key)) != Base::mCapacity;
+	}
+
+
+	template <typename Key, typename Value, typename HashT>
+	template <typename... Args>
+	std::pair<Value*, bool> FlatHashMap<Key, Value, HashT>::Emplace(const Key& _key, Args&&... _args)
+	{
+		const std::pair<uint64, bool> res = Base::FindOrPrepareInsert(_key);
+
+		auto& slot = Base::mSlots[res.first];
+
+		if (res.second)
+		{
+			new(Base::SlotAddress(res.first)) std::pair<const Key, Value>(std::piecewise_construct,
+				std::forward_as_tuple(_key), std::forward_as_tuple(Forward<Args>(_args)...));
+		}
+
+		return { &slot.second, res.second };
+	}
+
+	template <typename Key, typename Value, typename HashT>
+	bool FlatHashMap<Key, Value, HashT>::Insert(const Key& _key, Value _value)
+	{
+		return Emplace(_key, Move(_value)).second;
+	}
+
+	template <typename Key, typename Value, typename HashT>
+	bool FlatHashMap<Key, Value, HashT>::Remove(const Key& _key)
+	{
+		const uint64 index = Base::FindIndex(_key, HashT{}(_key));
+
+		if (index == Base::mCapacity)
+			return false;
+
+		Base::EraseIndex(index);
+
+		return true;
+	}
+
+
+	template <typename Key, typename Value, typename HashT>
+	Value& FlatHashMap<Key, Value, HashT>::operator[](const Key& _key)
+	{
+		return *Emplace(_key).first;
+	}
+}
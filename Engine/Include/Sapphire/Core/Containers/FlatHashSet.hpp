@@ -0,0 +1,85 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_FLAT_HASH_SET_GUARD
+#define SAPPHIRE_CORE_FLAT_HASH_SET_GUARD
+
+#include <Core/Containers/FlatHashTable.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file FlatHashSet.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>flat hash set</b> type.
+	*
+	*	\ingroup Containers
+	*	\{
+	*/
+
+
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// Key getter of a set slot.
+		struct FlatHashSetKeyOf
+		{
+			template <typename KeyT>
+			const KeyT& operator()(const KeyT& _key) const noexcept { return _key; }
+		};
+	}
+
+	/// \endcond Internal
+
+
+	/**
+	*	\brief <b>Open-addressing hash set</b>: keys stored inline.
+	*
+	*	See FlatHashMap. Iteration yields const Key.
+	*
+	*	\tparam Key		Key type. Must be equality comparable.
+	*	\tparam HashT	Hash functor.
+	*/
+	template <typename Key, typename HashT = Hash<Key>>
+	class FlatHashSet : public Internal::FlatHashTable<Key, const Key, Internal::FlatHashSetKeyOf, HashT>
+	{
+		using Base = Internal::FlatHashTable<Key, const Key, Internal::FlatHashSetKeyOf, HashT>;
+
+	public:
+		/**
+		*	\brief Whether a key is in the set.
+		*
+		*	\param[in] _key		Key to find.
+		*
+		*	\return true if found.
+		*/
+		bool Contains(const Key& _key) const noexcept;
+
+		/**
+		*	\brief \b Insert a key.
+		*
+		*	\param[in] _key		Key to insert.
+		*
+		*	\return true if inserted, false if already in the set.
+		*/
+		bool Insert(const Key& _key);
+
+		/**
+		*	\brief \b Remove a key.
+		*
+		*	\param[in] _key		Key to remove.
+		*
+		*	\return false if the key was not found.
+		*/
+		bool Remove(const Key& _key);
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Containers/FlatHashSet.inl>
+
+#endif // GUARD
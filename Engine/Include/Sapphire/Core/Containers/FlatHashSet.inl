@@ -0,0 +1,34 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	template <typename Key, typename HashT>
+	bool FlatHashSet<Key, HashT>::Contains(const Key& _key) const noexcept
+	{
+		return Base::FindIndex(_key, HashT{}(_key)) != Base::mCapacity;
+	}
+
+	template <typename Key, typename HashT>
+	bool FlatHashSet<Key, HashT>::Insert(const Key& _key)
+	{
+		const std::pair<uint64, bool> res = Base::FindOrPrepareInsert(_key);
+
+		if (res.second)
+			new(Base::SlotAddress(res.first)) Key(_key);
+
+		return res.second;
+	}
+
+	template <typename Key, typename HashT>
+	bool FlatHashSet<Key, HashT>::Remove(const Key& _key)
+	{
+		const uint64 index = Base::FindIndex(_key, HashT{}(_key));
+
+		if (index == Base::mCapacity)
+			return false;
+
+		Base::EraseIndex(index);
+
+		return true;
+	}
+}
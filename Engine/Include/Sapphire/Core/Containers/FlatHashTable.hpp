@@ -0,0 +1,256 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_FLAT_HASH_TABLE_GUARD
+#define SAPPHIRE_CORE_FLAT_HASH_TABLE_GUARD
+
+#include <utility>
+
+#include <Core/Types/Int.hpp>
+#include <Core/Support/Compilers.hpp>
+#include <Core/Support/Architectures.hpp>
+
+#include <Core/Algorithms/Hash.hpp>
+
+#if defined(__SSE2__) || (SA_MSVC && SA_x64)
+
+	/// Whether FlatHashGroup uses SSE2 instructions.
+	#define SA_FLAT_HASH_SSE2 1
+
+	#include <emmintrin.h>
+
+#else
+
+	/// Whether FlatHashGroup uses SSE2 instructions.
+	#define SA_FLAT_HASH_SSE2 0
+
+#endif
+
+namespace Sa
+{
+	/**
+	*	\file FlatHashTable.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>open-addressing hash table</b> base.
+	*
+	*	\ingroup Containers
+	*	\{
+	*/
+
+
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/**
+		*	\brief Control bytes of a flat hash table slot.
+		*
+		*	Full slots store the 7 low bits of their hash (h2): high bit cleared.
+		*/
+		struct FlatHashCtrl
+		{
+			/// Never used slot: ends a probe sequence.
+			static constexpr uint8 Empty = 0x80;
+
+			/// Erased slot (tombstone): probe sequences continue.
+			static constexpr uint8 Deleted = 0xFE;
+
+			static constexpr bool IsFull(uint8 _ctrl) noexcept { return (_ctrl & 0x80) == 0u; }
+		};
+
+
+		/**
+		*	\brief Group of control bytes, matched in parallel (SSE2 when available).
+		*/
+		class FlatHashGroup
+		{
+#if SA_FLAT_HASH_SSE2
+			__m128i mCtrl;
+#else
+			const uint8* mCtrl = nullptr;
+#endif
+
+		public:
+			/// Number of control bytes in a group.
+			static constexpr uint32 Size = 16u;
+
+			explicit FlatHashGroup(const uint8* _ctrl) noexcept;
+
+			/// Bitmask of slots whose h2 matches.
+			uint32 Match(uint8 _h2) const noexcept;
+
+			/// Bitmask of Empty slots.
+			uint32 MatchEmpty() const noexcept;
+
+			/// Bitmask of Empty or Deleted slots.
+			uint32 MatchNonFull() const noexcept;
+
+			/// Index of the lowest bit set (_mask != 0).
+			static uint32 LowestBit(uint32 _mask) noexcept;
+		};
+
+
+		/**
+		*	\brief <b>SwissTable-like</b> open-addressing hash table.
+		*
+		*	Slots are stored inline in one allocation with a control byte array.
+		*	A lookup loads 16 control bytes at once and only compares keys of slots
+		*	with matching 7-bit hash (h2): usually a single cache miss per lookup.
+		*	Groups are probed quadratically. Max load factor is 7/8.
+		*
+		*	\tparam Key		Key type.
+		*	\tparam Slot	Stored element type.
+		*	\tparam KeyOf	Functor returning the key of a slot.
+		*	\tparam HashT	Hash functor (64-bit result, good high and low bits).
+		*/
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		class FlatHashTable
+		{
+		protected:
+			/// Control bytes: mCapacity bytes, then a clone of the first group (wrap-around loads).
+			uint8* mCtrl = nullptr;
+
+			/// Slot array.
+			Slot* mSlots = nullptr;
+
+			/// Slot number (0 or power of 2 >= FlatHashGroup::Size).
+			uint64 mCapacity = 0u;
+
+			/// Full slot number.
+			uint64 mSize = 0u;
+
+			/// Number of Empty slots that can still be filled before rehash.
+			uint64 mGrowthLeft = 0u;
+
+
+			static constexpr uint8 H2(uint64 _hash) noexcept { return static_cast<uint8>(_hash & 0x7F); }
+			static constexpr uint64 H1(uint64 _hash) noexcept { return _hash >> 7u; }
+
+			/// Capacity to hold _size elements under max load factor.
+			static uint64 ComputeCapacity(uint64 _size) noexcept;
+
+			/// Slot number that can be filled at a capacity.
+			static constexpr uint64 MaxLoad(uint64 _capacity) noexcept { return _capacity - _capacity / 8u; }
+
+			/// Raw memory of a slot (placement new).
+			void* SlotAddress(uint64 _index) const noexcept;
+
+			void SetCtrl(uint64 _index, uint8 _ctrl) noexcept;
+
+			/// Find the slot index of a key (mCapacity if not found).
+			uint64 FindIndex(const Key& _key, uint64 _hash) const noexcept;
+
+			/// First Empty or Deleted slot of the probe sequence.
+			uint64 FindNonFull(uint64 _hash) const noexcept;
+
+			/**
+			*	\brief Find a key or reserve its slot (marked full, not constructed).
+			*
+			*	\return slot index and whether the caller must construct the slot.
+			*/
+			std::pair<uint64, bool> FindOrPrepareInsert(const Key& _key);
+
+			/// Erase a full slot.
+			void EraseIndex(uint64 _index) noexcept;
+
+			void Rehash(uint64 _capacity);
+
+			void Allocate(uint64 _capacity);
+			void Deallocate() noexcept;
+
+			void DestroySlots() noexcept;
+			void CopyFrom(const FlatHashTable& _other);
+			void MoveFrom(FlatHashTable&& _other) noexcept;
+
+		public:
+			/**
+			*	\brief Forward iterator over full slots.
+			*
+			*	\tparam SlotT	Slot or const Slot.
+			*/
+			template <typename SlotT>
+			class Iterator
+			{
+				const uint8* mCtrl = nullptr;
+				const uint8* mEnd = nullptr;
+				SlotT* mSlot = nullptr;
+
+				void SkipNonFull() noexcept;
+
+			public:
+				Iterator() = default;
+				Iterator(const uint8* _ctrl, const uint8* _end, SlotT* _slot) noexcept;
+
+				SlotT& operator*() const noexcept;
+				SlotT* operator->() const noexcept;
+
+				Iterator& operator++() noexcept;
+
+				bool operator==(const Iterator& _rhs) const noexcept;
+				bool operator!=(const Iterator& _rhs) const noexcept;
+			};
+
+
+			FlatHashTable() = default;
+			FlatHashTable(FlatHashTable&& _other) noexcept;
+			FlatHashTable(const FlatHashTable& _other);
+			~FlatHashTable();
+
+
+			/**
+			*	\brief \e Getter of the number of elements.
+			*
+			*	\return element number.
+			*/
+			uint64 Size() const noexcept;
+
+			/**
+			*	\brief Whether the table is empty.
+			*
+			*	\return true if no element.
+			*/
+			bool IsEmpty() const noexcept;
+
+			/**
+			*	\brief \e Getter of the slot number.
+			*
+			*	\return slot number.
+			*/
+			uint64 GetCapacity() const noexcept;
+
+
+			/**
+			*	\brief \b Reserve memory to insert _size elements without rehash.
+			*
+			*	\param[in] _size	Number of elements.
+			*/
+			void Reserve(uint64 _size);
+
+			/**
+			*	\brief \b Remove every element. Keep memory.
+			*/
+			void Clear() noexcept;
+
+
+			Iterator<Slot> begin() noexcept;
+			Iterator<const Slot> begin() const noexcept;
+
+			Iterator<Slot> end() noexcept;
+			Iterator<const Slot> end() const noexcept;
+
+
+			FlatHashTable& operator=(FlatHashTable&& _rhs) noexcept;
+			FlatHashTable& operator=(const FlatHashTable& _rhs);
+		};
+	}
+
+	/// \endcond Internal
+
+
+	/** \} */
+}
+
+#include <Core/Containers/FlatHashTable.inl>
+
+#endif // GUARD
@@ -0,0 +1,502 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <new>
+#include <cstring> // std::memset, std::memcpy
+#include <type_traits>
+
+#include <Core/Algorithms/Move.hpp>
+
+#if SA_MSVC
+	#include <intrin.h>
+#endif
+
+namespace Sa
+{
+	namespace Internal
+	{
+//{ FlatHashGroup
+
+		inline FlatHashGroup::FlatHashGroup(const uint8* _ctrl) noexcept :
+#if SA_FLAT_HASH_SSE2
+			mCtrl{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(_ctrl)) }
+#else
+			mCtrl{ _ctrl }
+#endif
+		{
+		}
+
+		inline uint32 FlatHashGroup::Match(uint8 _h2) const noexcept
+		{
+#if SA_FLAT_HASH_SSE2
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(_h2)), mCtrl)));
+#else
+			uint32 mask = 0u;
+
+			for (uint32 i = 0u; i < Size; ++i)
+				mask |= static_cast<uint32>(mCtrl[i] == _h2) << i;
+
+			return mask;
+#endif
+		}
+
+		inline uint32 FlatHashGroup::MatchEmpty() const noexcept
+		{
+#if SA_FLAT_HASH_SSE2
+			return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(FlatHashCtrl::Empty)), mCtrl)));
+#else
+			return Match(FlatHashCtrl::Empty);
+#endif
+		}
+
+		inline uint32 FlatHashGroup::MatchNonFull() const noexcept
+		{
+#if SA_FLAT_HASH_SSE2
+			// Empty and Deleted have their high bit set.
+			return static_cast<uint32>(_mm_movemask_epi8(mCtrl));
+#else
+			uint32 mask = 0u;
+
+			for (uint32 i = 0u; i < Size; ++i)
+				mask |= static_cast<uint32>(mCtrl[i] >> 7u) << i;
+
+			return mask;
+#endif
+		}
+
+		inline uint32 FlatHashGroup::LowestBit(uint32 _mask) noexcept
+		{
+#if SA_MSVC
+			unsigned long index = 0u;
+			_BitScanForward(&index, _mask);
+			return static_cast<uint32>(index);
+#else
+			return static_cast<uint32>(__builtin_ctz(_mask));
+#endif
+		}
+
+//}
+
+//{ Iterator
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		template <typename SlotT>
+		FlatHashTable<Key, Slot, KeyOf, HashT>::Iterator<SlotT>::Iterator(const uint8* _ctrl, const uint8* _end, SlotT* _slot) noexcept :
+			mCtrl{ _ctrl },
+			mEnd{ _end },
+			mSlot{ _slot }
+		{
+			SkipNonFull();
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		template <typename SlotT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::Iterator<SlotT>::SkipNonFull() noexcept
+		{
+			while (mCtrl != mEnd && !FlatHashCtrl::IsFull(*mCtrl))
+			{
+				++mCtrl;
+				++mSlot;
+			}
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		template <typename SlotT>
+		SlotT& FlatHashTable<Key, Slot, KeyOf, HashT>::Iterator<SlotT>::operator*() const noexcept
+		{
+			return *mSlot;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		template <typename SlotT>
+		SlotT* FlatHashTable<Key, Slot, KeyOf, HashT>::Iterator<SlotT>::operator->() const noexcept
+		{
+			return mSlot;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		template <typename SlotT>
+		typename FlatHashTable<Key, Slot, KeyOf, HashT>::template Iterator<SlotT>&
+			FlatHashTable<Key, Slot, KeyOf, HashT>::Iterator<SlotT>::operator++() noexcept
+		{
+			++mCtrl;
+			++mSlot;
+
+			SkipNonFull();
+
+			return *this;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		template <typename SlotT>
+		bool FlatHashTable<Key, Slot, KeyOf, HashT>::Iterator<SlotT>::operator==(const Iterator& _rhs) const noexcept
+		{
+			return mCtrl == _rhs.mCtrl;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		template <typename SlotT>
+		bool FlatHashTable<Key, Slot, KeyOf, HashT>::Iterator<SlotT>::operator!=(const Iterator& _rhs) const noexcept
+		{
+			return mCtrl != _rhs.mCtrl;
+		}
+
+//}
+
+//{ Constructors
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		FlatHashTable<Key, Slot, KeyOf, HashT>::FlatHashTable(FlatHashTable&& _other) noexcept
+		{
+			MoveFrom(Move(_other));
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		FlatHashTable<Key, Slot, KeyOf, HashT>::FlatHashTable(const FlatHashTable& _other)
+		{
+			CopyFrom(_other);
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		FlatHashTable<Key, Slot, KeyOf, HashT>::~FlatHashTable()
+		{
+			DestroySlots();
+			Deallocate();
+		}
+
+//}
+
+//{ Memory
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		uint64 FlatHashTable<Key, Slot, KeyOf, HashT>::ComputeCapacity(uint64 _size) noexcept
+		{
+			uint64 capacity = FlatHashGroup::Size;
+
+			while (MaxLoad(capacity) < _size)
+				capacity <<= 1u;
+
+			return capacity;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::Allocate(uint64 _capacity)
+		{
+			constexpr uint64 alignment = alignof(Slot) > FlatHashGroup::Size ? alignof(Slot) : FlatHashGroup::Size;
+
+			// Control bytes first, then slots.
+			const uint64 ctrlSize = _capacity + FlatHashGroup::Size;
+			const uint64 slotOffset = (ctrlSize + alignof(Slot) - 1u) & ~uint64(alignof(Slot) - 1u);
+
+			uint8* const data = static_cast<uint8*>(::operator new(slotOffset + _capacity * sizeof(Slot), std::align_val_t{ alignment }));
+
+			mCtrl = data;
+			mSlots = reinterpret_cast<Slot*>(data + slotOffset);
+			mCapacity = _capacity;
+			mGrowthLeft = MaxLoad(_capacity) - mSize;
+
+			std::memset(mCtrl, FlatHashCtrl::Empty, ctrlSize);
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::Deallocate() noexcept
+		{
+			constexpr uint64 alignment = alignof(Slot) > FlatHashGroup::Size ? alignof(Slot) : FlatHashGroup::Size;
+
+			if (mCtrl)
+				::operator delete(mCtrl, std::align_val_t{ alignment });
+
+			mCtrl = nullptr;
+			mSlots = nullptr;
+			mCapacity = 0u;
+			mGrowthLeft = 0u;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::DestroySlots() noexcept
+		{
+			if constexpr (!std::is_trivially_destructible<Slot>::value)
+			{
+				for (uint64 i = 0u; i < mCapacity; ++i)
+				{
+					if (FlatHashCtrl::IsFull(mCtrl[i]))
+						mSlots[i].~Slot();
+				}
+			}
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::CopyFrom(const FlatHashTable& _other)
+		{
+			if (!_other.mCapacity)
+				return;
+
+			Allocate(_other.mCapacity);
+
+			// Same capacity: keep slot positions.
+			std::memcpy(mCtrl, _other.mCtrl, mCapacity + FlatHashGroup::Size);
+
+			for (uint64 i = 0u; i < mCapacity; ++i)
+			{
+				if (FlatHashCtrl::IsFull(mCtrl[i]))
+					new(SlotAddress(i)) Slot(_other.mSlots[i]);
+			}
+
+			mSize = _other.mSize;
+			mGrowthLeft = _other.mGrowthLeft;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::MoveFrom(FlatHashTable&& _other) noexcept
+		{
+			mCtrl = _other.mCtrl;
+			mSlots = _other.mSlots;
+			mCapacity = _other.mCapacity;
+			mSize = _other.mSize;
+			mGrowthLeft = _other.mGrowthLeft;
+
+			_other.mCtrl = nullptr;
+			_other.mSlots = nullptr;
+			_other.mCapacity = 0u;
+			_other.mSize = 0u;
+			_other.mGrowthLeft = 0u;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::Rehash(uint64 _capacity)
+		{
+			constexpr uint64 alignment = alignof(Slot) > FlatHashGroup::Size ? alignof(Slot) : FlatHashGroup::Size;
+
+			uint8* const oldCtrl = mCtrl;
+			Slot* const oldSlots = mSlots;
+			const uint64 oldCapacity = mCapacity;
+
+			Allocate(_capacity);
+
+			for (uint64 i = 0u; i < oldCapacity; ++i)
+			{
+				if (!FlatHashCtrl::IsFull(oldCtrl[i]))
+					continue;
+
+				const uint64 hash = HashT{}(KeyOf{}(oldSlots[i]));
+				const uint64 index = FindNonFull(hash);
+
+				SetCtrl(index, H2(hash));
+
+				new(SlotAddress(index)) Slot(Move(const_cast<std::remove_const_t<Slot>&>(oldSlots[i])));
+				oldSlots[i].~Slot();
+			}
+
+			if (oldCtrl)
+				::operator delete(oldCtrl, std::align_val_t{ alignment });
+		}
+
+//}
+
+//{ Probing
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void* FlatHashTable<Key, Slot, KeyOf, HashT>::SlotAddress(uint64 _index) const noexcept
+		{
+			return const_cast<void*>(static_cast<const void*>(mSlots + _index));
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::SetCtrl(uint64 _index, uint8 _ctrl) noexcept
+		{
+			mCtrl[_index] = _ctrl;
+
+			// Keep the cloned group in sync.
+			if (_index < FlatHashGroup::Size)
+				mCtrl[mCapacity + _index] = _ctrl;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		uint64 FlatHashTable<Key, Slot, KeyOf, HashT>::FindIndex(const Key& _key, uint64 _hash) const noexcept
+		{
+			if (!mCapacity)
+				return 0u;
+
+			const uint64 mask = mCapacity - 1u;
+			const uint8 h2 = H2(_hash);
+
+			uint64 pos = H1(_hash) & mask;
+
+			// Triangular group steps: visit every group once (power of 2 capacity).
+			for (uint64 step = FlatHashGroup::Size; ; step += FlatHashGroup::Size)
+			{
+				const FlatHashGroup group(mCtrl + pos);
+
+				for (uint32 match = group.Match(h2); match; match &= match - 1u)
+				{
+					const uint64 index = (pos + FlatHashGroup::LowestBit(match)) & mask;
+
+					if (KeyOf{}(mSlots[index]) == _key)
+						return index;
+				}
+
+				// Load factor < 1 guarantees an Empty slot.
+				if (group.MatchEmpty())
+					return mCapacity;
+
+				pos = (pos + step) & mask;
+			}
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		uint64 FlatHashTable<Key, Slot, KeyOf, HashT>::FindNonFull(uint64 _hash) const noexcept
+		{
+			const uint64 mask = mCapacity - 1u;
+
+			uint64 pos = H1(_hash) & mask;
+
+			for (uint64 step = FlatHashGroup::Size; ; step += FlatHashGroup::Size)
+			{
+				const uint32 match = FlatHashGroup(mCtrl + pos).MatchNonFull();
+
+				if (match)
+					return (pos + FlatHashGroup::LowestBit(match)) & mask;
+
+				pos = (pos + step) & mask;
+			}
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		std::pair<uint64, bool> FlatHashTable<Key, Slot, KeyOf, HashT>::FindOrPrepareInsert(const Key& _key)
+		{
+			const uint64 hash = HashT{}(_key);
+
+			uint64 index = FindIndex(_key, hash);
+
+			if (index != mCapacity)
+				return { index, false };
+
+			if (!mGrowthLeft)
+			{
+				// Mostly tombstones: clean up in place, otherwise grow.
+				if (mCapacity && mSize <= MaxLoad(mCapacity) / 2u)
+					Rehash(mCapacity);
+				else
+					Rehash(mCapacity ? mCapacity * 2u : FlatHashGroup::Size);
+			}
+
+			index = FindNonFull(hash);
+
+			if (mCtrl[index] == FlatHashCtrl::Empty)
+				--mGrowthLeft;
+
+			SetCtrl(index, H2(hash));
+			++mSize;
+
+			return { index, true };
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::EraseIndex(uint64 _index) noexcept
+		{
+			mSlots[_index].~Slot();
+
+			SetCtrl(_index, FlatHashCtrl::Deleted);
+			--mSize;
+		}
+
+//}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		uint64 FlatHashTable<Key, Slot, KeyOf, HashT>::Size() const noexcept
+		{
+			return mSize;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		bool FlatHashTable<Key, Slot, KeyOf, HashT>::IsEmpty() const noexcept
+		{
+			return mSize == 0u;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		uint64 FlatHashTable<Key, Slot, KeyOf, HashT>::GetCapacity() const noexcept
+		{
+			return mCapacity;
+		}
+
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::Reserve(uint64 _size)
+		{
+			const uint64 capacity = ComputeCapacity(_size);
+
+			if (capacity > mCapacity)
+				Rehash(capacity);
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		void FlatHashTable<Key, Slot, KeyOf, HashT>::Clear() noexcept
+		{
+			if (!mCapacity)
+				return;
+
+			DestroySlots();
+
+			std::memset(mCtrl, FlatHashCtrl::Empty, mCapacity + FlatHashGroup::Size);
+
+			mSize = 0u;
+			mGrowthLeft = MaxLoad(mCapacity);
+		}
+
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		typename FlatHashTable<Key, Slot, KeyOf, HashT>::template Iterator<Slot> FlatHashTable<Key, Slot, KeyOf, HashT>::begin() noexcept
+		{
+			return Iterator<Slot>(mCtrl, mCtrl + mCapacity, mSlots);
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		typename FlatHashTable<Key, Slot, KeyOf, HashT>::template Iterator<const Slot> FlatHashTable<Key, Slot, KeyOf, HashT>::begin() const noexcept
+		{
+			return Iterator<const Slot>(mCtrl, mCtrl + mCapacity, mSlots);
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		typename FlatHashTable<Key, Slot, KeyOf, HashT>::template Iterator<Slot> FlatHashTable<Key, Slot, KeyOf, HashT>::end() noexcept
+		{
+			return Iterator<Slot>(mCtrl + mCapacity, mCtrl + mCapacity, mSlots + mCapacity);
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		typename FlatHashTable<Key, Slot, KeyOf, HashT>::template Iterator<const Slot> FlatHashTable<Key, Slot, KeyOf, HashT>::end() const noexcept
+		{
+			return Iterator<const Slot>(mCtrl + mCapacity, mCtrl + mCapacity, mSlots + mCapacity);
+		}
+
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		FlatHashTable<Key, Slot, KeyOf, HashT>& FlatHashTable<Key, Slot, KeyOf, HashT>::operator=(FlatHashTable&& _rhs) noexcept
+		{
+			if (this != &_rhs)
+			{
+				DestroySlots();
+				Deallocate();
+
+				MoveFrom(Move(_rhs));
+			}
+
+			return *this;
+		}
+
+		template <typename Key, typename Slot, typename KeyOf, typename HashT>
+		FlatHashTable<Key, Slot, KeyOf, HashT>& FlatHashTable<Key, Slot, KeyOf, HashT>::operator=(const FlatHashTable& _rhs)
+		{
+			if (this != &_rhs)
+			{
+				DestroySlots();
+				Deallocate();
+
+				mSize = 0u;
+
+				CopyFrom(_rhs);
+			}
+
+			return *this;
+		}
+	}
+}
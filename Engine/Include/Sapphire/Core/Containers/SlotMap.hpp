@@ -0,0 +1,282 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_SLOT_MAP_GUARD
+#define SAPPHIRE_CORE_SLOT_MAP_GUARD
+
+#include <vector>
+
+#include <Collections/Debug>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Algorithms/Move.hpp>
+#include <Core/Algorithms/Forward.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file SlotMap.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>generational slot map</b> type.
+	*
+	*	\ingroup Containers
+	*	\{
+	*/
+
+
+	/**
+	*	\brief 32-bit <b>generational handle</b> of a SlotMap element.
+	*
+	*	Low bits: slot index. High bits: slot generation, incremented on each removal:
+	*	a handle to a removed element never aliases a new one (until generation wraps).
+	*/
+	struct SlotHandle
+	{
+		/// Number of bits of the slot index.
+		static constexpr uint32 IndexBits = 20u;
+
+		/// Mask of the slot index.
+		static constexpr uint32 IndexMask = (1u << IndexBits) - 1u;
+
+		/// Mask of the generation (after shift).
+		static constexpr uint32 GenerationMask = (1u << (32u - IndexBits)) - 1u;
+
+		/// Invalid handle value.
+		static constexpr uint32 InvalidValue = ~uint32();
+
+
+		/// Packed index and generation.
+		uint32 value = InvalidValue;
+
+
+		/**
+		*	\brief \e Getter of the slot index.
+		*
+		*	\return slot index.
+		*/
+		constexpr uint32 GetIndex() const noexcept { return value & IndexMask; }
+
+		/**
+		*	\brief \e Getter of the slot generation.
+		*
+		*	\return slot generation.
+		*/
+		constexpr uint32 GetGeneration() const noexcept { return value >> IndexBits; }
+
+		/**
+		*	\brief Whether the handle has been set (may still be stale: use SlotMap::IsValid()).
+		*
+		*	\return true if not InvalidValue.
+		*/
+		constexpr bool IsSet() const noexcept { return value != InvalidValue; }
+
+
+		/**
+		*	\brief Create a handle from index and generation.
+		*
+		*	\param[in] _index		Slot index.
+		*	\param[in] _generation	Slot generation.
+		*
+		*	\return packed handle.
+		*/
+		static constexpr SlotHandle Make(uint32 _index, uint32 _generation) noexcept
+		{
+			return SlotHandle{ ((_generation & GenerationMask) << IndexBits) | (_index & IndexMask) };
+		}
+
+
+		constexpr bool operator==(SlotHandle _rhs) const noexcept { return value == _rhs.value; }
+		constexpr bool operator!=(SlotHandle _rhs) const noexcept { return value != _rhs.value; }
+	};
+
+
+	/**
+	*	\brief <b>Generational slot map</b>: dense storage accessed by stable handles.
+	*
+	*	Elements are packed in a contiguous array (cache-friendly iteration).
+	*	Removal swaps with the last element: O(1), but element addresses are not stable,
+	*	keep SlotHandle instead of pointers. Handle validity check is O(1).
+	*
+	*	\tparam T	Type of element. Must be move constructible and move assignable.
+	*/
+	template <typename T>
+	class SlotMap
+	{
+		/// \cond Internal
+
+		/// Indirection slot.
+		struct Slot
+		{
+			/// Index in mData when used, next free slot when free.
+			uint32 index = 0u;
+
+			/// Current generation of the slot.
+			uint32 generation = 0u;
+		};
+
+		/// \endcond Internal
+
+		/// No free slot.
+		static constexpr uint32 sNoFree = ~uint32();
+
+		/// Dense elements.
+		std::vector<T> mData;
+
+		/// Slot index of each dense element.
+		std::vector<uint32> mDataToSlot;
+
+		/// Indirection slots.
+		std::vector<Slot> mSlots;
+
+		/// First free slot.
+		uint32 mFreeHead = sNoFree;
+
+	public:
+		/// Max number of elements.
+		static constexpr uint32 MaxSize = SlotHandle::IndexMask;
+
+		/**
+		*	\brief \e Getter of the number of elements.
+		*
+		*	\return element number.
+		*/
+		uint32 Size() const noexcept;
+
+		/**
+		*	\brief Whether the map is empty.
+		*
+		*	\return true if no element.
+		*/
+		bool IsEmpty() const noexcept;
+
+		/**
+		*	\brief Whether a handle refers to a live element.
+		*
+		*	\param[in] _handle	Handle to check.
+		*
+		*	\return true if valid.
+		*/
+		bool IsValid(SlotHandle _handle) const noexcept;
+
+
+		/**
+		*	\brief \b Reserve memory for _capacity elements.
+		*
+		*	\param[in] _capacity	Number of elements.
+		*/
+		void Reserve(uint32 _capacity);
+
+
+		/**
+		*	\brief \b Construct an element in place.
+		*
+		*	\tparam Args		Constructor argument types.
+		*	\param[in] _args	Constructor arguments.
+		*
+		*	\return handle of the new element.
+		*/
+		template <typename... Args>
+		SlotHandle Emplace(Args&&... _args);
+
+		/**
+		*	\brief \b Insert an element.
+		*
+		*	\param[in] _elem	Element to insert.
+		*
+		*	\return handle of the new element.
+		*/
+		SlotHandle Insert(T _elem);
+
+		/**
+		*	\brief \b Remove an element.
+		*
+		*	\param[in] _handle	Handle of the element.
+		*
+		*	\return false if the handle was not valid.
+		*/
+		bool Remove(SlotHandle _handle);
+
+		/**
+		*	\brief \b Remove every element. Invalidate every handle.
+		*/
+		void Clear();
+
+
+		/**
+		*	\brief \e Getter of an element.
+		*
+		*	\param[in] _handle	Handle of the element.
+		*
+		*	\return element, nullptr if the handle is not valid.
+		*/
+		T* Get(SlotHandle _handle) noexcept;
+
+		/**
+		*	\brief \e Const getter of an element.
+		*
+		*	\param[in] _handle	Handle of the element.
+		*
+		*	\return element, nullptr if the handle is not valid.
+		*/
+		const T* Get(SlotHandle _handle) const noexcept;
+
+		/**
+		*	\brief \e Getter of the handle of a dense element.
+		*
+		*	\param[in] _denseIndex	Index in [0, Size()[.
+		*
+		*	\return handle of the element.
+		*/
+		SlotHandle GetHandle(uint32 _denseIndex) const;
+
+
+		/**
+		*	\brief \e Getter of the dense element array.
+		*
+		*	\return element array (Size() elements).
+		*/
+		T* Data() noexcept;
+
+		/**
+		*	\brief \e Const getter of the dense element array.
+		*
+		*	\return element array (Size() elements).
+		*/
+		const T* Data() const noexcept;
+
+
+		T* begin() noexcept;
+		const T* begin() const noexcept;
+
+		T* end() noexcept;
+		const T* end() const noexcept;
+
+
+		/**
+		*	\brief \e Access operator by handle (asserted valid).
+		*
+		*	\param[in] _handle	Handle of the element.
+		*
+		*	\return element.
+		*/
+		T& operator[](SlotHandle _handle);
+
+		/**
+		*	\brief \e Const access operator by handle (asserted valid).
+		*
+		*	\param[in] _handle	Handle of the element.
+		*
+		*	\return element.
+		*/
+		const T& operator[](SlotHandle _handle) const;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Containers/SlotMap.inl>
+
+#endif // GUARD
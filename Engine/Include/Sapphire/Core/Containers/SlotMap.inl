@@ -0,0 +1,191 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	template <typename T>
+	uint32 SlotMap<T>::Size() const noexcept
+	{
+		return static_cast<uint32>(mData.size());
+	}
+
+	template <typename T>
+	bool SlotMap<T>::IsEmpty() const noexcept
+	{
+		return mData.empty();
+	}
+
+	template <typename T>
+	bool SlotMap<T>::IsValid(SlotHandle _handle) const noexcept
+	{
+		const uint32 index = _handle.GetIndex();
+
+		return _handle.IsSet() && index < mSlots.size() && mSlots[index].generation == _handle.GetGeneration();
+	}
+
+
+	template <typename T>
+	void SlotMap<T>::Reserve(uint32 _capacity)
+	{
+		mData.reserve(_capacity);
+		mDataToSlot.reserve(_capacity);
+		mSlots.reserve(_capacity);
+	}
+
+
+	template <typename T>
+	template <typename... Args>
+	SlotHandle SlotMap<T>::Emplace(Args&&... _args)
+	{
+		uint32 slotIndex = mFreeHead;
+
+		if (slotIndex != sNoFree)
+			mFreeHead = mSlots[slotIndex].index;
+		else
+		{
+			SA_ASSERT(mSlots.size() < MaxSize, OutOfRange, Tools, static_cast<uint32>(mSlots.size()), 0u, MaxSize - 1u);
+
+			slotIndex = static_cast<uint32>(mSlots.size());
+			mSlots.emplace_back();
+		}
+
+		Slot& slot = mSlots[slotIndex];
+		slot.index = static_cast<uint32>(mData.size());
+
+		mData.emplace_back(Forward<Args>(_args)...);
+		mDataToSlot.push_back(slotIndex);
+
+		return SlotHandle::Make(slotIndex, slot.generation);
+	}
+
+	template <typename T>
+	SlotHandle SlotMap<T>::Insert(T _elem)
+	{
+		return Emplace(Move(_elem));
+	}
+
+	template <typename T>
+	bool SlotMap<T>::Remove(SlotHandle _handle)
+	{
+		if (!IsValid(_handle))
+			return false;
+
+		const uint32 slotIndex = _handle.GetIndex();
+		Slot& slot = mSlots[slotIndex];
+
+		const uint32 denseIndex = slot.index;
+		const uint32 lastIndex = static_cast<uint32>(mData.size()) - 1u;
+
+		// Fill the hole with the last element.
+		if (denseIndex != lastIndex)
+		{
+			mData[denseIndex] = Move(mData[lastIndex]);
+			mDataToSlot[denseIndex] = mDataToSlot[lastIndex];
+			mSlots[mDataToSlot[denseIndex]].index = denseIndex;
+		}
+
+		mData.pop_back();
+		mDataToSlot.pop_back();
+
+		// Invalidate handles and push to free-list.
+		slot.generation = (slot.generation + 1u) & SlotHandle::GenerationMask;
+		slot.index = mFreeHead;
+		mFreeHead = slotIndex;
+
+		return true;
+	}
+
+	template <typename T>
+	void SlotMap<T>::Clear()
+	{
+		for (uint32 denseIndex = 0u; denseIndex < mDataToSlot.size(); ++denseIndex)
+		{
+			const uint32 slotIndex = mDataToSlot[denseIndex];
+			Slot& slot = mSlots[slotIndex];
+
+			slot.generation = (slot.generation + 1u) & SlotHandle::GenerationMask;
+			slot.index = mFreeHead;
+			mFreeHead = slotIndex;
+		}
+
+		mData.clear();
+		mDataToSlot.clear();
+	}
+
+
+	template <typename T>
+	T* SlotMap<T>::Get(SlotHandle _handle) noexcept
+	{
+		return IsValid(_handle) ? &mData[mSlots[_handle.GetIndex()].index] : nullptr;
+	}
+
+	template <typename T>
+	const T* SlotMap<T>::Get(SlotHandle _handle) const noexcept
+	{
+		return IsValid(_handle) ? &mData[mSlots[_handle.GetIndex()].index] : nullptr;
+	}
+
+	template <typename T>
+	SlotHandle SlotMap<T>::GetHandle(uint32 _denseIndex) const
+	{
+		SA_ASSERT(_denseIndex < mData.size(), OutOfRange, Tools, _denseIndex, 0u, Size());
+
+		const uint32 slotIndex = mDataToSlot[_denseIndex];
+
+		return SlotHandle::Make(slotIndex, mSlots[slotIndex].generation);
+	}
+
+
+	template <typename T>
+	T* SlotMap<T>::Data() noexcept
+	{
+		return mData.data();
+	}
+
+	template <typename T>
+	const T* SlotMap<T>::Data() const noexcept
+	{
+		return mData.data();
+	}
+
+
+	template <typename T>
+	T* SlotMap<T>::begin() noexcept
+	{
+		return mData.data();
+	}
+
+	template <typename T>
+	const T* SlotMap<T>::begin() const noexcept
+	{
+		return mData.data();
+	}
+
+	template <typename T>
+	T* SlotMap<T>::end() noexcept
+	{
+		return mData.data() + mData.size();
+	}
+
+	template <typename T>
+	const T* SlotMap<T>::end() const noexcept
+	{
+		return mData.data() + mData.size();
+	}
+
+
+	template <typename T>
+	T& SlotMap<T>::operator[](SlotHandle _handle)
+	{
+		SA_ASSERT(IsValid(_handle), InvalidParam, Tools, L"Invalid SlotMap handle!");
+
+		return mData[mSlots[_handle.GetIndex()].index];
+	}
+
+	template <typename T>
+	const T& SlotMap<T>::operator[](SlotHandle _handle) const
+	{
+		SA_ASSERT(IsValid(_handle), InvalidParam, Tools, L"Invalid SlotMap handle!");
+
+		return mData[mSlots[_handle.GetIndex()].index];
+	}
+}
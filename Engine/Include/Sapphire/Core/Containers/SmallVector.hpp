@@ -0,0 +1,282 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_SMALL_VECTOR_GUARD
+#define SAPPHIRE_CORE_SMALL_VECTOR_GUARD
+
+#include <memory> // std::allocator
+#include <initializer_list>
+
+#include <Collections/Debug>
+
+#include <Core/Types/Int.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file SmallVector.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>small vector</b> type.
+	*
+	*	\ingroup Containers
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Vector with <b>inline storage</b> for N elements.
+	*
+	*	No allocation until more than N elements are stored, then spill to AllocT memory.
+	*	Use for small lists built on hot paths (Vulkan create infos, extension lists...).
+	*
+	*	\tparam T		Type of element.
+	*	\tparam N		Inline capacity.
+	*	\tparam AllocT	STL-compatible allocator used on spill (ex: ArenaAllocator).
+	*/
+	template <typename T, uint32 N, typename AllocT = std::allocator<T>>
+	class SmallVector
+	{
+		static_assert(N > 0u, "SmallVector inline capacity must not be 0!");
+
+		/// Current storage (inline or heap).
+		T* mData = reinterpret_cast<T*>(mInline);
+
+		/// Element number.
+		uint32 mSize = 0u;
+
+		/// Current storage capacity.
+		uint32 mCapacity = N;
+
+		/// Spill allocator.
+		AllocT mAlloc;
+
+		/// Inline storage.
+		alignas(T) uint8 mInline[N * sizeof(T)];
+
+
+		/// Move elements to a new storage of _capacity.
+		void Grow(uint32 _capacity);
+
+		/// Release heap storage (elements must be destroyed).
+		void FreeStorage() noexcept;
+
+	public:
+		/// STL value type.
+		using value_type = T;
+
+		/// Inline capacity.
+		static constexpr uint32 InlineCapacity = N;
+
+		/**
+		*	\brief \e Default constructor.
+		*/
+		SmallVector() = default;
+
+		/**
+		*	\brief \e Value constructor.
+		*
+		*	\param[in] _alloc	Spill allocator.
+		*/
+		explicit SmallVector(const AllocT& _alloc) noexcept;
+
+		/**
+		*	\brief \e Value constructor: _size copies of _value.
+		*
+		*	\param[in] _size	Element number.
+		*	\param[in] _value	Element value.
+		*	\param[in] _alloc	Spill allocator.
+		*/
+		SmallVector(uint32 _size, const T& _value = T(), const AllocT& _alloc = AllocT());
+
+		/**
+		*	\brief \e Value constructor from an initializer list.
+		*
+		*	\param[in] _list	Elements.
+		*	\param[in] _alloc	Spill allocator.
+		*/
+		SmallVector(std::initializer_list<T> _list, const AllocT& _alloc = AllocT());
+
+		/**
+		*	\brief \e Move constructor. Steal heap storage, move inline elements.
+		*
+		*	\param[in] _other	Other vector to move.
+		*/
+		SmallVector(SmallVector&& _other);
+
+		/**
+		*	\brief \e Copy constructor.
+		*
+		*	\param[in] _other	Other vector to copy.
+		*/
+		SmallVector(const SmallVector& _other);
+
+		/**
+		*	\brief \e Destructor.
+		*/
+		~SmallVector();
+
+
+		/**
+		*	\brief \e Getter of the number of elements.
+		*
+		*	\return element number.
+		*/
+		uint32 Size() const noexcept;
+
+		/**
+		*	\brief \e Getter of the storage capacity.
+		*
+		*	\return capacity.
+		*/
+		uint32 GetCapacity() const noexcept;
+
+		/**
+		*	\brief Whether the vector is empty.
+		*
+		*	\return true if no element.
+		*/
+		bool IsEmpty() const noexcept;
+
+		/**
+		*	\brief Whether elements are stored inline (no heap allocation).
+		*
+		*	\return true if inline.
+		*/
+		bool IsInline() const noexcept;
+
+
+		/**
+		*	\brief \b Reserve storage for _capacity elements.
+		*
+		*	\param[in] _capacity	Number of elements.
+		*/
+		void Reserve(uint32 _capacity);
+
+		/**
+		*	\brief \b Resize: default construct or destroy elements.
+		*
+		*	\param[in] _size	New element number.
+		*/
+		void Resize(uint32 _size);
+
+		/**
+		*	\brief \b Resize: copy construct _value or destroy elements.
+		*
+		*	\param[in] _size	New element number.
+		*	\param[in] _value	Value of new elements.
+		*/
+		void Resize(uint32 _size, const T& _value);
+
+		/**
+		*	\brief \b Destroy every element. Keep storage.
+		*/
+		void Clear() noexcept;
+
+
+		/**
+		*	\brief \b Construct an element in place at the end.
+		*
+		*	\param[in] _args	Constructor arguments.
+		*
+		*	\return new element.
+		*/
+		template <typename... Args>
+		T& EmplaceBack(Args&&... _args);
+
+		/**
+		*	\brief \b Copy an element at the end.
+		*
+		*	\param[in] _elem	Element to copy.
+		*/
+		void PushBack(const T& _elem);
+
+		/**
+		*	\brief \b Move an element at the end.
+		*
+		*	\param[in] _elem	Element to move.
+		*/
+		void PushBack(T&& _elem);
+
+		/**
+		*	\brief \b Copy _num elements at the end.
+		*
+		*	\param[in] _elems	Elements to copy (may be elements of this vector).
+		*	\param[in] _num		Element number.
+		*/
+		void Append(const T* _elems, uint32 _num);
+
+		/**
+		*	\brief \b Destroy the last element.
+		*/
+		void PopBack();
+
+		/**
+		*	\brief \b Erase an element: following elements are shifted.
+		*
+		*	\param[in] _index	Index of the element.
+		*/
+		void Erase(uint32 _index);
+
+
+		T* Data() noexcept;
+		const T* Data() const noexcept;
+
+		T& Front();
+		const T& Front() const;
+
+		T& Back();
+		const T& Back() const;
+
+		T* begin() noexcept;
+		const T* begin() const noexcept;
+
+		T* end() noexcept;
+		const T* end() const noexcept;
+
+
+		/**
+		*	\brief \e Move operator=.
+		*
+		*	\param[in] _rhs		Other vector to move.
+		*
+		*	\return this instance.
+		*/
+		SmallVector& operator=(SmallVector&& _rhs);
+
+		/**
+		*	\brief \e Copy operator=.
+		*
+		*	\param[in] _rhs		Other vector to copy.
+		*
+		*	\return this instance.
+		*/
+		SmallVector& operator=(const SmallVector& _rhs);
+
+
+		/**
+		*	\brief \e Access operator by index (asserted in range).
+		*
+		*	\param[in] _index	Index of the element.
+		*
+		*	\return element.
+		*/
+		T& operator[](uint32 _index);
+
+		/**
+		*	\brief \e Const access operator by index (asserted in range).
+		*
+		*	\param[in] _index	Index of the element.
+		*
+		*	\return element.
+		*/
+		const T& operator[](uint32 _index) const;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Containers/SmallVector.inl>
+
+#endif // GUARD
@@ -0,0 +1,374 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <new>
+
+#include <Core/Algorithms/Move.hpp>
+#include <Core/Algorithms/Forward.hpp>
+
+namespace Sa
+{
+//{ Constructors
+
+	template <typename T, uint32 N, typename AllocT>
+	SmallVector<T, N, AllocT>::SmallVector(const AllocT& _alloc) noexcept : mAlloc{ _alloc }
+	{
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	SmallVector<T, N, AllocT>::SmallVector(uint32 _size, const T& _value, const AllocT& _alloc) : mAlloc{ _alloc }
+	{
+		Resize(_size, _value);
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	SmallVector<T, N, AllocT>::SmallVector(std::initializer_list<T> _list, const AllocT& _alloc) : mAlloc{ _alloc }
+	{
+		Append(_list.begin(), static_cast<uint32>(_list.size()));
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	SmallVector<T, N, AllocT>::SmallVector(SmallVector&& _other) : mAlloc{ _other.mAlloc }
+	{
+		if (_other.IsInline())
+		{
+			for (uint32 i = 0u; i < _other.mSize; ++i)
+			{
+				new(mData + i) T(Move(_other.mData[i]));
+				_other.mData[i].~T();
+			}
+
+			mSize = _other.mSize;
+		}
+		else
+		{
+			// Steal heap storage (allocator copied).
+			mData = _other.mData;
+			mSize = _other.mSize;
+			mCapacity = _other.mCapacity;
+
+			_other.mData = reinterpret_cast<T*>(_other.mInline);
+			_other.mCapacity = N;
+		}
+
+		_other.mSize = 0u;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	SmallVector<T, N, AllocT>::SmallVector(const SmallVector& _other) : mAlloc{ _other.mAlloc }
+	{
+		Append(_other.mData, _other.mSize);
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	SmallVector<T, N, AllocT>::~SmallVector()
+	{
+		Clear();
+		FreeStorage();
+	}
+
+//}
+
+//{ Storage
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::Grow(uint32 _capacity)
+	{
+		T* const data = std::allocator_traits<AllocT>::allocate(mAlloc, _capacity);
+
+		for (uint32 i = 0u; i < mSize; ++i)
+		{
+			new(data + i) T(Move(mData[i]));
+			mData[i].~T();
+		}
+
+		FreeStorage();
+
+		mData = data;
+		mCapacity = _capacity;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::FreeStorage() noexcept
+	{
+		if (!IsInline())
+			std::allocator_traits<AllocT>::deallocate(mAlloc, mData, mCapacity);
+
+		mData = reinterpret_cast<T*>(mInline);
+		mCapacity = N;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	uint32 SmallVector<T, N, AllocT>::Size() const noexcept
+	{
+		return mSize;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	uint32 SmallVector<T, N, AllocT>::GetCapacity() const noexcept
+	{
+		return mCapacity;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	bool SmallVector<T, N, AllocT>::IsEmpty() const noexcept
+	{
+		return mSize == 0u;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	bool SmallVector<T, N, AllocT>::IsInline() const noexcept
+	{
+		return mData == reinterpret_cast<const T*>(mInline);
+	}
+
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::Reserve(uint32 _capacity)
+	{
+		if (_capacity > mCapacity)
+			Grow(_capacity);
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::Resize(uint32 _size)
+	{
+		Reserve(_size);
+
+		for (uint32 i = mSize; i < _size; ++i)
+			new(mData + i) T();
+
+		for (uint32 i = _size; i < mSize; ++i)
+			mData[i].~T();
+
+		mSize = _size;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::Resize(uint32 _size, const T& _value)
+	{
+		Reserve(_size);
+
+		for (uint32 i = mSize; i < _size; ++i)
+			new(mData + i) T(_value);
+
+		for (uint32 i = _size; i < mSize; ++i)
+			mData[i].~T();
+
+		mSize = _size;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::Clear() noexcept
+	{
+		for (uint32 i = 0u; i < mSize; ++i)
+			mData[i].~T();
+
+		mSize = 0u;
+	}
+
+//}
+
+//{ Elements
+
+	template <typename T, uint32 N, typename AllocT>
+	template <typename... Args>
+	T& SmallVector<T, N, AllocT>::EmplaceBack(Args&&... _args)
+	{
+		if (mSize == mCapacity)
+		{
+			// Construct first: _args may reference an element of this vector.
+			T elem(Forward<Args>(_args)...);
+
+			Grow(mCapacity * 2u);
+
+			return *new(mData + mSize++) T(Move(elem));
+		}
+
+		return *new(mData + mSize++) T(Forward<Args>(_args)...);
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::PushBack(const T& _elem)
+	{
+		EmplaceBack(_elem);
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::PushBack(T&& _elem)
+	{
+		EmplaceBack(Move(_elem));
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::Append(const T* _elems, uint32 _num)
+	{
+		if (mSize + _num > mCapacity)
+		{
+			// _elems may be elements of this vector: follow them to the new storage.
+			const bool bAlias = _elems >= mData && _elems < mData + mSize;
+			const uint32 offset = bAlias ? static_cast<uint32>(_elems - mData) : 0u;
+
+			Grow(mSize + _num > mCapacity * 2u ? mSize + _num : mCapacity * 2u);
+
+			if (bAlias)
+				_elems = mData + offset;
+		}
+
+		for (uint32 i = 0u; i < _num; ++i)
+			new(mData + mSize + i) T(_elems[i]);
+
+		mSize += _num;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::PopBack()
+	{
+		SA_ASSERT(mSize, InvalidParam, Tools, L"PopBack on empty vector!");
+
+		mData[--mSize].~T();
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	void SmallVector<T, N, AllocT>::Erase(uint32 _index)
+	{
+		SA_ASSERT(_index < mSize, OutOfRange, Tools, _index, 0u, mSize - 1u);
+
+		for (uint32 i = _index + 1u; i < mSize; ++i)
+			mData[i - 1u] = Move(mData[i]);
+
+		mData[--mSize].~T();
+	}
+
+
+	template <typename T, uint32 N, typename AllocT>
+	T* SmallVector<T, N, AllocT>::Data() noexcept
+	{
+		return mData;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	const T* SmallVector<T, N, AllocT>::Data() const noexcept
+	{
+		return mData;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	T& SmallVector<T, N, AllocT>::Front()
+	{
+		return (*this)[0u];
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	const T& SmallVector<T, N, AllocT>::Front() const
+	{
+		return (*this)[0u];
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	T& SmallVector<T, N, AllocT>::Back()
+	{
+		return (*this)[mSize - 1u];
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	const T& SmallVector<T, N, AllocT>::Back() const
+	{
+		return (*this)[mSize - 1u];
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	T* SmallVector<T, N, AllocT>::begin() noexcept
+	{
+		return mData;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	const T* SmallVector<T, N, AllocT>::begin() const noexcept
+	{
+		return mData;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	T* SmallVector<T, N, AllocT>::end() noexcept
+	{
+		return mData + mSize;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	const T* SmallVector<T, N, AllocT>::end() const noexcept
+	{
+		return mData + mSize;
+	}
+
+//}
+
+//{ Operators
+
+	template <typename T, uint32 N, typename AllocT>
+	SmallVector<T, N, AllocT>& SmallVector<T, N, AllocT>::operator=(SmallVector&& _rhs)
+	{
+		if (this == &_rhs)
+			return *this;
+
+		Clear();
+		FreeStorage();
+
+		if (_rhs.IsInline())
+		{
+			for (uint32 i = 0u; i < _rhs.mSize; ++i)
+			{
+				new(mData + i) T(Move(_rhs.mData[i]));
+				_rhs.mData[i].~T();
+			}
+
+			mSize = _rhs.mSize;
+		}
+		else
+		{
+			// Steal heap storage with its allocator.
+			mAlloc = _rhs.mAlloc;
+
+			mData = _rhs.mData;
+			mSize = _rhs.mSize;
+			mCapacity = _rhs.mCapacity;
+
+			_rhs.mData = reinterpret_cast<T*>(_rhs.mInline);
+			_rhs.mCapacity = N;
+		}
+
+		_rhs.mSize = 0u;
+
+		return *this;
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	SmallVector<T, N, AllocT>& SmallVector<T, N, AllocT>::operator=(const SmallVector& _rhs)
+	{
+		if (this == &_rhs)
+			return *this;
+
+		Clear();
+		Append(_rhs.mData, _rhs.mSize);
+
+		return *this;
+	}
+
+
+	template <typename T, uint32 N, typename AllocT>
+	T& SmallVector<T, N, AllocT>::operator[](uint32 _index)
+	{
+		SA_ASSERT(_index < mSize, OutOfRange, Tools, _index, 0u, mSize - 1u);
+
+		return mData[_index];
+	}
+
+	template <typename T, uint32 N, typename AllocT>
+	const T& SmallVector<T, N, AllocT>::operator[](uint32 _index) const
+	{
+		SA_ASSERT(_index < mSize, OutOfRange, Tools, _index, 0u, mSize - 1u);
+
+		return mData[_index];
+	}
+
+//}
+}
@@ -0,0 +1,78 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_CRASH_HANDLER_GUARD
+#define SAPPHIRE_CORE_CRASH_HANDLER_GUARD
+
+#include <Core/Config.hpp>
+
+#include <Core/Types/Int.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file CrashHandler.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>crash handler</b>.
+	*
+	*	\ingroup Debug
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Crash hook stages, called in this order on fatal signal.
+	*/
+	enum class CrashStage : uint8
+	{
+		/// Signal-safe dump (ex: FlightRecorder::Dump()).
+		Dump,
+
+		/// Best-effort output of pending data (ex: Logger::CrashFlush()).
+		Flush,
+
+		/// Number of stages.
+		Count,
+	};
+
+
+	/**
+	*	\brief Static fatal signal handler shared by the engine's crash outputs.
+	*
+	*	A single handler per signal calls every set hook in CrashStage order,
+	*	then restores the previously installed handler and raises the signal again.
+	*
+	*	Handled signals: SIGSEGV, SIGILL, SIGFPE, SIGABRT (and SIGBUS on Unix).
+	*/
+	class CrashHandler
+	{
+	public:
+		/**
+		*	\brief Crash hook: must be async-signal-safe.
+		*
+		*	\param[in] _reason	Crash reason (ex: "Fatal signal SIGSEGV").
+		*/
+		using Hook = void (*)(const char* _reason);
+
+		/**
+		*	\brief \e Setter of the hook of a stage, Install() handlers.
+		*
+		*	\param[in] _stage	Stage of the hook.
+		*	\param[in] _hook	Hook to call (nullptr to remove).
+		*/
+		SA_ENGINE_API static void SetHook(CrashStage _stage, Hook _hook) noexcept;
+
+		/**
+		*	\brief Install the fatal signal handlers (once).
+		*
+		*	Previously installed handlers are chained.
+		*/
+		SA_ENGINE_API static void Install() noexcept;
+	};
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -5,12 +5,14 @@
 #ifndef SAPPHIRE_CORE_DEBUG_GUARD
 #define SAPPHIRE_CORE_DEBUG_GUARD
 
-#include <vector>
-
 #include <Core/Config.hpp>
 
+#include <Core/Support/Compilers.hpp>
+
 #include <Collections/Exceptions>
 
+#include <Core/Debug/FlightRecorder.hpp>
+
 namespace Sa
 {
 	/**
@@ -33,9 +35,6 @@ namespace Sa
 	{
 #if SA_LOGGING || SA_ASSERTION
 
-		/// Registered channels for logging.
-		SA_ENGINE_API static std::vector<LogChannel> channels;
-
 		/**
 		*	\brief Log internal implementation.
 		*
@@ -43,6 +42,13 @@ namespace Sa
 		*/
 		SA_ENGINE_API static void Log_Internal(const Sa::Log& _log) noexcept;
 
+		/**
+		*	\brief Log immediate output implementation: pending logs are flushed first.
+		*
+		*	\param[in] _log		Log to output.
+		*/
+		SA_ENGINE_API static void LogImmediate_Internal(const Sa::Log& _log) noexcept;
+
 	public:
 
 		/// Allow logging for enabled levels.
@@ -57,19 +63,34 @@ namespace Sa
 		*/
 		SA_ENGINE_API static const wchar* GetFileNameFromPath(const wchar* _filePath) noexcept;
 
+		/**
+		*	\brief \e Get LogChannel by ID.
+		*
+		*	Constant-time lookup (used by SA_LOG and SA_ASSERT with a compile-time ID).
+		*	Unknown channel is registered if _name is provided, Default channel is returned otherwise.
+		*
+		*	\param[in] _id		ID of the LogChannel.
+		*	\param[in] _name	Name of the LogChannel (static storage).
+		*
+		*	\return LogChannel with ID _id.
+		*/
+		SA_ENGINE_API static LogChannel& GetChannel(StringId _id, const wchar* _name = nullptr) noexcept;
+
 		/**
 		*	\brief \e Get LogChannel by name.
 		*
-		*	\param[in] _name	Name of the LogChannel.
+		*	\param[in] _name	Name of the LogChannel (static storage).
 		*
-		*	\return First LogChannel with name _name.
+		*	\return LogChannel with name _name.
 		*/
-		SA_ENGINE_API static LogChannel& GetChannel(const wchar* _name);
+		SA_ENGINE_API static LogChannel& GetChannel(const wchar* _name) noexcept;
 
 		/**
 		*	\brief Register a log channel into channels.
 		*
-		*	\param[in] _chan	Channel to register.
+		*	Return the already registered channel with the same name, if any.
+		*
+		*	\param[in] _chan	Channel to register (static storage).
 		*
 		*	\return Registered channel.
 		*/
@@ -78,6 +99,10 @@ namespace Sa
 		/**
 		*	\brief UnRegister a log channel from channels.
 		*
+		*	Registered channels live until process exit, like the Default channel:
+		*	references returned by GetChannel() may be used by any thread at any time.
+		*	The channel is kept registered.
+		*
 		*	\param[in] _chan	Channel to unregister.
 		*/
 		SA_ENGINE_API static void UnRegisterChannel(const wchar* _chan) noexcept;
@@ -93,6 +118,13 @@ namespace Sa
 		*/
 		SA_ENGINE_API static void Log(const Sa::Log& _log) noexcept;
 
+		/**
+		*	\brief Output every pending log now (asynchronous logging).
+		*
+		*	Called on assertion failure and fatal signals.
+		*/
+		SA_ENGINE_API static void Flush() noexcept;
+
 #endif
 
 #if SA_ASSERTION
@@ -102,7 +134,6 @@ namespace Sa
 		*	\brief Throw assertion with str in chan on flase predicate.
 		*
 		*	The channel is automatically set on assertion failure.
-		*	Use SA_ASSERT as helper call.
 		*
 		*	This must me a template Exception type to allow catch of typed exception.
 		*
@@ -111,6 +142,57 @@ namespace Sa
 		template <ExceptCode code>
 		static void Assert(const Exception<code>& _exception);
 
+		/**
+		*	\brief Assertion failure: create, output and throw the exception.
+		*
+		*	Cold path of SA_ASSERT, only called once the predicate failed:
+		*	file name parsing, channel lookup and exception creation stay out of the caller.
+		*
+		*	\param[in] _file		File path of the assertion.
+		*	\param[in] _function	Function of the assertion.
+		*	\param[in] _line		Line of the assertion.
+		*	\param[in] _title		Title name of the exception.
+		*	\param[in] _chanId		ID of the channel.
+		*	\param[in] _chanName	Name of the channel.
+		*	\param[in] _args		Exception additional arguments (details, range...).
+		*/
+		template <ExceptCode code, typename... Args>
+		SA_NOINLINE SA_COLD static void AssertFailed(
+			const wchar* _file,
+			const char8* _function,
+			uint32 _line,
+			const wchar* _title,
+			StringId _chanId,
+			const wchar* _chanName,
+			Args... _args
+		);
+
+#if SA_ASSERT_TRACE_SUCCESS
+
+		/**
+		*	\brief Successful assertion output (SA_ASSERT_TRACE_SUCCESS).
+		*
+		*	\param[in] _file		File path of the assertion.
+		*	\param[in] _function	Function of the assertion.
+		*	\param[in] _line		Line of the assertion.
+		*	\param[in] _title		Title name of the exception.
+		*	\param[in] _chanId		ID of the channel.
+		*	\param[in] _chanName	Name of the channel.
+		*	\param[in] _args		Exception additional arguments (details, range...).
+		*/
+		template <ExceptCode code, typename... Args>
+		SA_NOINLINE static void AssertSuccess(
+			const wchar* _file,
+			const char8* _function,
+			uint32 _line,
+			const wchar* _title,
+			StringId _chanId,
+			const wchar* _chanName,
+			Args... _args
+		);
+
+#endif
+
 #endif
 	};
 
@@ -131,6 +213,63 @@ namespace Sa
 
 #endif
 
+#if SA_LOGGING || SA_ASSERTION
+
+	#define __SA_GET_CHANNEL(_chan) Sa::Debug::GetChannel(SA_STRING_ID(SA_WSTR(_chan)), SA_WSTR(_chan))
+
+#endif
+
+	namespace Internal
+	{
+		/**
+		*	\brief Whether logs of a channel are compiled (SA_LOG_CHANNELS list).
+		*
+		*	\param[in] _id		ID of the channel.
+		*
+		*	\return true if channel is in the list or no list is defined.
+		*/
+		constexpr bool IsLogChannelCompiled(StringId _id) noexcept
+		{
+#ifdef SA_LOG_CHANNELS
+
+			constexpr StringId channels[] = { SA_LOG_CHANNELS };
+
+			for (StringId chan : channels)
+			{
+				if (chan == _id)
+					return true;
+			}
+
+			return false;
+
+#else
+
+			(void)_id;
+
+			return true;
+
+#endif
+		}
+	}
+
+
+	/// Compile-time level index for SA_LOG_MIN_LEVEL.
+	#define __SA_LOG_LVL_Normal 0
+	#define __SA_LOG_LVL_Infos 1
+	#define __SA_LOG_LVL_Warning 2
+	#define __SA_LOG_LVL_Error 3
+	#define __SA_LOG_LVL_AssertSuccess 4
+	#define __SA_LOG_LVL_AssertFailed 5
+
+	#define __SA_LOG_COMPILED(_lvl, _chan) (__SA_LOG_LVL_##_lvl >= SA_LOG_MIN_LEVEL &&\
+		Sa::Internal::IsLogChannelCompiled(SA_STRING_ID(SA_WSTR(_chan))))
+
+	#define __SA_SELECT_LOG_MACRO(_1, _2, _3, _name, ...) _name
+
+	#define __SA_LOG1(_str)					__SA_LOG(_str, Normal, Default)
+	#define __SA_LOG2(_str, _lvl)			__SA_LOG(_str, _lvl, Default)
+	#define __SA_LOG3(_str, _lvl, _chan)	__SA_LOG(_str, _lvl, _chan)
+
 /// \endcond Internal
 
 
@@ -144,9 +283,9 @@ namespace Sa
 			Sa::Debug::levelMask.Remove(Sa::LogLvlFlag::_lvl);\
 	}
 
-	#define SA_LOG_CHAN_ENABLE_LOG(_chan, _enable) { Sa::Debug::GetChannel(L"" # _chan).enableLog = _enable; }
+	#define SA_LOG_CHAN_ENABLE_LOG(_chan, _enable) { __SA_GET_CHANNEL(_chan).enableLog = _enable; }
 
-	#define SA_LOG_CHAN_ENABLE_ASSERT(_chan, _enable) { Sa::Debug::GetChannel(L"" # _chan).enableAssert = _enable; }
+	#define SA_LOG_CHAN_ENABLE_ASSERT(_chan, _enable) { __SA_GET_CHANNEL(_chan).enableAssert = _enable; }
 
 
 	/// \cond Internal
@@ -157,26 +296,50 @@ namespace Sa
 		__LINE__,\
 		SA_WIDE(_str),\
 		Sa::LogLvlFlag::_lvl,\
-		Sa::Debug::GetChannel(SA_WSTR(_chan))\
+		_chan\
 	)
 
-	#define __SA_SELECT_LOG_MACRO(_1, _2, _3, _name, ...) _name
-
-	#define __SA_LOG1(_str)					{ Sa::Debug::Log(__SA_CREATE_LOG(_str, Normal, Default)); }
-	#define __SA_LOG2(_str, _lvl)			{ Sa::Debug::Log(__SA_CREATE_LOG(_str, _lvl, Default)); }
-	#define __SA_LOG3(_str, _lvl, _chan)	{ Sa::Debug::Log(__SA_CREATE_LOG(_str, _lvl, _chan)); }
+	#define __SA_LOG(_str, _lvl, _chan)\
+	{\
+		if constexpr (__SA_LOG_COMPILED(_lvl, _chan))\
+		{\
+			if (Sa::Debug::levelMask.IsSet(Sa::LogLvlFlag::_lvl))\
+			{\
+				const Sa::LogChannel& __saLogChan = __SA_GET_CHANNEL(_chan);\
+\
+				if (__saLogChan.enableLog)\
+					Sa::Debug::Log(__SA_CREATE_LOG(_str, _lvl, __saLogChan));\
+			}\
+		}\
+	}
 
 	/// \endcond Internal
 
 	#define SA_LOG(...) __SA_SELECT_LOG_MACRO(__VA_ARGS__, __SA_LOG3, __SA_LOG2, __SA_LOG1)(__VA_ARGS__)
 
-#else
+#elif SA_FLIGHT_RECORDER
+
 	/// \cond Internal
 
-	#define __SA_CREATE_LOG(...)
+	// No output: only record in flight recorder.
+	#define __SA_LOG(_str, _lvl, _chan)\
+	{\
+		if constexpr (__SA_LOG_COMPILED(_lvl, _chan))\
+			Sa::FlightRecorder::RecordLog(SA_WIDE(_str), Sa::LogLvlFlag::_lvl, SA_WSTR(_chan), SA_WIDE(__FILE__), __LINE__);\
+	}
 
 	/// \endcond Internal
 
+	#define SA_LOG(...) __SA_SELECT_LOG_MACRO(__VA_ARGS__, __SA_LOG3, __SA_LOG2, __SA_LOG1)(__VA_ARGS__)
+
+	#define SA_LOG_LVL_ENABLE(...) {}
+
+	#define SA_LOG_CHAN_ENABLE_LOG(...) {}
+
+	#define SA_LOG_CHAN_ENABLE_ASSERT(...) {}
+
+#else
+
 	#define SA_LOG(...) {}
 
 	#define SA_LOG_LVL_ENABLE(...) {}
@@ -191,28 +354,37 @@ namespace Sa
 
 	/// \cond Internal
 
-	#define __SA_CREATE_EXCEPTION(_predicate, _code, _chan, ...) Sa::Exception<Sa::ExceptCode::_code>(\
-		Sa::Debug::GetFileNameFromPath(SA_WIDE(__FILE__)),\
+	#define __SA_ASSERT_ARGS(_code, _chan)\
+		SA_WIDE(__FILE__),\
 		__SA_FUNC_NAME,\
 		__LINE__,\
 		SA_WSTR(_code),\
-		(_predicate) ? LogLvlFlag::AssertSuccess : LogLvlFlag::AssertFailed,\
-		SA_WSTR(_chan),\
-		##__VA_ARGS__\
-	)
+		SA_STRING_ID(SA_WSTR(_chan)),\
+		SA_WSTR(_chan)
 
-	/// \endcond Internal
+	#if SA_ASSERT_TRACE_SUCCESS
 
-	#define SA_ASSERT(_predicate, _code, _chan, ...) { Sa::Debug::Assert(__SA_CREATE_EXCEPTION(_predicate, _code, _chan, ##__VA_ARGS__)); }
+		#define __SA_ASSERT_SUCCESS(_code, _chan, ...)\
+			else\
+				Sa::Debug::AssertSuccess<Sa::ExceptCode::_code>(__SA_ASSERT_ARGS(_code, _chan), ##__VA_ARGS__);
 
-#else
+	#else
 
-	/// \cond Internal
+		#define __SA_ASSERT_SUCCESS(...)
 
-	#define __SA_CREATE_EXCEPTION(...)
+	#endif
 
 	/// \endcond Internal
 
+	#define SA_ASSERT(_predicate, _code, _chan, ...)\
+	{\
+		if (SA_UNLIKELY(!(_predicate)))\
+			Sa::Debug::AssertFailed<Sa::ExceptCode::_code>(__SA_ASSERT_ARGS(_code, _chan), ##__VA_ARGS__);\
+		__SA_ASSERT_SUCCESS(_code, _chan, ##__VA_ARGS__)\
+	}
+
+#else
+
 	#define SA_ASSERT(...) {}
 
 #endif
@@ -257,6 +429,7 @@ namespace Sa
 	*	\brief Sapphire Log macro.
 	*
 	*	Helper macro to use Debug::Log.
+	*	Compile to nothing below SA_LOG_MIN_LEVEL or outside SA_LOG_CHANNELS.
 	*
 	*	\param[in] _str		String message of the log.
 	*	\param[in] _lvl		Level of the log.
@@ -269,6 +442,8 @@ namespace Sa
 	*	\brief Sapphire Assertion macro.
 	*
 	*	Helper macro to use Debug::Assert.
+	*	Only the predicate is evaluated on success: the exception is created in a cold path on failure.
+	*	Define SA_ASSERT_TRACE_SUCCESS to output successful assertions.
 	*
 	*	\param[in] _predicate		Throw exception on false.
 	*	\param[in] _code			Code of the exception.
@@ -287,6 +462,29 @@ namespace Sa
 	*	\e Getter of the <b> current scope </b> function name and signature as wchar*.
 	*/
 
+	/**
+	*	\def __SA_GET_CHANNEL(_chan)
+	*
+	*	\brief Sapphire get log channel internal macro.
+	*
+	*	Lookup channel with its compile-time StringId, register it on first use.
+	*
+	*	\param[in] _chan	Channel name (identifier).
+	*
+	*	\return The LogChannel.
+	*/
+
+	/**
+	*	\def __SA_LOG_COMPILED(_lvl, _chan)
+	*
+	*	\brief Sapphire compile-time log filter internal macro.
+	*
+	*	\param[in] _lvl		Level of the log.
+	*	\param[in] _chan	Channel of the log (identifier).
+	*
+	*	\return Whether the log is compiled (SA_LOG_MIN_LEVEL and SA_LOG_CHANNELS).
+	*/
+
 	/**
 	*	\def __SA_CREATE_LOG(_str, _lvl, _chan)
 	*
@@ -296,24 +494,45 @@ namespace Sa
 	*
 	*	\param[in] _str		String message of the log.
 	*	\param[in] _lvl		Level of the log.
-	*	\param[in] _chan	Channel of the log.
+	*	\param[in] _chan	LogChannel object of the log.
 	*
 	*	\return The created Sa::Log.
 	*/
 
 	/**
-	*	\def __SA_CREATE_EXCEPTION(_predicate, _code, _chan, _details)
+	*	\def __SA_LOG(_str, _lvl, _chan)
+	*
+	*	\brief Sapphire log internal macro.
+	*
+	*	Compile-time filter first, then runtime level and channel filters:
+	*	the Sa::Log (file name, timestamp) is only created if it will be output.
+	*
+	*	\param[in] _str		String message of the log.
+	*	\param[in] _lvl		Level of the log.
+	*	\param[in] _chan	Channel of the log.
+	*/
+
+	/**
+	*	\def __SA_ASSERT_ARGS(_code, _chan)
 	*
-	*	\brief Sapphire create exception internal macro.
+	*	\brief Sapphire assertion location internal macro.
 	*
-	*	Helper macro to create a Sa::Exception.
+	*	Compile-time arguments of Debug::AssertFailed (no work done before failure).
 	*
-	*	\param[in] _predicate		Whether to create the exception with AssertionSuccess or AssertionFailed level.
 	*	\param[in] _code			Code of the exception.
 	*	\param[in] _chan			Channel of the exception.
-	*	\param[in] _details			Details of the exception.
+	*/
+
+	/**
+	*	\def __SA_ASSERT_SUCCESS(_code, _chan, _details)
+	*
+	*	\brief Sapphire successful assertion internal macro.
+	*
+	*	Output successful assertion if SA_ASSERT_TRACE_SUCCESS, compile to nothing otherwise.
 	*
-	*	\return The created Sa::Exception.
+	*	\param[in] _code			Code of the exception.
+	*	\param[in] _chan			Channel of the exception.
+	*	\param[in] _details			Details of the exception.
 	*/
 
 	/// \endcond Internal
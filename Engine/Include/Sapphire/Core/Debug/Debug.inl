@@ -13,8 +13,11 @@ namespace Sa
 
 		if (_exception.level == LogLvlFlag::AssertFailed)
 		{
-			// Force channel and level.
-			Log_Internal(_exception);
+			FlightRecorder::RecordLog(_exception);
+			FlightRecorder::Dump("Assertion failed");
+
+			// Force channel and level. Output before throw: may never be caught.
+			LogImmediate_Internal(_exception);
 
 			throw _exception;
 		}
@@ -22,5 +25,53 @@ namespace Sa
 			Log(_exception);
 	}
 
+	template <ExceptCode code, typename... Args>
+	void Debug::AssertFailed(
+		const wchar* _file,
+		const char8* _function,
+		uint32 _line,
+		const wchar* _title,
+		StringId _chanId,
+		const wchar* _chanName,
+		Args... _args
+	)
+	{
+		Assert(Exception<code>(
+			GetFileNameFromPath(_file),
+			_function,
+			_line,
+			_title,
+			LogLvlFlag::AssertFailed,
+			GetChannel(_chanId, _chanName),
+			_args...
+		));
+	}
+
+#if SA_ASSERT_TRACE_SUCCESS
+
+	template <ExceptCode code, typename... Args>
+	void Debug::AssertSuccess(
+		const wchar* _file,
+		const char8* _function,
+		uint32 _line,
+		const wchar* _title,
+		StringId _chanId,
+		const wchar* _chanName,
+		Args... _args
+	)
+	{
+		Assert(Exception<code>(
+			GetFileNameFromPath(_file),
+			_function,
+			_line,
+			_title,
+			LogLvlFlag::AssertSuccess,
+			GetChannel(_chanId, _chanName),
+			_args...
+		));
+	}
+
+#endif
+
 #endif
 }
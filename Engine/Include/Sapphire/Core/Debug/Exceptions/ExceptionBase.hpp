@@ -82,6 +82,13 @@ namespace Sa
 		*	\param[in,out] _stream		Stream to output in.
 		*/
 		SA_ENGINE_API void Output(std::wostream& _stream) const noexcept override;
+
+		/**
+		*	\brief Exceptions output details.
+		*
+		*	\return true.
+		*/
+		SA_ENGINE_API bool HasDetails() const noexcept override;
 	};
 
 
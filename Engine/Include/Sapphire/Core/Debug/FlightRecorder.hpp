@@ -0,0 +1,125 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_FLIGHT_RECORDER_GUARD
+#define SAPPHIRE_CORE_FLIGHT_RECORDER_GUARD
+
+#include <Core/Config.hpp>
+
+#include <Core/Types/Int.hpp>
+#include <Core/Types/Char.hpp>
+
+#include <Core/Debug/LogLevel.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file FlightRecorder.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>flight recorder</b>.
+	*
+	*	\ingroup Debug
+	*	\{
+	*/
+
+
+	class Log;
+
+	/**
+	*	\brief Static crash-safe flight recorder.
+	*
+	*	Fixed-size lock-free ring of the most recent log records, frame markers and GPU submissions.
+	*	Recording only stores into a preallocated slot: no allocation, lock nor I/O.
+	*	The ring is dumped to disk in a single write() on assertion failure, fatal signal
+	*	and Vulkan device lost.
+	*
+	*	Enabled with SA_FLIGHT_RECORDER (also in release: SA_LOG records without output).
+	*/
+	class FlightRecorder
+	{
+	public:
+		/// Number of records kept in the ring.
+		static constexpr uint32 Capacity = 4096u;
+
+		/// Max recorded text length (longer text is truncated).
+		static constexpr uint32 MaxTextLength = 79u;
+
+
+		/**
+		*	\brief \b Record a log message.
+		*
+		*	\param[in] _str			Message of the log.
+		*	\param[in] _level		Level of the log.
+		*	\param[in] _channel		Channel name of the log (static storage).
+		*	\param[in] _file		File of the log (static storage).
+		*	\param[in] _line		Line of the log.
+		*/
+		SA_ENGINE_API static void RecordLog(const wchar* _str, LogLvlFlag _level, const wchar* _channel, const wchar* _file, uint32 _line) noexcept;
+
+		/**
+		*	\brief \b Record a log.
+		*
+		*	Derived logs (exceptions) are formatted with their details.
+		*
+		*	\param[in] _log		Log to record.
+		*/
+		SA_ENGINE_API static void RecordLog(const Log& _log) noexcept;
+
+		/**
+		*	\brief \b Record a new frame marker.
+		*
+		*	\return recorded frame number.
+		*/
+		SA_ENGINE_API static uint64 RecordFrame() noexcept;
+
+		/**
+		*	\brief \b Record a GPU submission.
+		*
+		*	\param[in] _name	Name of the submission (static storage).
+		*
+		*	\return recorded submission ID.
+		*/
+		SA_ENGINE_API static uint64 RecordGpuSubmit(const char* _name) noexcept;
+
+		/**
+		*	\brief \b Record a user event.
+		*
+		*	\param[in] _name	Name of the event (static storage).
+		*	\param[in] _value	Value of the event.
+		*/
+		SA_ENGINE_API static void RecordEvent(const char* _name, uint64 _value) noexcept;
+
+
+		/**
+		*	\brief \e Setter of the dump file path.
+		*
+		*	\param[in] _path	Dump file path (static storage). nullptr disables dumps.
+		*/
+		SA_ENGINE_API static void SetDumpPath(const char* _path) noexcept;
+
+		/**
+		*	\brief \b Dump every record to the dump file in a single write().
+		*
+		*	Async-signal-safe: no allocation, formatting into a preallocated buffer.
+		*	Concurrent dump calls are skipped.
+		*
+		*	\param[in] _reason	Dump reason written in the header.
+		*
+		*	\return true on success.
+		*/
+		SA_ENGINE_API static bool Dump(const char* _reason) noexcept;
+
+		/**
+		*	\brief Set Dump() as the CrashStage::Dump hook of the CrashHandler.
+		*
+		*	Called on first record.
+		*/
+		SA_ENGINE_API static void InstallCrashHandlers() noexcept;
+	};
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,150 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_FRAME_STATS_GUARD
+#define SAPPHIRE_CORE_FRAME_STATS_GUARD
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Support/EngineAPI.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file FrameStats.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>frame statistics</b>.
+	*
+	*	\ingroup Debug
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Recorded frame statistic.
+	*/
+	enum class FrameStat : uint8
+	{
+		/// CPU frame time: time between two FrameStats::NewFrame() calls.
+		CpuFrame,
+
+		/// Time blocked waiting for the frame fence (GPU still using the frame).
+		FenceWait,
+
+		/// Time blocked acquiring the next swapchain image.
+		AcquireWait,
+
+		/// Graphics submit to frame fence observed signaled: GPU completion, not presentation (display is later).
+		GpuLatency,
+
+		/// Number of statistics.
+		Count
+	};
+
+	/**
+	*	\brief Rolling summary of a statistic (in nanoseconds).
+	*/
+	struct FrameStatSummary
+	{
+		/// Number of samples in the window.
+		uint32 sampleNum = 0u;
+
+		/// Min sample.
+		int64 min = 0;
+
+		/// Average of the samples.
+		int64 avg = 0;
+
+		/// 95th percentile.
+		int64 p95 = 0;
+
+		/// 99th percentile.
+		int64 p99 = 0;
+
+		/// Max sample.
+		int64 max = 0;
+	};
+
+
+	/**
+	*	\brief Static frame-time statistics and frame-pacing monitor.
+	*
+	*	Keep the last Capacity samples of each statistic (in nanoseconds, see Time::NanoSeconds())
+	*	and count stutters: CPU frames longer than the stutter factor times the rolling average.
+	*	Stutters are also recorded in the flight recorder.
+	*
+	*	Not thread-safe: record and query from frame-ordered code (ex: render thread).
+	*/
+	class FrameStats
+	{
+	public:
+		/// Number of samples kept per statistic.
+		static constexpr uint32 Capacity = 512u;
+
+		/// Min number of CPU frame samples before stutter detection.
+		static constexpr uint32 StutterMinSampleNum = 16u;
+
+
+		/**
+		*	\brief Mark a new frame: record the CPU frame time since the previous call.
+		*/
+		SA_ENGINE_API static void NewFrame() noexcept;
+
+		/**
+		*	\brief \b Record a statistic sample.
+		*
+		*	\param[in] _stat	Recorded statistic.
+		*	\param[in] _time	Sample (in nanoseconds).
+		*/
+		SA_ENGINE_API static void Record(FrameStat _stat, int64 _time) noexcept;
+
+
+		/**
+		*	\brief Compute the rolling summary of a statistic.
+		*
+		*	\param[in] _stat	Statistic to summarize.
+		*
+		*	\return summary over the last samples.
+		*/
+		SA_ENGINE_API static FrameStatSummary GetSummary(FrameStat _stat);
+
+		/**
+		*	\brief \e Getter of the number of frames since the last Reset().
+		*
+		*	\return frame number.
+		*/
+		SA_ENGINE_API static uint64 GetFrameNum() noexcept;
+
+		/**
+		*	\brief \e Getter of the number of stutters since the last Reset().
+		*
+		*	\return stutter number.
+		*/
+		SA_ENGINE_API static uint64 GetStutterNum() noexcept;
+
+		/**
+		*	\brief \e Getter of the stutter factor.
+		*
+		*	\return stutter factor.
+		*/
+		SA_ENGINE_API static float GetStutterFactor() noexcept;
+
+		/**
+		*	\brief \e Setter of the stutter factor (default 2).
+		*
+		*	\param[in] _factor	Frame time / rolling average ratio to count a stutter.
+		*/
+		SA_ENGINE_API static void SetStutterFactor(float _factor) noexcept;
+
+		/**
+		*	\brief Clear every sample and counter.
+		*/
+		SA_ENGINE_API static void Reset() noexcept;
+	};
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -7,7 +7,8 @@
 
 #include <ostream>
 
-#include <Core/Time/DateTime.hpp>
+#include <Core/Types/Int.hpp>
+#include <Core/Types/Char.hpp>
 
 #include <Core/Debug/LogLevel.hpp>
 #include <Core/Debug/LogChannel.hpp>
@@ -49,8 +50,8 @@ namespace Sa
 		/// Log's channel.
 		const LogChannel& channel;
 
-		/// Date time of Log.
-		const DateTime date;
+		/// Creation time of Log: seconds since the Epoch (converted to date on output).
+		const uint64 timestamp = 0u;
 
 		/**
 		*	\brief \e Value Constructor.
@@ -71,6 +72,27 @@ namespace Sa
 			const LogChannel& _channel
 		) noexcept;
 
+		/**
+		*	\brief \e Value Constructor with creation time (ex: deferred log output).
+		*
+		*	\param[in] _file		File of the Log.
+		*	\param[in] _function	Function of the Log.
+		*	\param[in] _line		Line of the Log.
+		*	\param[in] _str			String of the Log.
+		*	\param[in] _level		Level of the Log.
+		*	\param[in] _channel		Channel of the Log.
+		*	\param[in] _timestamp	Creation time of the Log.
+		*/
+		SA_ENGINE_API Log(
+			const wchar* _file,
+			const char8* _function,
+			uint32 _line,
+			const wchar* _str,
+			LogLvlFlag _level,
+			const LogChannel& _channel,
+			uint64 _timestamp
+		) noexcept;
+
 		/**
 		*	\brief \e Move constructor.
 		*
@@ -85,6 +107,13 @@ namespace Sa
 		*/
 		SA_ENGINE_API Log(const Log& _other);
 
+		/**
+		*	\brief \e Output log date time into stream.
+		*
+		*	\param[in,out] _stream		Stream to output in.
+		*/
+		SA_ENGINE_API void OutputDate(std::wostream& _stream) const noexcept;
+
 		/**
 		*	\brief \e Output log into stream.
 		*
@@ -92,6 +121,15 @@ namespace Sa
 		*/
 		SA_ENGINE_API virtual void Output(std::wostream& _stream) const noexcept;
 
+		/**
+		*	\brief Whether Output() writes more than the log fields (ex: exception details).
+		*
+		*	Virtual query: no RTTI (disabled in release).
+		*
+		*	\return true if the log must be formatted with Output().
+		*/
+		SA_ENGINE_API virtual bool HasDetails() const noexcept;
+
 		/**
 		*	\brief \e Output this log into stream.
 		*
@@ -11,6 +11,7 @@
 
 #include <Core/Misc/RAII.hpp>
 #include <Core/Misc/Macro.hpp>
+#include <Core/Misc/StringId.hpp>
 
 namespace Sa
 {
@@ -33,7 +34,10 @@ namespace Sa
 	public:
 		/// Log channel name.
 		const wchar* name = nullptr;
-		
+
+		/// Log channel ID (hash of name).
+		StringId id;
+
 		/// Whether logging is enabled.
 		bool enableLog = true;
 
@@ -53,7 +57,7 @@ namespace Sa
 	/**
 	*	\brief RAII specialization for LogChannel.
 	*	
-	*	Register LogChannel on construct, UnRegister LogChannel on destruct.
+	*	Register LogChannel on construct. The channel stays registered until process exit.
 	*
 	*	\implements RAII
 	*/
@@ -74,7 +78,7 @@ namespace Sa
 		/**
 		*	\brief \b Destructor.
 		*
-		*	UnRegister mHandle Channel.
+		*	Keep mHandle channel registered (see Debug::UnRegisterChannel()).
 		*/
 		SA_ENGINE_API ~RAII() noexcept;
 	};
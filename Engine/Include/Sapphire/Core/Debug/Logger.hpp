@@ -0,0 +1,85 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_LOGGER_GUARD
+#define SAPPHIRE_CORE_LOGGER_GUARD
+
+#include <Core/Config.hpp>
+
+#include <Core/Debug/Log.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Logger.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>asynchronous logger</b>.
+	*
+	*	\ingroup Debug
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Static asynchronous logger.
+	*
+	*	Producers copy a compact binary record (location, level, channel, timestamp, message)
+	*	into their own lock-free SPSC ring: no formatting nor I/O on the logging thread.
+	*	A background sink thread formats records in batches and writes each batch with a single flush.
+	*	Records are ordered per producer thread.
+	*
+	*	Flush() is called before an assertion failure is output.
+	*	On fatal signals, CrashFlush() writes pending raw records once InstallCrashHandlers() has been called (done on sink start).
+	*/
+	class Logger
+	{
+	public:
+		/**
+		*	\brief \b Push a log to the calling thread's ring.
+		*
+		*	Start the sink thread on first call.
+		*	Block (yield) while the ring is full: logs are never dropped.
+		*
+		*	\param[in] _log		Log to output.
+		*/
+		SA_ENGINE_API static void Push(const Log& _log) noexcept;
+
+		/**
+		*	\brief \b Output every pushed log now, from the calling thread.
+		*/
+		SA_ENGINE_API static void Flush() noexcept;
+
+		/**
+		*	\brief Write a log immediately, after pending logs (ex: assertion failure).
+		*
+		*	\param[in] _log		Log to output.
+		*/
+		SA_ENGINE_API static void WriteImmediate(const Log& _log) noexcept;
+
+		/**
+		*	\brief Write pending records' raw text to stderr (async-signal-safe, fatal signal only).
+		*
+		*	No formatting stream nor allocation: level, channel and message, non-ASCII replaced.
+		*	Best effort: nothing is written if the rings are being drained or registered.
+		*/
+		SA_ENGINE_API static void CrashFlush() noexcept;
+
+		/**
+		*	\brief Set CrashFlush() as the CrashStage::Flush hook of the CrashHandler.
+		*/
+		SA_ENGINE_API static void InstallCrashHandlers() noexcept;
+
+		/**
+		*	\brief \b Stop the sink thread and flush pending logs.
+		*
+		*	Called at exit. Next logs are written synchronously.
+		*/
+		SA_ENGINE_API static void Shutdown() noexcept;
+	};
+
+
+	/** \} */
+}
+
+#endif // GUARD
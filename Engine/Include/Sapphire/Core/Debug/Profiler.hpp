@@ -0,0 +1,310 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_PROFILER_GUARD
+#define SAPPHIRE_CORE_PROFILER_GUARD
+
+#include <string>
+#include <vector>
+
+#include <Core/Config.hpp>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Misc/Macro.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Profiler.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>CPU profiler</b>.
+	*
+	*	\ingroup Debug
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Completed profile zone.
+	*/
+	struct ProfileZone
+	{
+		/// Zone name (static storage).
+		const char* name = nullptr;
+
+		/// Begin time (Profiler::GetTime()).
+		uint64 begin = 0u;
+
+		/// End time (Profiler::GetTime()).
+		uint64 end = 0u;
+
+		/// Index of the zone's thread.
+		uint32 thread = 0u;
+
+		/// Zone nesting depth in its thread.
+		uint32 depth = 0u;
+	};
+
+	/**
+	*	\brief Aggregated zone of a frame hierarchy.
+	*
+	*	Zones with the same name and the same parent are merged.
+	*/
+	struct ProfileNode
+	{
+		/// Zone name (static storage).
+		const char* name = nullptr;
+
+		/// Index of the parent node in ProfileFrame::nodes (Profiler::NoParent for roots).
+		uint32 parent = 0u;
+
+		/// Index of the zones' thread.
+		uint32 thread = 0u;
+
+		/// Node depth in the hierarchy.
+		uint32 depth = 0u;
+
+		/// Number of merged zones.
+		uint32 callCount = 0u;
+
+		/// Total time of the zones (in nanoseconds).
+		uint64 totalTime = 0u;
+
+		/// Total time minus children's time (in nanoseconds).
+		uint64 selfTime = 0u;
+	};
+
+	/**
+	*	\brief Hierarchical aggregation of the zones ended during a frame.
+	*/
+	struct ProfileFrame
+	{
+		/// Frame number.
+		uint64 index = 0u;
+
+		/// Frame begin time (Profiler::GetTime()).
+		uint64 begin = 0u;
+
+		/// Frame end time (Profiler::GetTime()).
+		uint64 end = 0u;
+
+		/// Nodes ordered by thread, then depth-first: parents before children.
+		std::vector<ProfileNode> nodes;
+	};
+
+
+	/**
+	*	\brief Static hierarchical CPU profiler.
+	*
+	*	Zones (see SA_PROFILE_SCOPE) are pushed into per-thread lock-free SPSC buffers.
+	*	NewFrame() collects every buffer, aggregates the ended frame and appends zones to the capture.
+	*	Zones are dropped if a thread's buffer is full (see GetDroppedZoneNum()).
+	*
+	*	NewFrame(), GetLastFrame() and captures must be used from a single thread (ex: render thread).
+	*/
+	class Profiler
+	{
+	public:
+		/// Parent index of root nodes.
+		static constexpr uint32 NoParent = ~uint32();
+
+		/// Max number of tracks (see CreateTrack()).
+		static constexpr uint32 MaxTrackNum = 16u;
+
+		/// Invalid track index.
+		static constexpr uint32 NoTrack = ~uint32();
+
+		/**
+		*	\brief Get the profiler time (monotonic, in nanoseconds).
+		*
+		*	Time::NanoSeconds(), or CpuClock::NanoSeconds() with SA_PROFILING_CPU_CLOCK.
+		*
+		*	\return current time.
+		*/
+		SA_ENGINE_API static uint64 GetTime() noexcept;
+
+		/**
+		*	\brief \b Push a completed zone to the calling thread's buffer.
+		*
+		*	\param[in] _name	Zone name (static storage).
+		*	\param[in] _begin	Begin time.
+		*	\param[in] _end		End time.
+		*	\param[in] _depth	Zone nesting depth.
+		*/
+		SA_ENGINE_API static void PushZone(const char* _name, uint64 _begin, uint64 _end, uint32 _depth) noexcept;
+
+		/**
+		*	\brief \e Setter of the calling thread's name in captures.
+		*
+		*	\param[in] _name	Thread name (static storage).
+		*/
+		SA_ENGINE_API static void SetCurrentThreadName(const char* _name) noexcept;
+
+		/**
+		*	\brief \e Getter of a thread (or track) name (see ProfileNode::thread).
+		*
+		*	\param[in] _thread		Thread index.
+		*
+		*	\return thread name, nullptr if unnamed or unregistered.
+		*/
+		SA_ENGINE_API static const char* GetThreadName(uint32 _thread) noexcept;
+
+
+		/**
+		*	\brief \b Create a zone track not bound to a thread (ex: GPU queue timeline).
+		*
+		*	Tracks are exported as threads. Zones are pushed with PushTrackZone() by a single producer at a time.
+		*
+		*	\param[in] _name	Track name (static storage).
+		*
+		*	\return created track index, NoTrack if MaxTrackNum is reached.
+		*/
+		SA_ENGINE_API static uint32 CreateTrack(const char* _name);
+
+		/**
+		*	\brief \b Destroy a track: pending zones are still collected.
+		*
+		*	\param[in] _track	Track to destroy.
+		*/
+		SA_ENGINE_API static void DestroyTrack(uint32 _track) noexcept;
+
+		/**
+		*	\brief \b Push a completed zone to a track.
+		*
+		*	\param[in] _track	Track index (see CreateTrack()).
+		*	\param[in] _name	Zone name (static storage).
+		*	\param[in] _begin	Begin time (Profiler::GetTime() domain).
+		*	\param[in] _end		End time (Profiler::GetTime() domain).
+		*	\param[in] _depth	Zone nesting depth.
+		*/
+		SA_ENGINE_API static void PushTrackZone(uint32 _track, const char* _name, uint64 _begin, uint64 _end, uint32 _depth) noexcept;
+
+		/**
+		*	\brief \e Getter of the number of zones dropped on full buffers.
+		*
+		*	\return dropped zone number.
+		*/
+		SA_ENGINE_API static uint64 GetDroppedZoneNum() noexcept;
+
+
+		/**
+		*	\brief End the current frame: collect zones and aggregate the frame hierarchy.
+		*/
+		SA_ENGINE_API static void NewFrame();
+
+		/**
+		*	\brief \e Getter of the last ended frame.
+		*
+		*	\return last frame hierarchy.
+		*/
+		SA_ENGINE_API static const ProfileFrame& GetLastFrame() noexcept;
+
+
+		/**
+		*	\brief \b Start a capture: keep every collected zone.
+		*/
+		SA_ENGINE_API static void StartCapture();
+
+		/**
+		*	\brief \b Stop the capture and export it to Chrome trace / Perfetto JSON.
+		*
+		*	Pending zones are collected first.
+		*
+		*	\param[in] _path	Output JSON file path.
+		*
+		*	\return true on success.
+		*/
+		SA_ENGINE_API static bool StopCapture(const std::string& _path);
+	};
+
+
+	/**
+	*	\brief RAII profile zone: measure the scope and push it on destruction.
+	*/
+	class SA_ENGINE_API ProfileScope
+	{
+		/// Zone name (static storage).
+		const char* mName = nullptr;
+
+		/// Begin time.
+		uint64 mBegin = 0u;
+
+		/// Zone nesting depth.
+		uint32 mDepth = 0u;
+
+	public:
+		/**
+		*	\brief \e Value constructor.
+		*
+		*	\param[in] _name	Zone name (static storage).
+		*/
+		ProfileScope(const char* _name) noexcept;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		ProfileScope(ProfileScope&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		ProfileScope(const ProfileScope&) = delete;
+
+		/**
+		*	\brief \e Destructor: push the zone.
+		*/
+		~ProfileScope() noexcept;
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		ProfileScope& operator=(ProfileScope&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		ProfileScope& operator=(const ProfileScope&) = delete;
+	};
+
+
+#if SA_PROFILING
+
+	/**
+	*	\brief Profile the current scope as a zone.
+	*
+	*	\param[in] _name	Zone name (string literal).
+	*/
+	#define SA_PROFILE_SCOPE(_name) const Sa::ProfileScope SA_CONCAT(__saProfileScope, __LINE__)(_name)
+
+	/**
+	*	\brief Profile the current function as a zone.
+	*/
+	#define SA_PROFILE_FUNCTION() SA_PROFILE_SCOPE(__func__)
+
+	/**
+	*	\brief End the current profiler frame.
+	*/
+	#define SA_PROFILE_FRAME() Sa::Profiler::NewFrame()
+
+#else
+
+	#define SA_PROFILE_SCOPE(...)
+
+	#define SA_PROFILE_FUNCTION()
+
+	#define SA_PROFILE_FRAME()
+
+#endif
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,51 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_ALIGN_GUARD
+#define SAPPHIRE_CORE_ALIGN_GUARD
+
+#include <Core/Types/Int.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Align.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>memory alignment</b> helpers.
+	*
+	*	\ingroup Memory
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Whether a value is a power of 2.
+	*
+	*	\param[in] _value	Value to test.
+	*
+	*	\return true if _value is a non-zero power of 2.
+	*/
+	constexpr bool IsPowerOfTwo(uint64 _value) noexcept
+	{
+		return _value && (_value & (_value - 1u)) == 0u;
+	}
+
+	/**
+	*	\brief Round a value up to the next multiple of an alignment.
+	*
+	*	\param[in] _value		Value to align.
+	*	\param[in] _alignment	Alignment. Must be a power of 2.
+	*
+	*	\return aligned value.
+	*/
+	constexpr uint64 AlignUp(uint64 _value, uint64 _alignment) noexcept
+	{
+		return (_value + _alignment - 1u) & ~(_alignment - 1u);
+	}
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,139 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_ARENA_ALLOCATOR_GUARD
+#define SAPPHIRE_CORE_ARENA_ALLOCATOR_GUARD
+
+#include <vector>
+
+#include <Core/Memory/LinearArena.hpp>
+#include <Core/Memory/FrameArena.hpp>
+
+#include <Core/Containers/SmallVector.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file ArenaAllocator.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>STL arena allocator</b> adapter.
+	*
+	*	\ingroup Memory
+	*	\{
+	*/
+
+
+	/**
+	*	\brief \b STL-compatible allocator adapter over an arena.
+	*
+	*	\tparam T		Type of allocated element.
+	*	\tparam ArenaT	Arena type: provide Allocate(size, alignment) and Deallocate(ptr, size).
+	*/
+	template <typename T, typename ArenaT>
+	class ArenaAllocator
+	{
+		template <typename, typename>
+		friend class ArenaAllocator;
+
+		/// Allocation source.
+		ArenaT* mArena = nullptr;
+
+	public:
+		/// STL allocator value type.
+		using value_type = T;
+
+		/// STL allocator rebind.
+		template <typename U>
+		struct rebind
+		{
+			using other = ArenaAllocator<U, ArenaT>;
+		};
+
+		/**
+		*	\brief \e Value constructor.
+		*
+		*	\param[in] _arena	Arena to allocate from. Must outlive the allocator.
+		*/
+		ArenaAllocator(ArenaT& _arena) noexcept;
+
+		/**
+		*	\brief \e Rebind constructor.
+		*
+		*	\param[in] _other	Allocator of another type on the same arena.
+		*/
+		template <typename U>
+		ArenaAllocator(const ArenaAllocator<U, ArenaT>& _other) noexcept;
+
+
+		/**
+		*	\brief \e Getter of the arena.
+		*
+		*	\return allocation arena.
+		*/
+		ArenaT& GetArena() const noexcept;
+
+
+		/**
+		*	\brief \b Allocate _num elements from the arena.
+		*
+		*	\param[in] _num		Number of elements.
+		*
+		*	\return allocated memory.
+		*/
+		T* allocate(std::size_t _num);
+
+		/**
+		*	\brief \b Deallocate _num elements to the arena.
+		*
+		*	\param[in] _ptr		Memory returned by allocate().
+		*	\param[in] _num		Number of elements.
+		*/
+		void deallocate(T* _ptr, std::size_t _num) noexcept;
+
+
+		/**
+		*	\brief \e Compare 2 allocators equality.
+		*
+		*	\param[in] _rhs		Other allocator.
+		*
+		*	\return Whether both allocators use the same arena.
+		*/
+		template <typename U>
+		bool operator==(const ArenaAllocator<U, ArenaT>& _rhs) const noexcept;
+
+		/**
+		*	\brief \e Compare 2 allocators inequality.
+		*
+		*	\param[in] _rhs		Other allocator.
+		*
+		*	\return Whether allocators use different arenas.
+		*/
+		template <typename U>
+		bool operator!=(const ArenaAllocator<U, ArenaT>& _rhs) const noexcept;
+	};
+
+
+	/// Vector allocated from a LinearArena (ex: ScratchScope): cost a pointer bump.
+	template <typename T>
+	using ScratchVector = std::vector<T, ArenaAllocator<T, LinearArena>>;
+
+	/// Vector allocated from a FrameArena: valid until the frame buffer comes back.
+	template <typename T>
+	using FrameVector = std::vector<T, ArenaAllocator<T, FrameArena>>;
+
+	/// SmallVector spilling into a LinearArena (ex: ScratchScope).
+	template <typename T, uint32 N>
+	using ScratchSmallVector = SmallVector<T, N, ArenaAllocator<T, LinearArena>>;
+
+	/// SmallVector spilling into a FrameArena.
+	template <typename T, uint32 N>
+	using FrameSmallVector = SmallVector<T, N, ArenaAllocator<T, FrameArena>>;
+
+
+	/** \} */
+}
+
+#include <Core/Memory/ArenaAllocator.inl>
+
+#endif // GUARD
@@ -0,0 +1,50 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	template <typename T, typename ArenaT>
+	ArenaAllocator<T, ArenaT>::ArenaAllocator(ArenaT& _arena) noexcept : mArena{ &_arena }
+	{
+	}
+
+	template <typename T, typename ArenaT>
+	template <typename U>
+	ArenaAllocator<T, ArenaT>::ArenaAllocator(const ArenaAllocator<U, ArenaT>& _other) noexcept : mArena{ _other.mArena }
+	{
+	}
+
+
+	template <typename T, typename ArenaT>
+	ArenaT& ArenaAllocator<T, ArenaT>::GetArena() const noexcept
+	{
+		return *mArena;
+	}
+
+
+	template <typename T, typename ArenaT>
+	T* ArenaAllocator<T, ArenaT>::allocate(std::size_t _num)
+	{
+		return static_cast<T*>(mArena->Allocate(_num * sizeof(T), alignof(T)));
+	}
+
+	template <typename T, typename ArenaT>
+	void ArenaAllocator<T, ArenaT>::deallocate(T* _ptr, std::size_t _num) noexcept
+	{
+		mArena->Deallocate(_ptr, _num * sizeof(T));
+	}
+
+
+	template <typename T, typename ArenaT>
+	template <typename U>
+	bool ArenaAllocator<T, ArenaT>::operator==(const ArenaAllocator<U, ArenaT>& _rhs) const noexcept
+	{
+		return mArena == _rhs.mArena;
+	}
+
+	template <typename T, typename ArenaT>
+	template <typename U>
+	bool ArenaAllocator<T, ArenaT>::operator!=(const ArenaAllocator<U, ArenaT>& _rhs) const noexcept
+	{
+		return mArena != _rhs.mArena;
+	}
+}
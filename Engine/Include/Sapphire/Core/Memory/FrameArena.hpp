@@ -0,0 +1,188 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_FRAME_ARENA_GUARD
+#define SAPPHIRE_CORE_FRAME_ARENA_GUARD
+
+#include <Core/Memory/LinearArena.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/SpinLock.hpp>
+#include <Core/Thread/CacheLine.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file FrameArena.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>frame arena</b> allocator type.
+	*
+	*	\ingroup Memory
+	*	\{
+	*/
+
+
+	/**
+	*	\brief <b>Multi-buffered per-frame bump</b> allocator.
+	*
+	*	Allocations live until the same buffer comes back: bufferNum - 1 frames after BeginFrame().
+	*	Allocate() is thread-safe and lock-free (atomic bump) while the buffer has room.
+	*	BeginFrame() must be called at a sync point, when no thread allocates.
+	*/
+	class SA_ENGINE_API FrameArena
+	{
+		/// \cond Internal
+
+		/// Per-frame buffer.
+		struct Buffer
+		{
+			/// Pre-allocated block.
+			uint8* data = nullptr;
+
+			/// Size of data (in bytes).
+			uint64 capacity = 0u;
+
+			/// Current bump offset in data.
+			alignas(CacheLineSize) Atomic<uint64> offset = 0u;
+
+			/// Heap blocks allocated when data is full (guarded by mOverflowLock).
+			Internal::ArenaOverflowList overflow;
+		};
+
+		/// \endcond Internal
+
+	public:
+		/// Max number of frame buffers.
+		static constexpr uint32 MaxBufferNum = 3u;
+
+	private:
+		/// Frame buffers.
+		Buffer mBuffers[MaxBufferNum];
+
+		/// Number of used buffers.
+		uint32 mBufferNum = 0u;
+
+		/// Index of the current frame buffer.
+		uint32 mCurrent = 0u;
+
+		/// Lock for overflow allocations.
+		SpinLock mOverflowLock;
+
+		/**
+		*	\brief Slow path: current buffer is full.
+		*
+		*	\param[in] _size		Size in bytes.
+		*	\param[in] _alignment	Alignment.
+		*
+		*	\return allocated memory.
+		*/
+		void* AllocateOverflow(uint64 _size, uint64 _alignment);
+
+	public:
+		/**
+		*	\brief \b Default constructor (no buffer: call Create()).
+		*/
+		FrameArena() = default;
+
+		/**
+		*	\brief \e Value constructor.
+		*
+		*	\param[in] _capacity	Size of each frame buffer (in bytes).
+		*	\param[in] _bufferNum	Number of frame buffers (2 or 3).
+		*/
+		FrameArena(uint64 _capacity, uint32 _bufferNum = 2u);
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		FrameArena(FrameArena&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		FrameArena(const FrameArena&) = delete;
+
+		/**
+		*	\brief \e Destructor: free every memory.
+		*/
+		~FrameArena();
+
+
+		/**
+		*	\brief \e Getter of the number of frame buffers.
+		*
+		*	\return buffer number.
+		*/
+		uint32 GetBufferNum() const noexcept;
+
+		/**
+		*	\brief \e Getter of the used size of the current frame, overflow included (in bytes).
+		*
+		*	\return used size.
+		*/
+		uint64 GetUsedSize() const noexcept;
+
+
+		/**
+		*	\brief \b Create the frame buffers.
+		*
+		*	\param[in] _capacity	Size of each frame buffer (in bytes).
+		*	\param[in] _bufferNum	Number of frame buffers (2 or 3).
+		*/
+		void Create(uint64 _capacity, uint32 _bufferNum = 2u);
+
+		/**
+		*	\brief \b Destroy the frame buffers.
+		*/
+		void Destroy();
+
+
+		/**
+		*	\brief \b Allocate memory in the current frame (any thread).
+		*
+		*	\param[in] _size		Size in bytes.
+		*	\param[in] _alignment	Alignment. Must be a power of 2.
+		*
+		*	\return allocated memory.
+		*/
+		void* Allocate(uint64 _size, uint64 _alignment = LinearArena::DefaultAlignment);
+
+		/**
+		*	\brief Memory is released by BeginFrame(): no-op.
+		*
+		*	\param[in] _ptr		Memory returned by Allocate().
+		*	\param[in] _size	Size of the allocation (in bytes).
+		*/
+		void Deallocate(void* _ptr, uint64 _size) noexcept;
+
+		/**
+		*	\brief Move to the next frame buffer and reset it (sync point).
+		*
+		*	A buffer which overflowed last time it was used grows to its peak usage.
+		*/
+		void BeginFrame();
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		FrameArena& operator=(FrameArena&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		FrameArena& operator=(const FrameArena&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Memory/FrameArena.inl>
+
+#endif // GUARD
@@ -0,0 +1,31 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	inline void* FrameArena::Allocate(uint64 _size, uint64 _alignment)
+	{
+		Buffer& buffer = mBuffers[mCurrent];
+
+		const uint64 base = reinterpret_cast<uint64>(buffer.data);
+
+		uint64 offset = buffer.offset.Get(MemoryOrder::Relaxed);
+		uint64 start = 0u;
+
+		do
+		{
+			start = AlignUp(base + offset, _alignment) - base;
+
+			if (start + _size > buffer.capacity)
+				return AllocateOverflow(_size, _alignment);
+		}
+		while (!buffer.offset.CompareExchangeWeak(offset, start + _size, MemoryOrder::Relaxed));
+
+		return buffer.data + start;
+	}
+
+	inline void FrameArena::Deallocate(void* _ptr, uint64 _size) noexcept
+	{
+		(void)_ptr;
+		(void)_size;
+	}
+}
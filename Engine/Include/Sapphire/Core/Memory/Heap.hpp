@@ -0,0 +1,72 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_HEAP_GUARD
+#define SAPPHIRE_CORE_HEAP_GUARD
+
+#include <Core/Types/Int.hpp>
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Memory/MemoryTag.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Heap.hpp
+	*
+	*	\brief \b Definition of Sapphire's global <b>heap</b>.
+	*
+	*	\ingroup Memory
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Global thread-safe tagged heap (locked TLSFAllocator).
+	*
+	*	Replace global new / delete when SA_MEMORY_GLOBAL_NEW is set:
+	*	every engine allocation is then accounted to the current MemoryTag.
+	*/
+	class SA_ENGINE_API Heap
+	{
+	public:
+		/**
+		*	\brief \b Allocate memory.
+		*
+		*	\param[in] _size		Size in bytes.
+		*	\param[in] _alignment	Alignment. Must be a power of 2.
+		*	\param[in] _tag			Accounting tag.
+		*
+		*	\return allocated memory, nullptr if the OS is out of memory.
+		*/
+		static void* Allocate(uint64 _size, uint64 _alignment = 16u, MemoryTag _tag = MemoryTags::GetCurrent());
+
+		/**
+		*	\brief \b Free memory.
+		*
+		*	\param[in] _ptr		Memory returned by Allocate() (nullptr allowed).
+		*/
+		static void Free(void* _ptr) noexcept;
+
+
+		/**
+		*	\brief \e Getter of the memory requested to the OS (in bytes).
+		*
+		*	\return reserved size.
+		*/
+		static uint64 GetReservedSize() noexcept;
+
+		/**
+		*	\brief \e Getter of the allocated block size (in bytes).
+		*
+		*	\return used size.
+		*/
+		static uint64 GetUsedSize() noexcept;
+	};
+
+
+	/** \} */
+}
+
+#endif // GUARD
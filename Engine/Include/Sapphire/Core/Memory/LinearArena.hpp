@@ -0,0 +1,249 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_LINEAR_ARENA_GUARD
+#define SAPPHIRE_CORE_LINEAR_ARENA_GUARD
+
+#include <cstddef> // std::max_align_t
+
+#include <Core/Types/Int.hpp>
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Memory/Align.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file LinearArena.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>linear arena</b> allocator type.
+	*
+	*	\ingroup Memory
+	*	\{
+	*/
+
+
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/**
+		*	\brief Heap blocks allocated when an arena is full.
+		*
+		*	Kept until the arena is reset: an arena never fails an allocation.
+		*/
+		class SA_ENGINE_API ArenaOverflowList
+		{
+			/// Header of an overflow block.
+			struct Block
+			{
+				Block* next = nullptr;
+			};
+
+			/// Last allocated block.
+			Block* mHead = nullptr;
+
+			/// Total allocated size (in bytes).
+			uint64 mSize = 0u;
+
+		public:
+			/**
+			*	\brief \e Getter of total allocated size (in bytes).
+			*
+			*	\return overflow size.
+			*/
+			uint64 GetSize() const noexcept;
+
+			/**
+			*	\brief \b Allocate a new heap block.
+			*
+			*	\param[in] _size		Size in bytes.
+			*	\param[in] _alignment	Alignment. Must be a power of 2.
+			*
+			*	\return allocated memory.
+			*/
+			void* Allocate(uint64 _size, uint64 _alignment);
+
+			/**
+			*	\brief \b Free every allocated block.
+			*/
+			void Free() noexcept;
+		};
+	}
+
+	/// \endcond Internal
+
+
+	/**
+	*	\brief <b>Single-thread bump</b> allocator.
+	*
+	*	Allocate() only moves an offset in a pre-allocated block.
+	*	Memory is released all at once by Reset() or down to a marker by Rewind().
+	*	When the block is full, allocations fall back to the heap until the next Reset(),
+	*	which grows the block to the peak usage: steady-state usage never hits the heap.
+	*/
+	class SA_ENGINE_API LinearArena
+	{
+		/// Pre-allocated block.
+		uint8* mData = nullptr;
+
+		/// Size of mData (in bytes).
+		uint64 mCapacity = 0u;
+
+		/// Current bump offset in mData.
+		uint64 mOffset = 0u;
+
+		/// Max used size (including overflow) since the last Reset().
+		uint64 mPeakSize = 0u;
+
+		/// Heap blocks allocated when mData is full.
+		Internal::ArenaOverflowList mOverflow;
+
+		/**
+		*	\brief Slow path: mData is full.
+		*
+		*	\param[in] _size		Size in bytes.
+		*	\param[in] _alignment	Alignment.
+		*
+		*	\return allocated memory.
+		*/
+		void* AllocateOverflow(uint64 _size, uint64 _alignment);
+
+	public:
+		/// Rewind point returned by GetMarker().
+		using Marker = uint64;
+
+		/// Default alignment of allocations.
+		static constexpr uint64 DefaultAlignment = alignof(std::max_align_t);
+
+		/**
+		*	\brief \b Default constructor (no block: call Create()).
+		*/
+		LinearArena() = default;
+
+		/**
+		*	\brief \e Value constructor.
+		*
+		*	\param[in] _capacity	Size of the pre-allocated block (in bytes).
+		*/
+		LinearArena(uint64 _capacity);
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		LinearArena(LinearArena&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		LinearArena(const LinearArena&) = delete;
+
+		/**
+		*	\brief \e Destructor: free every memory.
+		*/
+		~LinearArena();
+
+
+		/**
+		*	\brief \e Getter of the pre-allocated block size (in bytes).
+		*
+		*	\return capacity.
+		*/
+		uint64 GetCapacity() const noexcept;
+
+		/**
+		*	\brief \e Getter of the used size, overflow included (in bytes).
+		*
+		*	\return used size.
+		*/
+		uint64 GetUsedSize() const noexcept;
+
+		/**
+		*	\brief \e Getter of the max used size since the last Reset() (in bytes).
+		*
+		*	\return peak size.
+		*/
+		uint64 GetPeakSize() const noexcept;
+
+
+		/**
+		*	\brief \b Create the pre-allocated block.
+		*
+		*	\param[in] _capacity	Size of the block (in bytes).
+		*/
+		void Create(uint64 _capacity);
+
+		/**
+		*	\brief \b Destroy the pre-allocated block and every overflow.
+		*/
+		void Destroy();
+
+
+		/**
+		*	\brief \b Allocate memory: bump the offset.
+		*
+		*	\param[in] _size		Size in bytes.
+		*	\param[in] _alignment	Alignment. Must be a power of 2.
+		*
+		*	\return allocated memory.
+		*/
+		void* Allocate(uint64 _size, uint64 _alignment = DefaultAlignment);
+
+		/**
+		*	\brief \b Deallocate memory.
+		*
+		*	Only the last allocation is actually released (ex: growing vector).
+		*
+		*	\param[in] _ptr		Memory returned by Allocate().
+		*	\param[in] _size	Size of the allocation (in bytes).
+		*/
+		void Deallocate(void* _ptr, uint64 _size) noexcept;
+
+
+		/**
+		*	\brief \e Getter of the current rewind point.
+		*
+		*	\return current marker.
+		*/
+		Marker GetMarker() const noexcept;
+
+		/**
+		*	\brief Release every allocation done after _marker.
+		*
+		*	Overflow blocks are kept until Reset().
+		*
+		*	\param[in] _marker	Marker returned by GetMarker().
+		*/
+		void Rewind(Marker _marker) noexcept;
+
+		/**
+		*	\brief Release every allocation.
+		*
+		*	Free overflow blocks and grow the block to the peak usage.
+		*/
+		void Reset();
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		LinearArena& operator=(LinearArena&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		LinearArena& operator=(const LinearArena&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Memory/LinearArena.inl>
+
+#endif // GUARD
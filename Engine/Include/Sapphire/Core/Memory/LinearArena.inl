@@ -0,0 +1,39 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	inline void* LinearArena::Allocate(uint64 _size, uint64 _alignment)
+	{
+		const uint64 base = reinterpret_cast<uint64>(mData);
+		const uint64 start = AlignUp(base + mOffset, _alignment) - base;
+		const uint64 end = start + _size;
+
+		if (end > mCapacity)
+			return AllocateOverflow(_size, _alignment);
+
+		mOffset = end;
+
+		return mData + start;
+	}
+
+	inline void LinearArena::Deallocate(void* _ptr, uint64 _size) noexcept
+	{
+		// Last allocation: give it back.
+		if (static_cast<uint8*>(_ptr) + _size == mData + mOffset)
+			mOffset -= _size;
+	}
+
+
+	inline LinearArena::Marker LinearArena::GetMarker() const noexcept
+	{
+		return mOffset;
+	}
+
+	inline void LinearArena::Rewind(Marker _marker) noexcept
+	{
+		if (mOffset + mOverflow.GetSize() > mPeakSize)
+			mPeakSize = mOffset + mOverflow.GetSize();
+
+		mOffset = _marker;
+	}
+}
@@ -0,0 +1,202 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_MEMORY_TAG_GUARD
+#define SAPPHIRE_CORE_MEMORY_TAG_GUARD
+
+#include <Core/Types/Int.hpp>
+#include <Core/Types/Char.hpp>
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file MemoryTag.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>memory tag</b> accounting.
+	*
+	*	\ingroup Memory
+	*	\{
+	*/
+
+
+	/// Index of a registered memory tag.
+	using MemoryTag = uint8;
+
+
+	/**
+	*	\brief Allocation counters of a memory tag.
+	*/
+	class MemoryTagStats
+	{
+	public:
+		/// Currently allocated bytes.
+		Atomic<uint64> liveSize = 0u;
+
+		/// Max allocated bytes.
+		Atomic<uint64> peakSize = 0u;
+
+		/// Currently allocated block number.
+		Atomic<uint64> liveNum = 0u;
+
+		/// Total allocation number.
+		Atomic<uint64> totalNum = 0u;
+	};
+
+
+	/**
+	*	\brief Registry of memory tags and their counters.
+	*
+	*	Tag names reuse the log channel names (Rendering, SDK_Asset, Maths...).
+	*	Registration and accounting never allocate: safe to use from global new.
+	*/
+	class SA_ENGINE_API MemoryTags
+	{
+	public:
+		/// Max number of tags.
+		static constexpr uint32 MaxNum = 64u;
+
+		/// Tag of untagged allocations ("Default").
+		static constexpr MemoryTag Default = 0u;
+
+
+		/**
+		*	\brief \e Getter of the number of registered tags.
+		*
+		*	\return tag number.
+		*/
+		static uint32 GetNum() noexcept;
+
+		/**
+		*	\brief \e Getter of a tag name.
+		*
+		*	\param[in] _tag		Tag index.
+		*
+		*	\return tag name.
+		*/
+		static const wchar* GetName(MemoryTag _tag) noexcept;
+
+		/**
+		*	\brief \e Getter of a tag counters.
+		*
+		*	\param[in] _tag		Tag index.
+		*
+		*	\return tag counters.
+		*/
+		static MemoryTagStats& GetStats(MemoryTag _tag) noexcept;
+
+
+		/**
+		*	\brief Get or register a tag.
+		*
+		*	\param[in] _name	Tag name. Must outlive the program (ex: string literal).
+		*
+		*	\return tag index (Default if MaxNum is reached).
+		*/
+		static MemoryTag Register(const wchar* _name) noexcept;
+
+
+		/**
+		*	\brief \e Getter of the calling thread's current tag.
+		*
+		*	\return current tag.
+		*/
+		static MemoryTag GetCurrent() noexcept;
+
+		/**
+		*	\brief \e Setter of the calling thread's current tag.
+		*
+		*	\param[in] _tag		New current tag.
+		*/
+		static void SetCurrent(MemoryTag _tag) noexcept;
+
+
+		/**
+		*	\brief Account an allocation.
+		*
+		*	\param[in] _tag		Allocation tag.
+		*	\param[in] _size	Allocated bytes.
+		*/
+		static void OnAllocate(MemoryTag _tag, uint64 _size) noexcept;
+
+		/**
+		*	\brief Account a deallocation.
+		*
+		*	\param[in] _tag		Allocation tag.
+		*	\param[in] _size	Deallocated bytes.
+		*/
+		static void OnFree(MemoryTag _tag, uint64 _size) noexcept;
+
+
+		/**
+		*	\brief Log the counters of every tag.
+		*/
+		static void Log();
+	};
+
+
+	/**
+	*	\brief RAII scope setting the calling thread's current memory tag.
+	*
+	*	Allocations of the global Heap (and global new if SA_MEMORY_GLOBAL_NEW) use the current tag.
+	*/
+	class SA_ENGINE_API MemoryTagScope
+	{
+		/// Tag to restore.
+		MemoryTag mPrevious = MemoryTags::Default;
+
+	public:
+		/**
+		*	\brief \e Value constructor.
+		*
+		*	\param[in] _tag		Tag to set for the scope.
+		*/
+		MemoryTagScope(MemoryTag _tag) noexcept;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		MemoryTagScope(MemoryTagScope&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		MemoryTagScope(const MemoryTagScope&) = delete;
+
+		/**
+		*	\brief \e Destructor: restore the previous tag.
+		*/
+		~MemoryTagScope() noexcept;
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		MemoryTagScope& operator=(MemoryTagScope&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+	};
+
+
+	/**
+	*	\brief Get the memory tag of a channel name (registered once per call site).
+	*
+	*	\param[in] _chan	Channel name (ex: Rendering, SDK_Asset).
+	*/
+	#define SA_MEMORY_TAG(_chan) ([]() { static const Sa::MemoryTag tag = Sa::MemoryTags::Register(L"" #_chan); return tag; }())
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,181 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_POOL_ALLOCATOR_GUARD
+#define SAPPHIRE_CORE_POOL_ALLOCATOR_GUARD
+
+#include <Collections/Debug>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Algorithms/Forward.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file PoolAllocator.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>pool allocator</b> type.
+	*
+	*	\ingroup Memory
+	*	\{
+	*/
+
+
+	/**
+	*	\brief <b>Fixed-size object pool</b> with free-list recycling.
+	*
+	*	Objects are allocated by chunks of chunkSize: allocation and deallocation
+	*	are O(1) pointer swaps on an intrusive free-list, and addresses are stable.
+	*	Not thread-safe.
+	*
+	*	\tparam T			Type of pooled object.
+	*	\tparam chunkSize	Number of objects allocated at once when the pool is empty.
+	*/
+	template <typename T, uint32 chunkSize = 64u>
+	class PoolAllocator
+	{
+		static_assert(chunkSize > 0u, "PoolAllocator chunkSize must be > 0!");
+
+		/// \cond Internal
+
+		/// Object storage, or link to the next free node.
+		union Node
+		{
+			Node* next;
+			alignas(T) uint8 data[sizeof(T)];
+		};
+
+		/// Block of nodes.
+		struct Chunk
+		{
+			Chunk* next = nullptr;
+			Node nodes[chunkSize];
+		};
+
+		/// \endcond Internal
+
+		/// First free node.
+		Node* mFreeList = nullptr;
+
+		/// Allocated chunks.
+		Chunk* mChunks = nullptr;
+
+		/// Number of allocated objects.
+		uint32 mSize = 0u;
+
+		/// Number of allocated chunks.
+		uint32 mChunkNum = 0u;
+
+		/**
+		*	\brief Allocate a new chunk and push its nodes to the free-list.
+		*/
+		void AllocateChunk();
+
+	public:
+		/// Number of objects per chunk.
+		static constexpr uint32 ChunkSize = chunkSize;
+
+		/**
+		*	\brief \b Default constructor.
+		*/
+		PoolAllocator() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		PoolAllocator(PoolAllocator&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		PoolAllocator(const PoolAllocator&) = delete;
+
+		/**
+		*	\brief \e Destructor: free every chunk.
+		*
+		*	Objects still allocated are not destroyed (logged as warning).
+		*/
+		~PoolAllocator();
+
+
+		/**
+		*	\brief \e Getter of the number of allocated objects.
+		*
+		*	\return live object number.
+		*/
+		uint32 GetSize() const noexcept;
+
+		/**
+		*	\brief \e Getter of the number of objects the pool holds without new chunk.
+		*
+		*	\return capacity.
+		*/
+		uint32 GetCapacity() const noexcept;
+
+
+		/**
+		*	\brief \b Reserve chunks for at least _capacity objects.
+		*
+		*	\param[in] _capacity	Number of objects.
+		*/
+		void Reserve(uint32 _capacity);
+
+
+		/**
+		*	\brief \b Allocate memory for one object (not constructed).
+		*
+		*	\return allocated memory.
+		*/
+		T* Allocate();
+
+		/**
+		*	\brief \b Deallocate memory of one object (not destroyed).
+		*
+		*	\param[in] _ptr		Memory returned by Allocate().
+		*/
+		void Deallocate(T* _ptr) noexcept;
+
+
+		/**
+		*	\brief \b Allocate and construct one object.
+		*
+		*	\tparam Args		Constructor argument types.
+		*	\param[in] _args	Constructor arguments.
+		*
+		*	\return new object.
+		*/
+		template <typename... Args>
+		T* New(Args&&... _args);
+
+		/**
+		*	\brief \b Destroy and deallocate one object.
+		*
+		*	\param[in] _ptr		Object returned by New().
+		*/
+		void Delete(T* _ptr);
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		PoolAllocator& operator=(PoolAllocator&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Memory/PoolAllocator.inl>
+
+#endif // GUARD
@@ -0,0 +1,113 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <new> // placement new.
+
+namespace Sa
+{
+	template <typename T, uint32 chunkSize>
+	PoolAllocator<T, chunkSize>::~PoolAllocator()
+	{
+		if (mSize != 0u)
+			SA_LOG("Pool destroyed with allocated objects!", Warning, Tools);
+
+		while (mChunks)
+		{
+			Chunk* const next = mChunks->next;
+
+			delete mChunks;
+
+			mChunks = next;
+		}
+	}
+
+
+	template <typename T, uint32 chunkSize>
+	uint32 PoolAllocator<T, chunkSize>::GetSize() const noexcept
+	{
+		return mSize;
+	}
+
+	template <typename T, uint32 chunkSize>
+	uint32 PoolAllocator<T, chunkSize>::GetCapacity() const noexcept
+	{
+		return mChunkNum * chunkSize;
+	}
+
+
+	template <typename T, uint32 chunkSize>
+	void PoolAllocator<T, chunkSize>::AllocateChunk()
+	{
+		Chunk* const chunk = new Chunk();
+
+		chunk->next = mChunks;
+		mChunks = chunk;
+
+		++mChunkNum;
+
+		// Push in reverse: next allocations follow the memory order.
+		for (uint32 i = chunkSize; i > 0u; --i)
+		{
+			Node& node = chunk->nodes[i - 1u];
+
+			node.next = mFreeList;
+			mFreeList = &node;
+		}
+	}
+
+	template <typename T, uint32 chunkSize>
+	void PoolAllocator<T, chunkSize>::Reserve(uint32 _capacity)
+	{
+		while (GetCapacity() < _capacity)
+			AllocateChunk();
+	}
+
+
+	template <typename T, uint32 chunkSize>
+	T* PoolAllocator<T, chunkSize>::Allocate()
+	{
+		if (!mFreeList)
+			AllocateChunk();
+
+		Node* const node = mFreeList;
+		mFreeList = node->next;
+
+		++mSize;
+
+		return reinterpret_cast<T*>(node->data);
+	}
+
+	template <typename T, uint32 chunkSize>
+	void PoolAllocator<T, chunkSize>::Deallocate(T* _ptr) noexcept
+	{
+		if (!_ptr)
+			return;
+
+		Node* const node = reinterpret_cast<Node*>(_ptr);
+
+		node->next = mFreeList;
+		mFreeList = node;
+
+		--mSize;
+	}
+
+
+	template <typename T, uint32 chunkSize>
+	template <typename... Args>
+	T* PoolAllocator<T, chunkSize>::New(Args&&... _args)
+	{
+		T* const ptr = Allocate();
+
+		return new(ptr) T(Forward<Args>(_args)...);
+	}
+
+	template <typename T, uint32 chunkSize>
+	void PoolAllocator<T, chunkSize>::Delete(T* _ptr)
+	{
+		if (!_ptr)
+			return;
+
+		_ptr->~T();
+
+		Deallocate(_ptr);
+	}
+}
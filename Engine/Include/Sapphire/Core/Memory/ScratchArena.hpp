@@ -0,0 +1,90 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_SCRATCH_ARENA_GUARD
+#define SAPPHIRE_CORE_SCRATCH_ARENA_GUARD
+
+#include <Core/Memory/LinearArena.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file ScratchArena.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>thread-local scratch arena</b>.
+	*
+	*	\ingroup Memory
+	*	\{
+	*/
+
+
+	/**
+	*	\brief RAII scope of the calling thread's scratch arena.
+	*
+	*	Every scratch allocation done during the scope is released at its end.
+	*	Must be declared before the containers using it.
+	*/
+	class SA_ENGINE_API ScratchScope
+	{
+		/// Scratch arena of the calling thread.
+		LinearArena& mArena;
+
+		/// Arena state at scope start.
+		LinearArena::Marker mMarker = 0u;
+
+	public:
+		/// Default size of the scratch arena of each thread (in bytes).
+		static constexpr uint64 DefaultCapacity = 256u * 1024u;
+
+		/**
+		*	\brief \b Default constructor: open a scope on the calling thread's scratch arena.
+		*/
+		ScratchScope() noexcept;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		ScratchScope(ScratchScope&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		ScratchScope(const ScratchScope&) = delete;
+
+		/**
+		*	\brief \e Destructor: release every allocation of the scope.
+		*/
+		~ScratchScope();
+
+
+		/**
+		*	\brief \e Getter of the scratch arena of the calling thread.
+		*
+		*	Lazily created with DefaultCapacity on first call.
+		*
+		*	\return thread-local scratch arena.
+		*/
+		static LinearArena& GetArena() noexcept;
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		ScratchScope& operator=(ScratchScope&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		ScratchScope& operator=(const ScratchScope&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,263 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_TLSF_ALLOCATOR_GUARD
+#define SAPPHIRE_CORE_TLSF_ALLOCATOR_GUARD
+
+#include <Core/Types/Int.hpp>
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Memory/MemoryTag.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file TLSFAllocator.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>TLSF</b> allocator type.
+	*
+	*	\ingroup Memory
+	*	\{
+	*/
+
+
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/**
+		*	\brief Header of a TLSF block.
+		*
+		*	Physical neighbours are linked to merge free blocks in O(1).
+		*	nextFree / prevFree overlap the user data: only valid while the block is free.
+		*/
+		struct TLSFBlock
+		{
+			/// Size of the header (before user data).
+			static constexpr uint64 HeaderSize = 16u;
+
+			/// Block is in a free-list.
+			static constexpr uint64 FreeBit = 1u;
+
+			/// Bit shift of the tag in sizeFlags.
+			static constexpr uint64 TagShift = 56u;
+
+			/// Mask of the size in sizeFlags (multiple of 16).
+			static constexpr uint64 SizeMask = ((uint64(1u) << TagShift) - 1u) & ~uint64(0xF);
+
+
+			/// Previous physical block (nullptr for the first block of a pool).
+			TLSFBlock* prevPhys;
+
+			/// User data size, free bit and tag.
+			uint64 sizeFlags;
+
+			/// Next block in the free-list.
+			TLSFBlock* nextFree;
+
+			/// Previous block in the free-list.
+			TLSFBlock* prevFree;
+
+
+			uint64 GetSize() const noexcept { return sizeFlags & SizeMask; }
+			void SetSize(uint64 _size) noexcept { sizeFlags = (sizeFlags & ~SizeMask) | _size; }
+
+			bool IsFree() const noexcept { return sizeFlags & FreeBit; }
+			void SetFree(bool _bFree) noexcept { sizeFlags = _bFree ? sizeFlags | FreeBit : sizeFlags & ~FreeBit; }
+
+			MemoryTag GetTag() const noexcept { return static_cast<MemoryTag>(sizeFlags >> TagShift); }
+			void SetTag(MemoryTag _tag) noexcept { sizeFlags = (sizeFlags & ~(~uint64(0) << TagShift)) | (uint64(_tag) << TagShift); }
+
+			void* GetData() noexcept { return reinterpret_cast<uint8*>(this) + HeaderSize; }
+			TLSFBlock* GetNext() noexcept { return reinterpret_cast<TLSFBlock*>(static_cast<uint8*>(GetData()) + GetSize()); }
+
+			static TLSFBlock* FromData(const void* _data) noexcept
+			{
+				return reinterpret_cast<TLSFBlock*>(const_cast<uint8*>(static_cast<const uint8*>(_data)) - HeaderSize);
+			}
+		};
+	}
+
+	/// \endcond Internal
+
+
+	/**
+	*	\brief <b>Two-Level Segregated Fit</b> general-purpose allocator.
+	*
+	*	O(1) Allocate() and Free(): free blocks are binned by size class
+	*	(first level: power of 2, second level: linear subdivision) and found with 2 bit scans.
+	*	Free blocks are merged with their physical neighbours immediately, bounding fragmentation.
+	*	Memory is taken from the OS by pools, released on destruction only.
+	*
+	*	Each allocation holds a MemoryTag and updates the tag counters.
+	*	Not thread-safe: see Heap for the global locked instance.
+	*/
+	class SA_ENGINE_API TLSFAllocator
+	{
+		using Block = Internal::TLSFBlock;
+
+		/// Log2 of the second level subdivision number.
+		static constexpr uint32 SLLog2 = 5u;
+
+		/// Second level subdivision number.
+		static constexpr uint32 SLNum = 1u << SLLog2;
+
+		/// Log2 of the minimal alignment.
+		static constexpr uint32 AlignLog2 = 4u;
+
+		/// First level shift: sizes below 1 << FLShift share the first level 0.
+		static constexpr uint32 FLShift = SLLog2 + AlignLog2;
+
+		/// Log2 of the max block size.
+		static constexpr uint32 FLMax = 40u;
+
+		/// First level number.
+		static constexpr uint32 FLNum = FLMax - FLShift + 1u;
+
+		/// Sizes handled by the linear first level 0.
+		static constexpr uint64 SmallBlockSize = uint64(1u) << FLShift;
+
+
+		/// Free-list heads.
+		Block* mBlocks[FLNum][SLNum] = {};
+
+		/// First level bitmap: non-empty first levels.
+		uint32 mFLBitmap = 0u;
+
+		/// Second level bitmaps: non-empty lists per first level.
+		uint32 mSLBitmaps[FLNum] = {};
+
+		/// Allocated pools (linked in their first bytes).
+		void* mPools = nullptr;
+
+		/// Default size of a new pool.
+		uint64 mPoolSize = 0u;
+
+		/// Total size of pools.
+		uint64 mReservedSize = 0u;
+
+		/// Total size of allocated blocks.
+		uint64 mUsedSize = 0u;
+
+
+		void InsertFree(Block* _block) noexcept;
+		void RemoveFree(Block* _block) noexcept;
+		Block* FindFree(uint64 _size) noexcept;
+
+		void AddPool(uint64 _size);
+
+	public:
+		/// Minimal (and default) alignment of allocations.
+		static constexpr uint64 Alignment = uint64(1u) << AlignLog2;
+
+		/// Minimal user size of a block (holds free-list links).
+		static constexpr uint64 MinBlockSize = 16u;
+
+		/// Default size of pools requested to the OS.
+		static constexpr uint64 DefaultPoolSize = 4u * 1024u * 1024u;
+
+		/**
+		*	\brief \e Value constructor. No memory is requested before the first Allocate().
+		*
+		*	\param[in] _poolSize	Default size of pools requested to the OS.
+		*/
+		TLSFAllocator(uint64 _poolSize = DefaultPoolSize) noexcept;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		TLSFAllocator(TLSFAllocator&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		TLSFAllocator(const TLSFAllocator&) = delete;
+
+		/**
+		*	\brief \e Destructor: release every pool.
+		*/
+		~TLSFAllocator();
+
+
+		/**
+		*	\brief \e Getter of the memory requested to the OS (in bytes).
+		*
+		*	\return reserved size.
+		*/
+		uint64 GetReservedSize() const noexcept;
+
+		/**
+		*	\brief \e Getter of the allocated block size (in bytes).
+		*
+		*	\return used size.
+		*/
+		uint64 GetUsedSize() const noexcept;
+
+
+		/**
+		*	\brief \b Allocate memory.
+		*
+		*	\param[in] _size		Size in bytes.
+		*	\param[in] _alignment	Alignment. Must be a power of 2.
+		*	\param[in] _tag			Accounting tag.
+		*
+		*	\return allocated memory, nullptr if the OS is out of memory.
+		*/
+		void* Allocate(uint64 _size, uint64 _alignment = Alignment, MemoryTag _tag = MemoryTags::Default);
+
+		/**
+		*	\brief \b Free memory.
+		*
+		*	\param[in] _ptr		Memory returned by Allocate() (nullptr allowed).
+		*/
+		void Free(void* _ptr) noexcept;
+
+
+		/**
+		*	\brief \e Getter of the usable size of an allocation.
+		*
+		*	\param[in] _ptr		Memory returned by Allocate().
+		*
+		*	\return usable size (>= requested size).
+		*/
+		static uint64 GetAllocationSize(const void* _ptr) noexcept;
+
+		/**
+		*	\brief \e Getter of the tag of an allocation.
+		*
+		*	\param[in] _ptr		Memory returned by Allocate().
+		*
+		*	\return allocation tag.
+		*/
+		static MemoryTag GetAllocationTag(const void* _ptr) noexcept;
+
+
+		/**
+		*	\brief Check the consistency of every pool and free-list (debug).
+		*
+		*	\return true if valid.
+		*/
+		bool Validate() const noexcept;
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		TLSFAllocator& operator=(TLSFAllocator&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		TLSFAllocator& operator=(const TLSFAllocator&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -23,6 +23,16 @@
 #define SA_WSTR(_param) SA_WIDE(SA_STR(_param))
 
 
+/// \cond Internal
+
+#define __SA_CONCAT(_lhs, _rhs) _lhs ## _rhs
+
+/// \endcond Internal
+
+/// Concatenate _lhs and _rhs after expansion (ex: unique name with __LINE__).
+#define SA_CONCAT(_lhs, _rhs) __SA_CONCAT(_lhs, _rhs)
+
+
 /** \} */
 
 #endif // GUARD
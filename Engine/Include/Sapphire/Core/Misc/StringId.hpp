@@ -0,0 +1,172 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_STRING_ID_GUARD
+#define SAPPHIRE_CORE_STRING_ID_GUARD
+
+#include <string>
+#include <type_traits>
+
+#include <Core/Config.hpp>
+
+#include <Core/Types/Int.hpp>
+#include <Core/Types/Char.hpp>
+
+#include <Core/Algorithms/Hash.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file StringId.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>interned string ID</b> type.
+	*
+	*	\ingroup Misc
+	*	\{
+	*/
+
+
+	/**
+	*	\brief 64-bit ID of a string (FNV-1a hash).
+	*
+	*	Computed at compile-time from literals (see SA_STRING_ID): comparison and lookup cost an integer compare.
+	*	Each character is hashed as its code value: StringId("Name") == StringId(L"Name") for ASCII strings.
+	*	Use Intern() to register the string in the global table and get it back from the ID (debug, tools).
+	*/
+	class StringId
+	{
+		/// Hash of the string.
+		uint64 mId = sOffsetBasis;
+
+	public:
+		/// FNV-1a 64-bit offset basis: ID of the empty string.
+		static constexpr uint64 sOffsetBasis = 0xcbf29ce484222325ull;
+
+		/// FNV-1a 64-bit prime.
+		static constexpr uint64 sPrime = 0x100000001b3ull;
+
+
+		/**
+		*	\brief \e Default constructor: empty string ID.
+		*/
+		constexpr StringId() noexcept;
+
+		/**
+		*	\brief \e Value constructor from a null-terminated string.
+		*
+		*	\param[in] _str		String to hash.
+		*/
+		template <typename CharT>
+		constexpr StringId(const CharT* _str) noexcept;
+
+		/**
+		*	\brief \e Value constructor from a string.
+		*
+		*	\param[in] _str		String to hash.
+		*/
+		template <typename CharT>
+		StringId(const std::basic_string<CharT>& _str) noexcept;
+
+
+		/**
+		*	\brief \e Getter of the raw ID.
+		*
+		*	\return 64-bit hash of the string.
+		*/
+		constexpr uint64 GetId() const noexcept;
+
+		/**
+		*	\brief Whether ID is the empty string's.
+		*
+		*	\return true if empty.
+		*/
+		constexpr bool IsEmpty() const noexcept;
+
+
+		/**
+		*	\brief \e Create from a raw ID.
+		*
+		*	\param[in] _id		Raw ID (see GetId()).
+		*
+		*	\return created StringId.
+		*/
+		static constexpr StringId FromId(uint64 _id) noexcept;
+
+		/**
+		*	\brief Hash _size characters of _str.
+		*
+		*	\param[in] _str		Characters to hash.
+		*	\param[in] _size	Number of characters.
+		*
+		*	\return 64-bit FNV-1a hash.
+		*/
+		template <typename CharT>
+		static constexpr uint64 Hash(const CharT* _str, uint64 _size) noexcept;
+
+		/**
+		*	\brief Hash a null-terminated string.
+		*
+		*	\param[in] _str		String to hash.
+		*
+		*	\return 64-bit FNV-1a hash.
+		*/
+		template <typename CharT>
+		static constexpr uint64 Hash(const CharT* _str) noexcept;
+
+
+		/**
+		*	\brief Compute ID and register the string in the global intern table.
+		*
+		*	Thread-safe. Different strings with the same ID are asserted.
+		*
+		*	\param[in] _str		String to intern.
+		*
+		*	\return ID of _str.
+		*/
+		SA_ENGINE_API static StringId Intern(const std::string& _str);
+
+		/**
+		*	\brief \e Getter of an interned string.
+		*
+		*	Thread-safe. The returned string lives until the end of the program.
+		*
+		*	\param[in] _id		ID of the string.
+		*
+		*	\return interned string or nullptr if not interned.
+		*/
+		SA_ENGINE_API static const char8* GetString(StringId _id);
+
+
+		constexpr bool operator==(StringId _rhs) const noexcept;
+		constexpr bool operator!=(StringId _rhs) const noexcept;
+		constexpr bool operator<(StringId _rhs) const noexcept;
+	};
+
+
+	/**
+	*	\brief Hash functor specialization for StringId: mix the FNV ID.
+	*/
+	template <>
+	struct Hash<StringId>
+	{
+		constexpr uint64 operator()(StringId _id) const noexcept;
+	};
+
+
+	/**
+	*	\brief Sapphire compile-time StringId macro.
+	*
+	*	Force hash computation at compile-time (even in unoptimized builds).
+	*
+	*	\param[in] _str		String literal.
+	*/
+	#define SA_STRING_ID(_str) Sa::StringId::FromId(std::integral_constant<Sa::uint64, Sa::StringId::Hash(_str)>::value)
+
+
+	/** \} */
+}
+
+#include <Core/Misc/StringId.inl>
+
+#endif // GUARD
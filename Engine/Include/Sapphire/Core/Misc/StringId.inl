@@ -0,0 +1,86 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	constexpr StringId::StringId() noexcept : mId{ sOffsetBasis }
+	{
+	}
+
+	template <typename CharT>
+	constexpr StringId::StringId(const CharT* _str) noexcept : mId{ Hash(_str) }
+	{
+	}
+
+	template <typename CharT>
+	StringId::StringId(const std::basic_string<CharT>& _str) noexcept : mId{ Hash(_str.data(), _str.size()) }
+	{
+	}
+
+
+	constexpr uint64 StringId::GetId() const noexcept
+	{
+		return mId;
+	}
+
+	constexpr bool StringId::IsEmpty() const noexcept
+	{
+		return mId == sOffsetBasis;
+	}
+
+
+	constexpr StringId StringId::FromId(uint64 _id) noexcept
+	{
+		StringId result;
+		result.mId = _id;
+
+		return result;
+	}
+
+	template <typename CharT>
+	constexpr uint64 StringId::Hash(const CharT* _str, uint64 _size) noexcept
+	{
+		using UCharT = std::make_unsigned_t<CharT>;
+
+		uint64 result = sOffsetBasis;
+
+		for (uint64 i = 0u; i < _size; ++i)
+			result = (result ^ static_cast<UCharT>(_str[i])) * sPrime;
+
+		return result;
+	}
+
+	template <typename CharT>
+	constexpr uint64 StringId::Hash(const CharT* _str) noexcept
+	{
+		using UCharT = std::make_unsigned_t<CharT>;
+
+		uint64 result = sOffsetBasis;
+
+		for (; *_str; ++_str)
+			result = (result ^ static_cast<UCharT>(*_str)) * sPrime;
+
+		return result;
+	}
+
+
+	constexpr bool StringId::operator==(StringId _rhs) const noexcept
+	{
+		return mId == _rhs.mId;
+	}
+
+	constexpr bool StringId::operator!=(StringId _rhs) const noexcept
+	{
+		return mId != _rhs.mId;
+	}
+
+	constexpr bool StringId::operator<(StringId _rhs) const noexcept
+	{
+		return mId < _rhs.mId;
+	}
+
+
+	constexpr uint64 Hash<StringId>::operator()(StringId _id) const noexcept
+	{
+		return HashMix(_id.GetId());
+	}
+}
@@ -54,6 +54,42 @@
 #endif
 
 
+#if SA_GNU || SA_CLANG
+
+	/// Sapphire no inline function attribute preprocessor.
+	#define SA_NOINLINE __attribute__((noinline))
+
+	/// Sapphire rarely called function attribute preprocessor (moved out of hot code).
+	#define SA_COLD __attribute__((cold))
+
+	/// Sapphire unlikely branch condition preprocessor.
+	#define SA_UNLIKELY(_cond) __builtin_expect(!!(_cond), 0)
+
+#elif SA_MSVC
+
+	/// Sapphire no inline function attribute preprocessor.
+	#define SA_NOINLINE __declspec(noinline)
+
+	/// Sapphire rarely called function attribute preprocessor (moved out of hot code).
+	#define SA_COLD
+
+	/// Sapphire unlikely branch condition preprocessor.
+	#define SA_UNLIKELY(_cond) (_cond)
+
+#else
+
+	/// Sapphire no inline function attribute preprocessor.
+	#define SA_NOINLINE
+
+	/// Sapphire rarely called function attribute preprocessor (moved out of hot code).
+	#define SA_COLD
+
+	/// Sapphire unlikely branch condition preprocessor.
+	#define SA_UNLIKELY(_cond) (_cond)
+
+#endif
+
+
 /** \} */
 
 #endif // GUARD
@@ -29,6 +29,9 @@
 
 	SA_PRAGMA_EDWARN()
 
+	// WinBase.h empty macro: breaks Thread::Yield().
+	#undef Yield
+
 #endif
 
 
@@ -7,8 +7,12 @@
 
 #include <atomic>
 
+#include <Core/Support/EngineAPI.hpp>
+
 #include <Core/Types/Int.hpp>
 
+#include <Core/Thread/MemoryOrder.hpp>
+
 namespace Sa
 {
 	/**
@@ -20,6 +24,44 @@ namespace Sa
 	*	\{
 	*/
 
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/**
+		*	\brief Block the calling thread while the 32 bits value at _address equals _old.
+		*
+		*	futex (Linux) / WaitOnAddress (Windows) backed. May wake up spuriously.
+		*
+		*	\param[in] _address	Address of the watched 32 bits value.
+		*	\param[in] _old		Value to wait a change from.
+		*/
+		SA_ENGINE_API void AtomicWait(const void* _address, uint32 _old) noexcept;
+
+		/**
+		*	\brief Wake threads blocked in AtomicWait() on _address.
+		*
+		*	\param[in] _address	Address of the watched 32 bits value.
+		*	\param[in] _bAll		Wake all waiting threads or only one.
+		*/
+		SA_ENGINE_API void AtomicWake(const void* _address, bool _bAll) noexcept;
+
+		/**
+		*	\brief \e Getter of the wait counter associated to _address.
+		*
+		*	Used to Wait() on values which are not 32 bits: waiters block on this counter instead.
+		*	Counters are shared between addresses (hashed table).
+		*
+		*	\param[in] _address	Address of the watched atomic.
+		*
+		*	\return wait counter of _address.
+		*/
+		SA_ENGINE_API std::atomic<uint32>& GetAtomicWaitCounter(const void* _address) noexcept;
+	}
+
+	/// \endcond Internal
+
+
 	/**
 	*	\brief Handle of the \e std::atomic standard class.
 	*
@@ -46,7 +88,7 @@ namespace Sa
 		*
 		*	\param[in] _value	Value to assign to the handle.
 		*/
-		Atomic(T _value) noexcept;
+		constexpr Atomic(T _value) noexcept;
 
 		/**
 		*	\brief \b Deleted \b move constructor.
@@ -64,9 +106,11 @@ namespace Sa
 		*
 		*	Wrap the load() function.
 		*
+		*	\param[in] _order	Memory ordering (Relaxed, Consume, Acquire or SeqCst).
+		*
 		*	\return the handled value.
 		*/
-		T Get() const noexcept;
+		T Get(MemoryOrder _order = MemoryOrder::SeqCst) const noexcept;
 
 		/**
 		*	\brief \e Setter of the handled value.
@@ -74,17 +118,147 @@ namespace Sa
 		*	Wrap the store function.
 		*
 		*	\param[in] _value	New value to set.
+		*	\param[in] _order	Memory ordering (Relaxed, Release or SeqCst).
 		*/
-		void Set(T _value) noexcept;
+		void Set(T _value, MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
 
 		/**
 		*	\brief Perform a Get and Set operation.
 		*
 		*	\param[in] _value	New value to set.
+		*	\param[in] _order	Memory ordering.
 		*
 		*	\return The previous handled value.
 		*/
-		T Exchange(T _value);
+		T Exchange(T _value, MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
+
+
+		/**
+		*	\brief Set _desired if the handled value equals _expected.
+		*
+		*	Weak version: may fail spuriously, use in a loop.
+		*
+		*	\param[in, out] _expected	Expected value. Set to the current value on failure.
+		*	\param[in] _desired		New value to set on success.
+		*	\param[in] _order			Memory ordering of both success and failure.
+		*
+		*	\return true on success.
+		*/
+		bool CompareExchangeWeak(T& _expected, T _desired, MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
+
+		/**
+		*	\brief Set _desired if the handled value equals _expected.
+		*
+		*	Weak version: may fail spuriously, use in a loop.
+		*
+		*	\param[in, out] _expected	Expected value. Set to the current value on failure.
+		*	\param[in] _desired		New value to set on success.
+		*	\param[in] _success		Memory ordering of the read-modify-write on success.
+		*	\param[in] _failure		Memory ordering of the load on failure (no Release nor AcqRel).
+		*
+		*	\return true on success.
+		*/
+		bool CompareExchangeWeak(T& _expected, T _desired, MemoryOrder _success, MemoryOrder _failure) noexcept;
+
+		/**
+		*	\brief Set _desired if the handled value equals _expected.
+		*
+		*	\param[in, out] _expected	Expected value. Set to the current value on failure.
+		*	\param[in] _desired		New value to set on success.
+		*	\param[in] _order			Memory ordering of both success and failure.
+		*
+		*	\return true on success.
+		*/
+		bool CompareExchangeStrong(T& _expected, T _desired, MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
+
+		/**
+		*	\brief Set _desired if the handled value equals _expected.
+		*
+		*	\param[in, out] _expected	Expected value. Set to the current value on failure.
+		*	\param[in] _desired		New value to set on success.
+		*	\param[in] _success		Memory ordering of the read-modify-write on success.
+		*	\param[in] _failure		Memory ordering of the load on failure (no Release nor AcqRel).
+		*
+		*	\return true on success.
+		*/
+		bool CompareExchangeStrong(T& _expected, T _desired, MemoryOrder _success, MemoryOrder _failure) noexcept;
+
+
+		/**
+		*	\brief Perform \b atomic \e addition.
+		*
+		*	\param[in] _value	Value to \e add.
+		*	\param[in] _order	Memory ordering.
+		*
+		*	\return previous handled value.
+		*/
+		T FetchAdd(T _value, MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
+
+		/**
+		*	\brief Perform \b atomic \e substraction.
+		*
+		*	\param[in] _value	Value to \e substract.
+		*	\param[in] _order	Memory ordering.
+		*
+		*	\return previous handled value.
+		*/
+		T FetchSub(T _value, MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
+
+		/**
+		*	\brief Perform \b atomic <em>bitwise and</em>.
+		*
+		*	\param[in] _value	Value to perform <em>bitwise and</em> with.
+		*	\param[in] _order	Memory ordering.
+		*
+		*	\return previous handled value.
+		*/
+		T FetchAnd(T _value, MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
+
+		/**
+		*	\brief Perform \b atomic <em>bitwise or</em>.
+		*
+		*	\param[in] _value	Value to perform <em>bitwise or</em> with.
+		*	\param[in] _order	Memory ordering.
+		*
+		*	\return previous handled value.
+		*/
+		T FetchOr(T _value, MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
+
+		/**
+		*	\brief Perform \b atomic <em>bitwise exclusive or</em>.
+		*
+		*	\param[in] _value	Value to perform <em>bitwise exclusive or</em> with.
+		*	\param[in] _order	Memory ordering.
+		*
+		*	\return previous handled value.
+		*/
+		T FetchXor(T _value, MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
+
+
+		/**
+		*	\brief Block the calling thread until the handled value is different from _old.
+		*
+		*	Park the thread (no busy waiting) until a NotifyOne() / NotifyAll() call.
+		*	Return immediately if the value already differs.
+		*
+		*	\param[in] _old		Value to wait a change from.
+		*	\param[in] _order	Memory ordering of the value loads (Relaxed, Acquire or SeqCst).
+		*/
+		void Wait(T _old, MemoryOrder _order = MemoryOrder::SeqCst) const noexcept;
+
+		/**
+		*	\brief Wake at least one thread blocked in Wait().
+		*
+		*	Call after modifying the value.
+		*/
+		void NotifyOne() noexcept;
+
+		/**
+		*	\brief Wake all threads blocked in Wait().
+		*
+		*	Call after modifying the value.
+		*/
+		void NotifyAll() noexcept;
 
 
 		/**
@@ -1,28 +1,149 @@
 // Copyright 2020 Sapphire development team. All Rights Reserved.
 
+#include <cstring>
+
 namespace Sa
 {
 	template <typename T>
-	Atomic<T>::Atomic(T _value) noexcept : mHandle{ _value }
+	constexpr Atomic<T>::Atomic(T _value) noexcept : mHandle{ _value }
 	{
 	}
 
 	template <typename T>
-	T Atomic<T>::Get() const noexcept
+	T Atomic<T>::Get(MemoryOrder _order) const noexcept
 	{
-		return mHandle.load();
+		return mHandle.load(ToStdMemoryOrder(_order));
 	}
 
 	template <typename T>
-	void Atomic<T>::Set(T _value) noexcept
+	void Atomic<T>::Set(T _value, MemoryOrder _order) noexcept
 	{
-		mHandle.store(_value);
+		mHandle.store(_value, ToStdMemoryOrder(_order));
 	}
 	
 	template <typename T>
-	T Atomic<T>::Exchange(T _value)
+	T Atomic<T>::Exchange(T _value, MemoryOrder _order) noexcept
+	{
+		return mHandle.exchange(_value, ToStdMemoryOrder(_order));
+	}
+
+
+	template <typename T>
+	bool Atomic<T>::CompareExchangeWeak(T& _expected, T _desired, MemoryOrder _order) noexcept
+	{
+		return mHandle.compare_exchange_weak(_expected, _desired, ToStdMemoryOrder(_order));
+	}
+
+	template <typename T>
+	bool Atomic<T>::CompareExchangeWeak(T& _expected, T _desired, MemoryOrder _success, MemoryOrder _failure) noexcept
+	{
+		return mHandle.compare_exchange_weak(_expected, _desired, ToStdMemoryOrder(_success), ToStdMemoryOrder(_failure));
+	}
+
+	template <typename T>
+	bool Atomic<T>::CompareExchangeStrong(T& _expected, T _desired, MemoryOrder _order) noexcept
+	{
+		return mHandle.compare_exchange_strong(_expected, _desired, ToStdMemoryOrder(_order));
+	}
+
+	template <typename T>
+	bool Atomic<T>::CompareExchangeStrong(T& _expected, T _desired, MemoryOrder _success, MemoryOrder _failure) noexcept
+	{
+		return mHandle.compare_exchange_strong(_expected, _desired, ToStdMemoryOrder(_success), ToStdMemoryOrder(_failure));
+	}
+
+
+	template <typename T>
+	T Atomic<T>::FetchAdd(T _value, MemoryOrder _order) noexcept
+	{
+		return mHandle.fetch_add(_value, ToStdMemoryOrder(_order));
+	}
+
+	template <typename T>
+	T Atomic<T>::FetchSub(T _value, MemoryOrder _order) noexcept
+	{
+		return mHandle.fetch_sub(_value, ToStdMemoryOrder(_order));
+	}
+
+	template <typename T>
+	T Atomic<T>::FetchAnd(T _value, MemoryOrder _order) noexcept
+	{
+		return mHandle.fetch_and(_value, ToStdMemoryOrder(_order));
+	}
+
+	template <typename T>
+	T Atomic<T>::FetchOr(T _value, MemoryOrder _order) noexcept
+	{
+		return mHandle.fetch_or(_value, ToStdMemoryOrder(_order));
+	}
+
+	template <typename T>
+	T Atomic<T>::FetchXor(T _value, MemoryOrder _order) noexcept
+	{
+		return mHandle.fetch_xor(_value, ToStdMemoryOrder(_order));
+	}
+
+
+	template <typename T>
+	void Atomic<T>::Wait(T _old, MemoryOrder _order) const noexcept
+	{
+		if constexpr (sizeof(std::atomic<T>) == sizeof(uint32))
+		{
+			uint32 oldBits = 0u;
+			std::memcpy(&oldBits, &_old, sizeof(uint32));
+
+			// Kernel re-checks the value atomically: no lost wake-up.
+			while (Get(_order) == _old)
+				Internal::AtomicWait(&mHandle, oldBits);
+		}
+		else
+		{
+			// Loads must be SeqCst to be ordered with the wait counter.
+			(void)_order;
+
+			std::atomic<uint32>& counter = Internal::GetAtomicWaitCounter(&mHandle);
+
+			while (true)
+			{
+				// Read the counter before the value: a notify in-between changes the counter.
+				const uint32 count = counter.load(std::memory_order_seq_cst);
+
+				if (Get(MemoryOrder::SeqCst) != _old)
+					break;
+
+				Internal::AtomicWait(&counter, count);
+			}
+		}
+	}
+
+	template <typename T>
+	void Atomic<T>::NotifyOne() noexcept
 	{
-		return mHandle.exchange(_value);
+		if constexpr (sizeof(std::atomic<T>) == sizeof(uint32))
+			Internal::AtomicWake(&mHandle, false);
+		else
+		{
+			std::atomic<uint32>& counter = Internal::GetAtomicWaitCounter(&mHandle);
+
+			counter.fetch_add(1u, std::memory_order_seq_cst);
+
+			// Counter may be shared with other addresses: wake everyone.
+			Internal::AtomicWake(&counter, true);
+		}
+	}
+
+	template <typename T>
+	void Atomic<T>::NotifyAll() noexcept
+	{
+		if constexpr (sizeof(std::atomic<T>) == sizeof(uint32))
+			Internal::AtomicWake(&mHandle, true);
+		else
+		{
+			std::atomic<uint32>& counter = Internal::GetAtomicWaitCounter(&mHandle);
+
+			counter.fetch_add(1u, std::memory_order_seq_cst);
+			Internal::AtomicWake(&counter, true);
+		}
 	}
 
 	template <typename T>
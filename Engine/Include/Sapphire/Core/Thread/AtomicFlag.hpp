@@ -0,0 +1,118 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_ATOMIC_FLAG_GUARD
+#define SAPPHIRE_CORE_ATOMIC_FLAG_GUARD
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file AtomicFlag.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>Atomic Flag</b> type.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Lock-free boolean flag.
+	*
+	*	Stored on 32 bits so Wait() directly parks on the flag (futex).
+	*	Building block for spin locks and one-shot signals.
+	*/
+	class AtomicFlag
+	{
+		/// Flag value: 0 cleared, 1 set.
+		Atomic<uint32> mHandle = 0u;
+
+	public:
+		/**
+		*	\brief \b Default constructor: cleared flag.
+		*/
+		AtomicFlag() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		AtomicFlag(AtomicFlag&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		AtomicFlag(const AtomicFlag&) = delete;
+
+
+		/**
+		*	\brief \e Getter of the flag value.
+		*
+		*	\param[in] _order	Memory ordering (Relaxed, Acquire or SeqCst).
+		*
+		*	\return whether the flag is set.
+		*/
+		bool Test(MemoryOrder _order = MemoryOrder::SeqCst) const noexcept;
+
+		/**
+		*	\brief Set the flag.
+		*
+		*	\param[in] _order	Memory ordering.
+		*
+		*	\return previous value of the flag.
+		*/
+		bool TestAndSet(MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
+
+		/**
+		*	\brief Clear the flag.
+		*
+		*	\param[in] _order	Memory ordering (Relaxed, Release or SeqCst).
+		*/
+		void Clear(MemoryOrder _order = MemoryOrder::SeqCst) noexcept;
+
+
+		/**
+		*	\brief Block the calling thread until the flag value is different from _old.
+		*
+		*	\param[in] _old		Value to wait a change from.
+		*	\param[in] _order	Memory ordering of the value loads.
+		*/
+		void Wait(bool _old, MemoryOrder _order = MemoryOrder::SeqCst) const noexcept;
+
+		/**
+		*	\brief Wake at least one thread blocked in Wait().
+		*/
+		void NotifyOne() noexcept;
+
+		/**
+		*	\brief Wake all threads blocked in Wait().
+		*/
+		void NotifyAll() noexcept;
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		AtomicFlag& operator=(AtomicFlag&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		AtomicFlag& operator=(const AtomicFlag&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/AtomicFlag.inl>
+
+#endif // GUARD
@@ -0,0 +1,35 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	inline bool AtomicFlag::Test(MemoryOrder _order) const noexcept
+	{
+		return mHandle.Get(_order) != 0u;
+	}
+
+	inline bool AtomicFlag::TestAndSet(MemoryOrder _order) noexcept
+	{
+		return mHandle.Exchange(1u, _order) != 0u;
+	}
+
+	inline void AtomicFlag::Clear(MemoryOrder _order) noexcept
+	{
+		mHandle.Set(0u, _order);
+	}
+
+
+	inline void AtomicFlag::Wait(bool _old, MemoryOrder _order) const noexcept
+	{
+		mHandle.Wait(_old ? 1u : 0u, _order);
+	}
+
+	inline void AtomicFlag::NotifyOne() noexcept
+	{
+		mHandle.NotifyOne();
+	}
+
+	inline void AtomicFlag::NotifyAll() noexcept
+	{
+		mHandle.NotifyAll();
+	}
+}
@@ -0,0 +1,34 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_CACHE_LINE_GUARD
+#define SAPPHIRE_CORE_CACHE_LINE_GUARD
+
+#include <Core/Types/Int.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file CacheLine.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>cache line</b> constants.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Size (in bytes) of a CPU cache line.
+	*
+	*	Used to pad data shared between threads and avoid false sharing.
+	*	64 bytes is the line size of every supported x86_64 and arm64 target.
+	*/
+	constexpr uint32 CacheLineSize = 64u;
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,56 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_CPU_PAUSE_GUARD
+#define SAPPHIRE_CORE_CPU_PAUSE_GUARD
+
+#include <Core/Support/Compilers.hpp>
+#include <Core/Support/Architectures.hpp>
+
+#if SA_x64
+
+	#include <immintrin.h>
+
+#endif
+
+namespace Sa
+{
+	/**
+	*	\file CpuPause.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>CPU pause</b> hint.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Hint the CPU the calling thread is in a spin-wait loop.
+	*
+	*	Reduce power and pipeline flush cost of busy waiting (pause / yield instruction).
+	*	Does not give up the time slice: use Thread::Yield() for that.
+	*/
+	inline void CpuPause() noexcept
+	{
+#if SA_x64
+
+		_mm_pause();
+
+#elif SA_ARM || defined(__aarch64__)
+
+	#if SA_MSVC
+		__yield();
+	#else
+		__asm__ __volatile__("yield");
+	#endif
+
+#endif
+	}
+
+
+	/** \} */
+}
+
+#endif // GUARD
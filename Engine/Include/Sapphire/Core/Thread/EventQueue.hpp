@@ -0,0 +1,197 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_EVENT_QUEUE_GUARD
+#define SAPPHIRE_CORE_EVENT_QUEUE_GUARD
+
+#include <Collections/Debug>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/Thread.hpp>
+#include <Core/Thread/SPSCQueue.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file EventQueue.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>deferred event queue</b> type.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Deferred <b>multi-producer single-consumer</b> event queue.
+	*
+	*	Any thread can Push() typed events: each producer thread owns a lock-free SPSC buffer
+	*	(lazily allocated on its first Push()), so producers never contend with each other.
+	*	Events are handled in batch by Dispatch() at a chosen sync point (ex: start of frame),
+	*	keeping the handling code single-writer.
+	*
+	*	Events of a same thread are dispatched in push order. No order between threads.
+	*	A buffer is bound to its producer thread until the thread exits: Dispatch() then recycles
+	*	the drained buffer for another thread. maxThreadNum bounds the number of simultaneous
+	*	producer threads.
+	*
+	*	\tparam T				Type of event. Must be default constructible and move assignable.
+	*	\tparam threadCapacity	Max number of pending events per producer thread. Must be a power of 2.
+	*	\tparam maxThreadNum	Max number of simultaneous producer threads.
+	*/
+	template <typename T, uint32 threadCapacity = 256u, uint32 maxThreadNum = 32u>
+	class EventQueue
+	{
+		/// \cond Internal
+
+		/// Producer thread buffer, shared by the queue and its owner thread.
+		struct Buffer
+		{
+			/// Pending events.
+			SPSCQueue<T, threadCapacity> events;
+
+			/// References: 2 claimed, 1 orphan (owner exited or queue destroyed), 0 free for reuse.
+			Atomic<uint32> refNum = 0u;
+
+			/// Queue of this buffer (nullptr once the queue is destroyed).
+			Atomic<const EventQueue*> queue = nullptr;
+
+			/// Next buffer owned by the same thread (owner thread only).
+			Buffer* nextOwned = nullptr;
+		};
+
+		/// Buffers owned by the calling thread: released on thread exit.
+		struct ThreadBuffers
+		{
+			Buffer* head = nullptr;
+
+			~ThreadBuffers();
+		};
+
+		/// Producer thread buffer slot.
+		struct Slot
+		{
+			/// ID of the thread owning this slot.
+			Atomic<uint32> ownerID = Thread::InvalidID;
+
+			/// Buffer of the owner thread (published after ownerID, kept on recycling).
+			Atomic<Buffer*> buffer = nullptr;
+		};
+
+		/// \endcond Internal
+
+		/// Producer slots (open addressing on thread ID).
+		Slot mSlots[maxThreadNum];
+
+		/// Calling thread's buffers (of every queue of this type).
+		static thread_local ThreadBuffers sThreadBuffers;
+
+		/**
+		*	\brief Get (or claim) the buffer of the calling thread.
+		*
+		*	\return buffer of the calling thread, nullptr if no slot is available.
+		*/
+		Buffer* GetThreadBuffer();
+
+		/**
+		*	\brief Drop one reference of _buffer, delete it on last.
+		*
+		*	\param[in] _buffer		Buffer to release.
+		*/
+		static void Release(Buffer* _buffer) noexcept;
+
+		/**
+		*	\brief Make the slot of an exited producer claimable again (consumer thread only).
+		*
+		*	\param[in] _slot		Slot of a drained orphan buffer.
+		*/
+		static void Recycle(Slot& _slot) noexcept;
+
+	public:
+		/// Number of events popped at once by Dispatch().
+		static constexpr uint32 DispatchBatchNum = 32u;
+
+		/**
+		*	\brief \b Default constructor.
+		*/
+		EventQueue() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		EventQueue(EventQueue&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		EventQueue(const EventQueue&) = delete;
+
+		/**
+		*	\brief \e Destructor: release every thread buffer (freed once its owner thread exited).
+		*/
+		~EventQueue();
+
+
+		/**
+		*	\brief Whether the queue is (approximately) empty.
+		*
+		*	\return true if no event is pending at the time of the call.
+		*/
+		bool IsEmpty() const noexcept;
+
+		/**
+		*	\brief \b Push an event (any thread).
+		*
+		*	Lock-free and allocation-free, except for the first Push() of a thread.
+		*
+		*	\param[in] _event	Event to push.
+		*
+		*	\return false if the thread buffer is full (event dropped).
+		*/
+		bool Push(T _event);
+
+		/**
+		*	\brief \b Dispatch every pending event (consumer thread only).
+		*
+		*	Only events pushed before the call are dispatched:
+		*	events pushed by _handler are kept for the next Dispatch().
+		*
+		*	\tparam F			Handler type.
+		*	\param[in] _handler	Handler called with each event: void(T&).
+		*
+		*	\return number of dispatched events.
+		*/
+		template <typename F>
+		uint32 Dispatch(F&& _handler);
+
+		/**
+		*	\brief \b Drop every pending event (consumer thread only).
+		*/
+		void Clear();
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		EventQueue& operator=(EventQueue&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		EventQueue& operator=(const EventQueue&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/EventQueue.inl>
+
+#endif // GUARD
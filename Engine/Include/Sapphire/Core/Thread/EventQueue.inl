@@ -0,0 +1,192 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	template <typename T, uint32 threadCapacity, uint32 maxThreadNum>
+	thread_local typename EventQueue<T, threadCapacity, maxThreadNum>::ThreadBuffers EventQueue<T, threadCapacity, maxThreadNum>::sThreadBuffers;
+
+
+	template <typename T, uint32 threadCapacity, uint32 maxThreadNum>
+	EventQueue<T, threadCapacity, maxThreadNum>::ThreadBuffers::~ThreadBuffers()
+	{
+		while (head)
+		{
+			Buffer* const buffer = head;
+			head = buffer->nextOwned;
+
+			buffer->nextOwned = nullptr;
+
+			// Publish the last pushes: the consumer drains the orphan buffer before recycling it.
+			Release(buffer);
+		}
+	}
+
+
+	template <typename T, uint32 threadCapacity, uint32 maxThreadNum>
+	EventQueue<T, threadCapacity, maxThreadNum>::~EventQueue()
+	{
+		for (uint32 i = 0u; i < maxThreadNum; ++i)
+		{
+			Buffer* const buffer = mSlots[i].buffer.Get(MemoryOrder::Acquire);
+
+			if (!buffer)
+				continue;
+
+			// A live owner thread keeps the buffer in its list until exit: never match a new queue at this address.
+			buffer->queue.Set(nullptr, MemoryOrder::Relaxed);
+
+			// Free (recycled) buffers are only referenced by the queue.
+			if (buffer->refNum.Get(MemoryOrder::Acquire) == 0u)
+				delete buffer;
+			else
+				Release(buffer);
+		}
+	}
+
+
+	template <typename T, uint32 threadCapacity, uint32 maxThreadNum>
+	typename EventQueue<T, threadCapacity, maxThreadNum>::Buffer* EventQueue<T, threadCapacity, maxThreadNum>::GetThreadBuffer()
+	{
+		// Already claimed by this thread (usually a single buffer).
+		for (Buffer* buffer = sThreadBuffers.head; buffer; buffer = buffer->nextOwned)
+		{
+			if (buffer->queue.Get(MemoryOrder::Relaxed) == this)
+				return buffer;
+		}
+
+		const uint32 threadID = Thread::GetCurrentID();
+
+		for (uint32 i = 0u; i < maxThreadNum; ++i)
+		{
+			Slot& slot = mSlots[(threadID + i) % maxThreadNum];
+
+			uint32 ownerID = Thread::InvalidID;
+
+			// Acquire: pair with Recycle() to reuse the drained buffer of a previous owner.
+			if (!slot.ownerID.CompareExchangeStrong(ownerID, threadID, MemoryOrder::AcqRel, MemoryOrder::Relaxed))
+				continue;
+
+			Buffer* buffer = slot.buffer.Get(MemoryOrder::Acquire);
+
+			if (!buffer)
+				buffer = new Buffer();
+
+			buffer->queue.Set(this, MemoryOrder::Relaxed);
+			buffer->refNum.Set(2u, MemoryOrder::Release);
+
+			buffer->nextOwned = sThreadBuffers.head;
+			sThreadBuffers.head = buffer;
+
+			slot.buffer.Set(buffer, MemoryOrder::Release);
+
+			return buffer;
+		}
+
+		return nullptr;
+	}
+
+	template <typename T, uint32 threadCapacity, uint32 maxThreadNum>
+	void EventQueue<T, threadCapacity, maxThreadNum>::Release(Buffer* _buffer) noexcept
+	{
+		if (_buffer->refNum.FetchSub(1u, MemoryOrder::AcqRel) == 1u)
+			delete _buffer;
+	}
+
+	template <typename T, uint32 threadCapacity, uint32 maxThreadNum>
+	void EventQueue<T, threadCapacity, maxThreadNum>::Recycle(Slot& _slot) noexcept
+	{
+		Buffer* const buffer = _slot.buffer.Get(MemoryOrder::Relaxed);
+
+		// Orphan (1) to free (0): never seen as orphan again once claimed by a new thread.
+		buffer->refNum.Set(0u, MemoryOrder::Relaxed);
+		buffer->queue.Set(nullptr, MemoryOrder::Relaxed);
+
+		_slot.ownerID.Set(Thread::InvalidID, MemoryOrder::Release);
+	}
+
+
+	template <typename T, uint32 threadCapacity, uint32 maxThreadNum>
+	bool EventQueue<T, threadCapacity, maxThreadNum>::IsEmpty() const noexcept
+	{
+		for (uint32 i = 0u; i < maxThreadNum; ++i)
+		{
+			const Buffer* const buffer = mSlots[i].buffer.Get(MemoryOrder::Acquire);
+
+			if (buffer && !buffer->events.IsEmpty())
+				return false;
+		}
+
+		return true;
+	}
+
+	template <typename T, uint32 threadCapacity, uint32 maxThreadNum>
+	bool EventQueue<T, threadCapacity, maxThreadNum>::Push(T _event)
+	{
+		Buffer* const buffer = GetThreadBuffer();
+
+		SA_ASSERT(buffer, NotSupported, Tools, L"Too many EventQueue producer threads: increase maxThreadNum!");
+
+		return buffer && buffer->events.Push(Move(_event));
+	}
+
+	template <typename T, uint32 threadCapacity, uint32 maxThreadNum>
+	template <typename F>
+	uint32 EventQueue<T, threadCapacity, maxThreadNum>::Dispatch(F&& _handler)
+	{
+		uint32 dispatchNum = 0u;
+		T events[DispatchBatchNum];
+
+		for (uint32 i = 0u; i < maxThreadNum; ++i)
+		{
+			Buffer* const buffer = mSlots[i].buffer.Get(MemoryOrder::Acquire);
+
+			if (!buffer)
+				continue;
+
+			// Before the snapshot: every push of an exited owner is visible.
+			const bool bOrphan = buffer->refNum.Get(MemoryOrder::Acquire) == 1u;
+
+			// Snapshot: events pushed during dispatch are kept for next call.
+			uint32 remainNum = buffer->events.Size();
+
+			while (remainNum)
+			{
+				const uint32 popNum = buffer->events.PopBatch(events, remainNum < DispatchBatchNum ? remainNum : DispatchBatchNum);
+
+				if (popNum == 0u)
+					break;
+
+				for (uint32 j = 0u; j < popNum; ++j)
+					_handler(events[j]);
+
+				remainNum -= popNum;
+				dispatchNum += popNum;
+			}
+
+			if (bOrphan && buffer->events.IsEmpty())
+				Recycle(mSlots[i]);
+		}
+
+		return dispatchNum;
+	}
+
+	template <typename T, uint32 threadCapacity, uint32 maxThreadNum>
+	void EventQueue<T, threadCapacity, maxThreadNum>::Clear()
+	{
+		T events[DispatchBatchNum];
+
+		for (uint32 i = 0u; i < maxThreadNum; ++i)
+		{
+			if (Buffer* const buffer = mSlots[i].buffer.Get(MemoryOrder::Acquire))
+			{
+				const bool bOrphan = buffer->refNum.Get(MemoryOrder::Acquire) == 1u;
+
+				while (buffer->events.PopBatch(events, DispatchBatchNum))
+					;
+
+				if (bOrphan)
+					Recycle(mSlots[i]);
+			}
+		}
+	}
+}
@@ -0,0 +1,166 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_FUTEX_MUTEX_GUARD
+#define SAPPHIRE_CORE_FUTEX_MUTEX_GUARD
+
+#include <Core/Config.hpp>
+
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Misc/RAII.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/LockStats.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file FutexMutex.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>Futex Mutex</b> type.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Lightweight mutex built on Atomic::Wait() (futex).
+	*
+	*	Uncontended Lock() / Unlock() are a single atomic operation without system call.
+	*	On contention, spin briefly then park the thread in the kernel.
+	*	Reference: "Futexes Are Tricky" (Drepper, 2011).
+	*/
+	class FutexMutex
+	{
+		/// Unlocked state.
+		static constexpr uint32 sUnlocked = 0u;
+
+		/// Locked without waiter state.
+		static constexpr uint32 sLocked = 1u;
+
+		/// Locked with possible waiters state: Unlock() must wake a thread.
+		static constexpr uint32 sContended = 2u;
+
+		/// Lock state.
+		Atomic<uint32> mHandle = sUnlocked;
+
+#if SA_LOCK_STATS
+
+		/// Contention counters.
+		LockStats mStats;
+
+#endif
+
+		/**
+		*	\brief Contended Lock() path: spin then park until acquired.
+		*/
+		SA_ENGINE_API void LockSlow() noexcept;
+
+		/**
+		*	\brief Contended Unlock() path: wake a parked thread.
+		*/
+		SA_ENGINE_API void UnlockSlow() noexcept;
+
+	public:
+		/// Number of tries before parking the thread.
+		static constexpr uint32 SpinNum = 64u;
+
+		/**
+		*	\brief \b Default constructor.
+		*/
+		FutexMutex() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		FutexMutex(FutexMutex&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		FutexMutex(const FutexMutex&) = delete;
+
+
+		/**
+		*	\brief \b Locks the mutex, \b blocks if the mutex is not available.
+		*/
+		void Lock() noexcept;
+
+		/**
+		*	\brief \b Tries to \b lock the mutex.
+		*
+		*	\return true if the lock was acquired successfully, otherwise false.
+		*/
+		bool TryLock() noexcept;
+
+		/**
+		*	\brief \b Unlock the mutex.
+		*/
+		void Unlock() noexcept;
+
+#if SA_LOCK_STATS
+
+		/**
+		*	\e Getter of contention counters.
+		*
+		*	\return contention counters.
+		*/
+		LockStats& GetStats() noexcept;
+
+#endif
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance
+		*/
+		FutexMutex& operator=(FutexMutex&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance
+		*/
+		FutexMutex& operator=(const FutexMutex&) = delete;
+	};
+
+
+	/**
+	*	\brief RAII specialization for FutexMutex.
+	*
+	*	\implements RAII
+	*/
+	template <>
+	class RAII<FutexMutex> final : RAIIBase
+	{
+		/// The handled mutex.
+		FutexMutex& mHandle;
+
+	public:
+
+		/**
+		*	\brief Value constructor: \b Lock() the handled mutex.
+		*
+		*	\param[in, out] _mutex		FutexMutex to handle.
+		*/
+		RAII(FutexMutex& _mutex) noexcept;
+
+		/**
+		*	\brief Destructor: \b Unlock() the handled mutex.
+		*/
+		~RAII() noexcept;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/FutexMutex.inl>
+
+#endif // GUARD
@@ -0,0 +1,52 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	inline void FutexMutex::Lock() noexcept
+	{
+		uint32 expected = sUnlocked;
+
+		if (!mHandle.CompareExchangeStrong(expected, sLocked, MemoryOrder::Acquire, MemoryOrder::Relaxed))
+			LockSlow();
+
+		__SA_LOCK_STAT(mStats, lockNum);
+	}
+
+	inline bool FutexMutex::TryLock() noexcept
+	{
+		uint32 expected = sUnlocked;
+
+		if (!mHandle.CompareExchangeStrong(expected, sLocked, MemoryOrder::Acquire, MemoryOrder::Relaxed))
+			return false;
+
+		__SA_LOCK_STAT(mStats, lockNum);
+
+		return true;
+	}
+
+	inline void FutexMutex::Unlock() noexcept
+	{
+		if (mHandle.Exchange(sUnlocked, MemoryOrder::Release) == sContended)
+			UnlockSlow();
+	}
+
+#if SA_LOCK_STATS
+
+	inline LockStats& FutexMutex::GetStats() noexcept
+	{
+		return mStats;
+	}
+
+#endif
+
+
+	inline RAII<FutexMutex>::RAII(FutexMutex& _mutex) noexcept : mHandle{ _mutex }
+	{
+		mHandle.Lock();
+	}
+
+	inline RAII<FutexMutex>::~RAII() noexcept
+	{
+		mHandle.Unlock();
+	}
+}
@@ -0,0 +1,210 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_JOB_GUARD
+#define SAPPHIRE_CORE_JOB_GUARD
+
+#include <new> // placement new.
+
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Types/Int.hpp>
+#include <Core/Types/Extractions/RemoveRef.hpp>
+#include <Core/Types/Extractions/RemoveConstVol.hpp>
+
+#include <Core/Algorithms/Forward.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/CacheLine.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file Job.hpp
+	*
+	*	\brief \b Definition of Sapphire's \b Job and \b JobCounter types.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Waitable counter of pending jobs.
+	*
+	*	Incremented on job scheduling, decremented on job completion.
+	*	Use JobSystem::Wait() to wait for completion while executing other jobs.
+	*/
+	class JobCounter
+	{
+		/// Number of pending jobs.
+		Atomic<uint32> mCount = 0u;
+
+	public:
+		/**
+		*	\brief \b Default constructor.
+		*/
+		JobCounter() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		JobCounter(JobCounter&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		JobCounter(const JobCounter&) = delete;
+
+
+		/**
+		*	\brief \e Getter of the number of pending jobs.
+		*
+		*	\return number of pending jobs.
+		*/
+		SA_ENGINE_API uint32 GetPending() const noexcept;
+
+		/**
+		*	\brief Whether all the jobs have been completed.
+		*
+		*	\return true if there is no pending job.
+		*/
+		SA_ENGINE_API bool IsDone() const noexcept;
+
+
+		/**
+		*	\brief Add pending jobs.
+		*
+		*	\param[in] _num		Number of jobs to add.
+		*/
+		SA_ENGINE_API void Increment(uint32 _num = 1u) noexcept;
+
+		/**
+		*	\brief Mark one job as completed.
+		*/
+		SA_ENGINE_API void Decrement() noexcept;
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		JobCounter& operator=(JobCounter&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		JobCounter& operator=(const JobCounter&) = delete;
+	};
+
+
+	/**
+	*	\brief Sapphire's \b Job class.
+	*
+	*	Store a callable inline (no heap allocation) with its optional JobCounter.
+	*	Jobs are allocated and recycled by the JobSystem.
+	*/
+	class alignas(CacheLineSize) Job
+	{
+	public:
+		/// Total size of a Job (in bytes).
+		static constexpr uint32 Size = 2u * CacheLineSize;
+
+		/// Max size (in bytes) of the stored callable.
+		static constexpr uint32 DataSize = Size - 4u * sizeof(void*);
+
+	private:
+		/// Inline storage of the callable.
+		alignas(16) uint8 mData[DataSize];
+
+		/// Execute and destroy the callable stored in mData.
+		void(*mInvoke)(void*) = nullptr;
+
+		/// Optional counter to decrement on completion.
+		JobCounter* mCounter = nullptr;
+
+		/// Whether this job is scheduled and not yet completed.
+		Atomic<bool> mPending = false;
+
+	public:
+		/**
+		*	\brief \b Default constructor.
+		*/
+		Job() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		Job(Job&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		Job(const Job&) = delete;
+
+
+		/**
+		*	\brief Whether this job is scheduled and not yet completed.
+		*
+		*	\return true if pending.
+		*/
+		SA_ENGINE_API bool IsPending() const noexcept;
+
+		/**
+		*	\brief Atomically mark this job as pending if it is free.
+		*
+		*	Must succeed before Set(): the slot then belongs to the caller until completion.
+		*
+		*	\return true if claimed, false if already pending.
+		*/
+		SA_ENGINE_API bool TryClaim() noexcept;
+
+		/**
+		*	\brief \e Setter of the callable to execute.
+		*
+		*	The callable is moved into the job inline storage.
+		*	_counter is incremented.
+		*	The job must have been claimed with TryClaim().
+		*
+		*	\tparam F			Type of the callable.
+		*
+		*	\param[in] _func		Callable to execute: void().
+		*	\param[in] _counter		Optional counter to track completion.
+		*/
+		template <typename F>
+		void Set(F&& _func, JobCounter* _counter = nullptr);
+
+		/**
+		*	\brief \b Execute the stored callable.
+		*
+		*	Destroy the callable and decrement the counter afterward.
+		*/
+		SA_ENGINE_API void Execute();
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		Job& operator=(Job&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		Job& operator=(const Job&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/Job.inl>
+
+#endif // GUARD
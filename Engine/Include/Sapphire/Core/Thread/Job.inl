@@ -0,0 +1,29 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	template <typename F>
+	void Job::Set(F&& _func, JobCounter* _counter)
+	{
+		using FuncT = RemoveConstVol<RemoveRef<F>>;
+
+		static_assert(sizeof(FuncT) <= DataSize, "Job callable too big: capture pointers or references instead!");
+		static_assert(alignof(FuncT) <= 16u, "Job callable alignment not supported!");
+
+		new(mData) FuncT(Forward<F>(_func));
+
+		mInvoke = [](void* _data)
+		{
+			FuncT* func = reinterpret_cast<FuncT*>(_data);
+
+			(*func)();
+
+			func->~FuncT();
+		};
+
+		mCounter = _counter;
+
+		if (mCounter)
+			mCounter->Increment();
+	}
+}
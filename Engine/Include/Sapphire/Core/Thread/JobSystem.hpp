@@ -0,0 +1,125 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_JOB_SYSTEM_GUARD
+#define SAPPHIRE_CORE_JOB_SYSTEM_GUARD
+
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Thread/Job.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file JobSystem.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>Job System</b>.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Static engine-wide <b>work-stealing</b> job system.
+	*
+	*	Spawn one worker per hardware thread (the thread calling Init() is worker 0).
+	*	Each worker owns a lock-free work-stealing deque: jobs are pushed on the local deque
+	*	and idle workers steal from the others.
+	*	Jobs scheduled from a non-worker thread go through a shared locked queue.
+	*/
+	class JobSystem
+	{
+		/**
+		*	\brief \e Getter of a free job of the current thread's pool.
+		*
+		*	\return allocated job.
+		*/
+		SA_ENGINE_API static Job* AllocateJob();
+
+		/**
+		*	\brief \b Submit an allocated job for execution.
+		*
+		*	\param[in] _job		Job to submit.
+		*/
+		SA_ENGINE_API static void Submit(Job* _job);
+
+	public:
+		/// Max number of pending jobs per worker (power of 2).
+		static constexpr uint32 MaxJobNum = 4096u;
+
+		/**
+		*	\brief \b Initialize the job system and spawn worker threads.
+		*
+		*	\param[in] _workerNum	Number of workers (calling thread included). 0 == Thread::HardwareConcurrency().
+		*/
+		SA_ENGINE_API static void Init(uint32 _workerNum = 0u);
+
+		/**
+		*	\brief \b UnInitialize the job system: wait for pending jobs and join worker threads.
+		*/
+		SA_ENGINE_API static void UnInit();
+
+
+		/**
+		*	\brief Whether the job system is initialized.
+		*
+		*	\return true if Init() has been called.
+		*/
+		SA_ENGINE_API static bool IsInit() noexcept;
+
+		/**
+		*	\brief \e Getter of the number of workers (calling thread of Init() included).
+		*
+		*	\return number of workers.
+		*/
+		SA_ENGINE_API static uint32 GetWorkerNum() noexcept;
+
+		/**
+		*	\brief \e Getter of the worker index of the current thread.
+		*
+		*	\return worker index in [0, GetWorkerNum()[, or uint32(-1) for non-worker threads.
+		*/
+		SA_ENGINE_API static uint32 GetWorkerIndex() noexcept;
+
+
+		/**
+		*	\brief \b Schedule a callable for asynchronous execution.
+		*
+		*	Execute the callable immediately if the job system is not initialized.
+		*
+		*	\tparam F				Type of the callable.
+		*
+		*	\param[in] _func		Callable to execute: void().
+		*	\param[in] _counter		Optional counter to track completion.
+		*/
+		template <typename F>
+		static void Run(F&& _func, JobCounter* _counter = nullptr);
+
+		/**
+		*	\brief \b Wait for the counter to reach 0.
+		*
+		*	The calling thread executes other pending jobs while waiting.
+		*
+		*	\param[in] _counter		Counter to wait for.
+		*/
+		SA_ENGINE_API static void Wait(const JobCounter& _counter);
+
+		/**
+		*	\brief Try to execute one pending job on the calling thread.
+		*
+		*	\return true if a job has been executed.
+		*/
+		SA_ENGINE_API static bool TryExecuteOne();
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/JobSystem.inl>
+
+#endif // GUARD
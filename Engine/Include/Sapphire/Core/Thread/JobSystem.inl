@@ -0,0 +1,21 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	template <typename F>
+	void JobSystem::Run(F&& _func, JobCounter* _counter)
+	{
+		// Synchronous fallback.
+		if (!IsInit())
+		{
+			_func();
+			return;
+		}
+
+		Job* const job = AllocateJob();
+
+		job->Set(Forward<F>(_func), _counter);
+
+		Submit(job);
+	}
+}
@@ -0,0 +1,72 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_LOCK_STATS_GUARD
+#define SAPPHIRE_CORE_LOCK_STATS_GUARD
+
+#include <Core/Config.hpp>
+
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file LockStats.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>lock contention counters</b>.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Contention counters of a lock.
+	*
+	*	Only updated when SA_LOCK_STATS is enabled (default in debug).
+	*/
+	class LockStats
+	{
+	public:
+		/// Number of successful acquisitions.
+		Atomic<uint64> lockNum = 0u;
+
+		/// Number of acquisitions which found the lock already taken.
+		Atomic<uint64> contendedNum = 0u;
+
+		/// Number of times a thread yielded or was parked by the OS while waiting.
+		Atomic<uint64> sleepNum = 0u;
+
+
+		/**
+		*	\brief Reset all counters to 0.
+		*/
+		SA_ENGINE_API void Reset() noexcept;
+	};
+
+
+/// \cond Internal
+
+#if SA_LOCK_STATS
+
+	/// Increment a LockStats counter.
+	#define __SA_LOCK_STAT(_stats, _counter) (_stats)._counter.FetchAdd(1u, Sa::MemoryOrder::Relaxed)
+
+#else
+
+	#define __SA_LOCK_STAT(_stats, _counter)
+
+#endif
+
+/// \endcond Internal
+
+
+	/** \} */
+}
+
+#endif // GUARD
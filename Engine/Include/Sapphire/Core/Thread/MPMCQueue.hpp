@@ -0,0 +1,166 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_MPMC_QUEUE_GUARD
+#define SAPPHIRE_CORE_MPMC_QUEUE_GUARD
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Algorithms/Move.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/CacheLine.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file MPMCQueue.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>multi-producer multi-consumer queue</b> type.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Bounded lock-free <b>multi-producer multi-consumer</b> ring queue (Vyukov).
+	*
+	*	Each cell holds a sequence number telling whether it is ready to be written or read.
+	*	Producers and consumers only contend on their own index (separate cache lines).
+	*
+	*	\tparam T			Type of element. Must be default constructible and move assignable.
+	*	\tparam capacity	Max number of elements. Must be a power of 2.
+	*/
+	template <typename T, uint32 capacity>
+	class MPMCQueue
+	{
+		static_assert(capacity >= 2u && (capacity & (capacity - 1u)) == 0u, "MPMCQueue capacity must be a power of 2!");
+
+		/// \cond Internal
+
+		/// Ring buffer cell.
+		struct Cell
+		{
+			/// Sequence number: index when writable, index + 1 when readable.
+			Atomic<uint64> sequence;
+
+			/// Stored element.
+			T data;
+		};
+
+		/// \endcond Internal
+
+		/// Mask to wrap indices in mCells.
+		static constexpr uint64 sMask = capacity - 1u;
+
+		/// Next write index.
+		alignas(CacheLineSize) Atomic<uint64> mEnqueuePos = 0u;
+
+		/// Next read index.
+		alignas(CacheLineSize) Atomic<uint64> mDequeuePos = 0u;
+
+		/// Ring buffer of cells.
+		alignas(CacheLineSize) Cell mCells[capacity];
+
+	public:
+		/// Max number of elements.
+		static constexpr uint32 Capacity = capacity;
+
+		/**
+		*	\brief \b Default constructor.
+		*/
+		MPMCQueue() noexcept;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		MPMCQueue(MPMCQueue&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		MPMCQueue(const MPMCQueue&) = delete;
+
+
+		/**
+		*	\brief \e Getter of the approximate number of elements.
+		*
+		*	\return number of elements at the time of the call.
+		*/
+		uint32 Size() const noexcept;
+
+		/**
+		*	\brief Whether the queue is (approximately) empty.
+		*
+		*	\return true if empty at the time of the call.
+		*/
+		bool IsEmpty() const noexcept;
+
+
+		/**
+		*	\brief \b Push an element (any thread).
+		*
+		*	\param[in] _elem	Element to push.
+		*
+		*	\return false if the queue is full.
+		*/
+		bool Push(T _elem);
+
+		/**
+		*	\brief \b Push several elements at once (any thread).
+		*
+		*	Reserve a contiguous range of cells with a single CAS.
+		*
+		*	\param[in] _elems	Elements to push.
+		*	\param[in] _num		Number of elements in _elems.
+		*
+		*	\return number of elements pushed (less than _num if the queue got full).
+		*/
+		uint32 PushBatch(const T* _elems, uint32 _num);
+
+		/**
+		*	\brief \b Pop an element (any thread).
+		*
+		*	\param[out] _elem	Popped element.
+		*
+		*	\return false if the queue is empty.
+		*/
+		bool Pop(T& _elem);
+
+		/**
+		*	\brief \b Pop several elements at once (any thread).
+		*
+		*	Reserve a contiguous range of cells with a single CAS.
+		*
+		*	\param[out] _elems	Popped elements.
+		*	\param[in] _max		Max number of elements to pop (size of _elems).
+		*
+		*	\return number of elements popped.
+		*/
+		uint32 PopBatch(T* _elems, uint32 _max);
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		MPMCQueue& operator=(MPMCQueue&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		MPMCQueue& operator=(const MPMCQueue&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/MPMCQueue.inl>
+
+#endif // GUARD
@@ -0,0 +1,172 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	template <typename T, uint32 capacity>
+	MPMCQueue<T, capacity>::MPMCQueue() noexcept
+	{
+		for (uint32 i = 0u; i < capacity; ++i)
+			mCells[i].sequence.Set(i, MemoryOrder::Relaxed);
+	}
+
+
+	template <typename T, uint32 capacity>
+	uint32 MPMCQueue<T, capacity>::Size() const noexcept
+	{
+		const uint64 enqueuePos = mEnqueuePos.Get(MemoryOrder::Acquire);
+		const uint64 dequeuePos = mDequeuePos.Get(MemoryOrder::Acquire);
+
+		return enqueuePos > dequeuePos ? static_cast<uint32>(enqueuePos - dequeuePos) : 0u;
+	}
+
+	template <typename T, uint32 capacity>
+	bool MPMCQueue<T, capacity>::IsEmpty() const noexcept
+	{
+		return Size() == 0u;
+	}
+
+
+	template <typename T, uint32 capacity>
+	bool MPMCQueue<T, capacity>::Push(T _elem)
+	{
+		uint64 pos = mEnqueuePos.Get(MemoryOrder::Relaxed);
+		Cell* cell = nullptr;
+
+		while (true)
+		{
+			cell = &mCells[pos & sMask];
+
+			const uint64 seq = cell->sequence.Get(MemoryOrder::Acquire);
+			const int64 diff = static_cast<int64>(seq - pos);
+
+			if (diff == 0)
+			{
+				// Cell is writable: try to claim it.
+				if (mEnqueuePos.CompareExchangeWeak(pos, pos + 1u, MemoryOrder::Relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false; // Full: cell not consumed yet.
+			else
+				pos = mEnqueuePos.Get(MemoryOrder::Relaxed);
+		}
+
+		cell->data = Move(_elem);
+		cell->sequence.Set(pos + 1u, MemoryOrder::Release);
+
+		return true;
+	}
+
+	template <typename T, uint32 capacity>
+	uint32 MPMCQueue<T, capacity>::PushBatch(const T* _elems, uint32 _num)
+	{
+		uint64 pos = mEnqueuePos.Get(MemoryOrder::Relaxed);
+		uint32 num = 0u;
+
+		while (true)
+		{
+			// Count consecutive writable cells from pos.
+			num = 0u;
+
+			while (num < _num && num < capacity &&
+				mCells[(pos + num) & sMask].sequence.Get(MemoryOrder::Acquire) == pos + num)
+				++num;
+
+			if (num == 0u)
+			{
+				const int64 diff = static_cast<int64>(mCells[pos & sMask].sequence.Get(MemoryOrder::Acquire) - pos);
+
+				if (diff < 0 || _num == 0u)
+					return 0u;
+
+				pos = mEnqueuePos.Get(MemoryOrder::Relaxed);
+				continue;
+			}
+
+			if (mEnqueuePos.CompareExchangeWeak(pos, pos + num, MemoryOrder::Relaxed))
+				break;
+		}
+
+		for (uint32 i = 0u; i < num; ++i)
+		{
+			Cell& cell = mCells[(pos + i) & sMask];
+
+			cell.data = _elems[i];
+			cell.sequence.Set(pos + i + 1u, MemoryOrder::Release);
+		}
+
+		return num;
+	}
+
+	template <typename T, uint32 capacity>
+	bool MPMCQueue<T, capacity>::Pop(T& _elem)
+	{
+		uint64 pos = mDequeuePos.Get(MemoryOrder::Relaxed);
+		Cell* cell = nullptr;
+
+		while (true)
+		{
+			cell = &mCells[pos & sMask];
+
+			const uint64 seq = cell->sequence.Get(MemoryOrder::Acquire);
+			const int64 diff = static_cast<int64>(seq - (pos + 1u));
+
+			if (diff == 0)
+			{
+				// Cell is readable: try to claim it.
+				if (mDequeuePos.CompareExchangeWeak(pos, pos + 1u, MemoryOrder::Relaxed))
+					break;
+			}
+			else if (diff < 0)
+				return false; // Empty: cell not produced yet.
+			else
+				pos = mDequeuePos.Get(MemoryOrder::Relaxed);
+		}
+
+		_elem = Move(cell->data);
+		cell->sequence.Set(pos + capacity, MemoryOrder::Release);
+
+		return true;
+	}
+
+	template <typename T, uint32 capacity>
+	uint32 MPMCQueue<T, capacity>::PopBatch(T* _elems, uint32 _max)
+	{
+		uint64 pos = mDequeuePos.Get(MemoryOrder::Relaxed);
+		uint32 num = 0u;
+
+		while (true)
+		{
+			// Count consecutive readable cells from pos.
+			num = 0u;
+
+			while (num < _max && num < capacity &&
+				mCells[(pos + num) & sMask].sequence.Get(MemoryOrder::Acquire) == pos + num + 1u)
+				++num;
+
+			if (num == 0u)
+			{
+				const int64 diff = static_cast<int64>(mCells[pos & sMask].sequence.Get(MemoryOrder::Acquire) - (pos + 1u));
+
+				if (diff < 0 || _max == 0u)
+					return 0u;
+
+				pos = mDequeuePos.Get(MemoryOrder::Relaxed);
+				continue;
+			}
+
+			if (mDequeuePos.CompareExchangeWeak(pos, pos + num, MemoryOrder::Relaxed))
+				break;
+		}
+
+		for (uint32 i = 0u; i < num; ++i)
+		{
+			Cell& cell = mCells[(pos + i) & sMask];
+
+			_elems[i] = Move(cell.data);
+			cell.sequence.Set(pos + i + capacity, MemoryOrder::Release);
+		}
+
+		return num;
+	}
+}
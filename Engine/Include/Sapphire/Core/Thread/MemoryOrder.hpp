@@ -0,0 +1,78 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_MEMORY_ORDER_GUARD
+#define SAPPHIRE_CORE_MEMORY_ORDER_GUARD
+
+#include <atomic>
+
+namespace Sa
+{
+	/**
+	*	\file MemoryOrder.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>Memory Order</b> enum.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Memory ordering constraint of an atomic operation.
+	*
+	*	Map std::memory_order values.
+	*	See more documentation: https://en.cppreference.com/w/cpp/atomic/memory_order
+	*/
+	enum class MemoryOrder
+	{
+		/// No ordering constraint: only atomicity is guaranteed.
+		Relaxed = static_cast<int>(std::memory_order_relaxed),
+
+		/// Load: data-dependent reads can't be reordered before.
+		Consume = static_cast<int>(std::memory_order_consume),
+
+		/// Load: reads and writes can't be reordered before.
+		Acquire = static_cast<int>(std::memory_order_acquire),
+
+		/// Store: reads and writes can't be reordered after.
+		Release = static_cast<int>(std::memory_order_release),
+
+		/// Read-modify-write: both Acquire and Release.
+		AcqRel = static_cast<int>(std::memory_order_acq_rel),
+
+		/// AcqRel plus a single total order of all SeqCst operations.
+		SeqCst = static_cast<int>(std::memory_order_seq_cst),
+	};
+
+
+	/**
+	*	\brief Convert a MemoryOrder to std::memory_order.
+	*
+	*	\param[in] _order	Order to convert.
+	*
+	*	\return converted std::memory_order.
+	*/
+	constexpr std::memory_order ToStdMemoryOrder(MemoryOrder _order) noexcept
+	{
+		return static_cast<std::memory_order>(_order);
+	}
+
+	/**
+	*	\brief Memory fence: synchronize without an associated atomic operation.
+	*
+	*	Wrap std::atomic_thread_fence.
+	*
+	*	\param[in] _order	Ordering of the fence.
+	*/
+	inline void AtomicThreadFence(MemoryOrder _order) noexcept
+	{
+		std::atomic_thread_fence(ToStdMemoryOrder(_order));
+	}
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,158 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_SPSC_QUEUE_GUARD
+#define SAPPHIRE_CORE_SPSC_QUEUE_GUARD
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Algorithms/Move.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/CacheLine.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file SPSCQueue.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>single-producer single-consumer queue</b> type.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Bounded lock-free <b>single-producer single-consumer</b> ring queue.
+	*
+	*	Head and tail indices live on separate cache lines. Each side caches
+	*	the other side's index to avoid touching the shared line on every call.
+	*
+	*	\tparam T			Type of element. Must be default constructible and move assignable.
+	*	\tparam capacity	Max number of elements. Must be a power of 2.
+	*/
+	template <typename T, uint32 capacity>
+	class SPSCQueue
+	{
+		static_assert(capacity && (capacity & (capacity - 1u)) == 0u, "SPSCQueue capacity must be a power of 2!");
+
+		/// Mask to wrap indices in mBuffer.
+		static constexpr uint64 sMask = capacity - 1u;
+
+		/// Read index: written by the consumer.
+		alignas(CacheLineSize) Atomic<uint64> mHead = 0u;
+
+		/// Consumer's cached value of mTail.
+		uint64 mCachedTail = 0u;
+
+		/// Write index: written by the producer.
+		alignas(CacheLineSize) Atomic<uint64> mTail = 0u;
+
+		/// Producer's cached value of mHead.
+		uint64 mCachedHead = 0u;
+
+		/// Ring buffer of elements.
+		alignas(CacheLineSize) T mBuffer[capacity];
+
+	public:
+		/// Max number of elements.
+		static constexpr uint32 Capacity = capacity;
+
+		/**
+		*	\brief \b Default constructor.
+		*/
+		SPSCQueue() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		SPSCQueue(SPSCQueue&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		SPSCQueue(const SPSCQueue&) = delete;
+
+
+		/**
+		*	\brief \e Getter of the approximate number of elements.
+		*
+		*	\return number of elements at the time of the call.
+		*/
+		uint32 Size() const noexcept;
+
+		/**
+		*	\brief Whether the queue is (approximately) empty.
+		*
+		*	\return true if empty at the time of the call.
+		*/
+		bool IsEmpty() const noexcept;
+
+
+		/**
+		*	\brief \b Push an element (producer only).
+		*
+		*	\param[in] _elem	Element to push.
+		*
+		*	\return false if the queue is full.
+		*/
+		bool Push(T _elem);
+
+		/**
+		*	\brief \b Push several elements at once (producer only).
+		*
+		*	Publish all pushed elements with a single store.
+		*
+		*	\param[in] _elems	Elements to push.
+		*	\param[in] _num		Number of elements in _elems.
+		*
+		*	\return number of elements pushed (less than _num if the queue got full).
+		*/
+		uint32 PushBatch(const T* _elems, uint32 _num);
+
+		/**
+		*	\brief \b Pop an element (consumer only).
+		*
+		*	\param[out] _elem	Popped element.
+		*
+		*	\return false if the queue is empty.
+		*/
+		bool Pop(T& _elem);
+
+		/**
+		*	\brief \b Pop several elements at once (consumer only).
+		*
+		*	Release all popped slots with a single store.
+		*
+		*	\param[out] _elems	Popped elements.
+		*	\param[in] _max		Max number of elements to pop (size of _elems).
+		*
+		*	\return number of elements popped.
+		*/
+		uint32 PopBatch(T* _elems, uint32 _max);
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		SPSCQueue& operator=(SPSCQueue&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		SPSCQueue& operator=(const SPSCQueue&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/SPSCQueue.inl>
+
+#endif // GUARD
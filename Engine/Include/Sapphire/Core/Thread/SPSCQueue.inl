@@ -0,0 +1,102 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	template <typename T, uint32 capacity>
+	uint32 SPSCQueue<T, capacity>::Size() const noexcept
+	{
+		const uint64 tail = mTail.Get(MemoryOrder::Acquire);
+		const uint64 head = mHead.Get(MemoryOrder::Acquire);
+
+		return tail > head ? static_cast<uint32>(tail - head) : 0u;
+	}
+
+	template <typename T, uint32 capacity>
+	bool SPSCQueue<T, capacity>::IsEmpty() const noexcept
+	{
+		return Size() == 0u;
+	}
+
+
+	template <typename T, uint32 capacity>
+	bool SPSCQueue<T, capacity>::Push(T _elem)
+	{
+		const uint64 tail = mTail.Get(MemoryOrder::Relaxed);
+
+		if (tail - mCachedHead >= capacity)
+		{
+			// Refresh the consumer index only when the queue looks full.
+			mCachedHead = mHead.Get(MemoryOrder::Acquire);
+
+			if (tail - mCachedHead >= capacity)
+				return false;
+		}
+
+		mBuffer[tail & sMask] = Move(_elem);
+
+		mTail.Set(tail + 1u, MemoryOrder::Release);
+
+		return true;
+	}
+
+	template <typename T, uint32 capacity>
+	uint32 SPSCQueue<T, capacity>::PushBatch(const T* _elems, uint32 _num)
+	{
+		const uint64 tail = mTail.Get(MemoryOrder::Relaxed);
+
+		if (tail - mCachedHead + _num > capacity)
+			mCachedHead = mHead.Get(MemoryOrder::Acquire);
+
+		const uint64 freeNum = capacity - (tail - mCachedHead);
+		const uint32 num = _num < freeNum ? _num : static_cast<uint32>(freeNum);
+
+		for (uint32 i = 0u; i < num; ++i)
+			mBuffer[(tail + i) & sMask] = _elems[i];
+
+		if (num)
+			mTail.Set(tail + num, MemoryOrder::Release);
+
+		return num;
+	}
+
+	template <typename T, uint32 capacity>
+	bool SPSCQueue<T, capacity>::Pop(T& _elem)
+	{
+		const uint64 head = mHead.Get(MemoryOrder::Relaxed);
+
+		if (head == mCachedTail)
+		{
+			// Refresh the producer index only when the queue looks empty.
+			mCachedTail = mTail.Get(MemoryOrder::Acquire);
+
+			if (head == mCachedTail)
+				return false;
+		}
+
+		_elem = Move(mBuffer[head & sMask]);
+
+		mHead.Set(head + 1u, MemoryOrder::Release);
+
+		return true;
+	}
+
+	template <typename T, uint32 capacity>
+	uint32 SPSCQueue<T, capacity>::PopBatch(T* _elems, uint32 _max)
+	{
+		const uint64 head = mHead.Get(MemoryOrder::Relaxed);
+
+		if (mCachedTail - head < _max)
+			mCachedTail = mTail.Get(MemoryOrder::Acquire);
+
+		const uint64 availableNum = mCachedTail - head;
+		const uint32 num = _max < availableNum ? _max : static_cast<uint32>(availableNum);
+
+		for (uint32 i = 0u; i < num; ++i)
+			_elems[i] = Move(mBuffer[(head + i) & sMask]);
+
+		if (num)
+			mHead.Set(head + num, MemoryOrder::Release);
+
+		return num;
+	}
+}
@@ -0,0 +1,198 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_SHARED_MUTEX_GUARD
+#define SAPPHIRE_CORE_SHARED_MUTEX_GUARD
+
+#include <Core/Config.hpp>
+
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Misc/RAII.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/LockStats.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file SharedMutex.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>Shared Mutex</b> (reader-writer lock) type.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Reader-writer lock built on Atomic::Wait() (futex).
+	*
+	*	Any number of readers (LockShared()) or a single writer (Lock()).
+	*	A waiting writer blocks new readers to avoid writer starvation.
+	*	Uncontended read and write locks are a single atomic operation.
+	*/
+	class SharedMutex
+	{
+		/// Writer holds the lock.
+		static constexpr uint32 sWriterBit = 1u << 31;
+
+		/// A writer waits for readers to leave: new readers must wait.
+		static constexpr uint32 sWriterWaitingBit = 1u << 30;
+
+		/// Threads are parked: unlock must wake them.
+		static constexpr uint32 sWaitersBit = 1u << 29;
+
+		/// Number of readers holding the lock.
+		static constexpr uint32 sReaderMask = sWaitersBit - 1u;
+
+		/// Lock state.
+		Atomic<uint32> mHandle = 0u;
+
+#if SA_LOCK_STATS
+
+		/// Contention counters.
+		LockStats mStats;
+
+#endif
+
+		/**
+		*	\brief Contended Lock() path.
+		*/
+		SA_ENGINE_API void LockSlow() noexcept;
+
+		/**
+		*	\brief Contended LockShared() path.
+		*/
+		SA_ENGINE_API void LockSharedSlow() noexcept;
+
+		/**
+		*	\brief Park the thread until the state changes from _state.
+		*
+		*	\param[in] _state	Last observed state.
+		*/
+		SA_ENGINE_API void Park(uint32 _state) noexcept;
+
+	public:
+		/// Number of tries before parking the thread.
+		static constexpr uint32 SpinNum = 64u;
+
+		/**
+		*	\brief \b Default constructor.
+		*/
+		SharedMutex() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		SharedMutex(SharedMutex&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		SharedMutex(const SharedMutex&) = delete;
+
+
+		/**
+		*	\brief \b Locks the mutex for \b exclusive (write) access, \b blocks if not available.
+		*/
+		void Lock() noexcept;
+
+		/**
+		*	\brief \b Tries to \b lock the mutex for \b exclusive (write) access.
+		*
+		*	\return true if the lock was acquired successfully, otherwise false.
+		*/
+		bool TryLock() noexcept;
+
+		/**
+		*	\brief \b Unlock the mutex from \b exclusive (write) access.
+		*/
+		SA_ENGINE_API void Unlock() noexcept;
+
+
+		/**
+		*	\brief \b Locks the mutex for \b shared (read) access, \b blocks if a writer holds or waits for it.
+		*/
+		void LockShared() noexcept;
+
+		/**
+		*	\brief \b Tries to \b lock the mutex for \b shared (read) access.
+		*
+		*	\return true if the lock was acquired successfully, otherwise false.
+		*/
+		bool TryLockShared() noexcept;
+
+		/**
+		*	\brief \b Unlock the mutex from \b shared (read) access.
+		*/
+		void UnlockShared() noexcept;
+
+#if SA_LOCK_STATS
+
+		/**
+		*	\e Getter of contention counters.
+		*
+		*	\return contention counters.
+		*/
+		LockStats& GetStats() noexcept;
+
+#endif
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance
+		*/
+		SharedMutex& operator=(SharedMutex&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance
+		*/
+		SharedMutex& operator=(const SharedMutex&) = delete;
+	};
+
+
+	/**
+	*	\brief RAII specialization for SharedMutex.
+	*
+	*	\implements RAII
+	*/
+	template <>
+	class RAII<SharedMutex> final : RAIIBase
+	{
+		/// The handled mutex.
+		SharedMutex& mHandle;
+
+		/// Whether the mutex is locked for shared (read) access.
+		const bool mIsShared = false;
+
+	public:
+
+		/**
+		*	\brief Value constructor: \b Lock() or \b LockShared() the handled mutex.
+		*
+		*	\param[in, out] _mutex		SharedMutex to handle.
+		*	\param[in] _bShared			Lock for shared (read) access instead of exclusive (write) access.
+		*/
+		RAII(SharedMutex& _mutex, bool _bShared = false) noexcept;
+
+		/**
+		*	\brief Destructor: \b Unlock() or \b UnlockShared() the handled mutex.
+		*/
+		~RAII() noexcept;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/SharedMutex.inl>
+
+#endif // GUARD
@@ -0,0 +1,85 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	inline void SharedMutex::Lock() noexcept
+	{
+		if (!TryLock())
+			LockSlow();
+	}
+
+	inline bool SharedMutex::TryLock() noexcept
+	{
+		uint32 expected = 0u;
+
+		if (!mHandle.CompareExchangeStrong(expected, sWriterBit, MemoryOrder::Acquire, MemoryOrder::Relaxed))
+			return false;
+
+		__SA_LOCK_STAT(mStats, lockNum);
+
+		return true;
+	}
+
+
+	inline void SharedMutex::LockShared() noexcept
+	{
+		if (!TryLockShared())
+			LockSharedSlow();
+	}
+
+	inline bool SharedMutex::TryLockShared() noexcept
+	{
+		uint32 state = mHandle.Get(MemoryOrder::Relaxed);
+
+		while ((state & (sWriterBit | sWriterWaitingBit)) == 0u)
+		{
+			if (mHandle.CompareExchangeWeak(state, state + 1u, MemoryOrder::Acquire, MemoryOrder::Relaxed))
+			{
+				__SA_LOCK_STAT(mStats, lockNum);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	inline void SharedMutex::UnlockShared() noexcept
+	{
+		const uint32 prev = mHandle.FetchSub(1u, MemoryOrder::Release);
+
+		// Last reader leaving with parked threads (a writer waits).
+		if ((prev & sReaderMask) == 1u && (prev & sWaitersBit))
+		{
+			mHandle.FetchAnd(~sWaitersBit, MemoryOrder::Relaxed);
+			mHandle.NotifyAll();
+		}
+	}
+
+#if SA_LOCK_STATS
+
+	inline LockStats& SharedMutex::GetStats() noexcept
+	{
+		return mStats;
+	}
+
+#endif
+
+
+	inline RAII<SharedMutex>::RAII(SharedMutex& _mutex, bool _bShared) noexcept :
+		mHandle{ _mutex },
+		mIsShared{ _bShared }
+	{
+		if (mIsShared)
+			mHandle.LockShared();
+		else
+			mHandle.Lock();
+	}
+
+	inline RAII<SharedMutex>::~RAII() noexcept
+	{
+		if (mIsShared)
+			mHandle.UnlockShared();
+		else
+			mHandle.Unlock();
+	}
+}
@@ -0,0 +1,149 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_SPIN_LOCK_GUARD
+#define SAPPHIRE_CORE_SPIN_LOCK_GUARD
+
+#include <Core/Config.hpp>
+
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Misc/RAII.hpp>
+
+#include <Core/Thread/AtomicFlag.hpp>
+#include <Core/Thread/LockStats.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file SpinLock.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>Spin Lock</b> type.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Busy-waiting lock for very short critical sections.
+	*
+	*	Spin with exponential backoff (CPU pause), then fall back to Thread::Yield().
+	*	Never enters the kernel: prefer FutexMutex when the lock may be held for long.
+	*/
+	class SpinLock
+	{
+		/// Lock state.
+		AtomicFlag mHandle;
+
+#if SA_LOCK_STATS
+
+		/// Contention counters.
+		LockStats mStats;
+
+#endif
+
+		/**
+		*	\brief Contended Lock() path: spin with backoff until acquired.
+		*/
+		SA_ENGINE_API void LockSlow() noexcept;
+
+	public:
+		/// Max number of CPU pauses between two tries before yielding the thread.
+		static constexpr uint32 MaxBackoff = 64u;
+
+		/**
+		*	\brief \b Default constructor.
+		*/
+		SpinLock() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		SpinLock(SpinLock&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		SpinLock(const SpinLock&) = delete;
+
+
+		/**
+		*	\brief \b Locks the spin lock, \b spins if not available.
+		*/
+		void Lock() noexcept;
+
+		/**
+		*	\brief \b Tries to \b lock the spin lock.
+		*
+		*	\return true if the lock was acquired successfully, otherwise false.
+		*/
+		bool TryLock() noexcept;
+
+		/**
+		*	\brief \b Unlock the spin lock.
+		*/
+		void Unlock() noexcept;
+
+#if SA_LOCK_STATS
+
+		/**
+		*	\e Getter of contention counters.
+		*
+		*	\return contention counters.
+		*/
+		LockStats& GetStats() noexcept;
+
+#endif
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance
+		*/
+		SpinLock& operator=(SpinLock&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance
+		*/
+		SpinLock& operator=(const SpinLock&) = delete;
+	};
+
+
+	/**
+	*	\brief RAII specialization for SpinLock.
+	*
+	*	\implements RAII
+	*/
+	template <>
+	class RAII<SpinLock> final : RAIIBase
+	{
+		/// The handled spin lock.
+		SpinLock& mHandle;
+
+	public:
+
+		/**
+		*	\brief Value constructor: \b Lock() the handled spin lock.
+		*
+		*	\param[in, out] _lock		SpinLock to handle.
+		*/
+		RAII(SpinLock& _lock) noexcept;
+
+		/**
+		*	\brief Destructor: \b Unlock() the handled spin lock.
+		*/
+		~RAII() noexcept;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/SpinLock.inl>
+
+#endif // GUARD
@@ -0,0 +1,48 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	inline void SpinLock::Lock() noexcept
+	{
+		if (mHandle.TestAndSet(MemoryOrder::Acquire))
+			LockSlow();
+
+		__SA_LOCK_STAT(mStats, lockNum);
+	}
+
+	inline bool SpinLock::TryLock() noexcept
+	{
+		// Test first: don't steal the cache line from the owner.
+		if (mHandle.Test(MemoryOrder::Relaxed) || mHandle.TestAndSet(MemoryOrder::Acquire))
+			return false;
+
+		__SA_LOCK_STAT(mStats, lockNum);
+
+		return true;
+	}
+
+	inline void SpinLock::Unlock() noexcept
+	{
+		mHandle.Clear(MemoryOrder::Release);
+	}
+
+#if SA_LOCK_STATS
+
+	inline LockStats& SpinLock::GetStats() noexcept
+	{
+		return mStats;
+	}
+
+#endif
+
+
+	inline RAII<SpinLock>::RAII(SpinLock& _lock) noexcept : mHandle{ _lock }
+	{
+		mHandle.Lock();
+	}
+
+	inline RAII<SpinLock>::~RAII() noexcept
+	{
+		mHandle.Unlock();
+	}
+}
@@ -0,0 +1,227 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_TASK_GRAPH_GUARD
+#define SAPPHIRE_CORE_TASK_GRAPH_GUARD
+
+#include <vector>
+#include <memory>
+#include <functional>
+
+#include <Core/Support/EngineAPI.hpp>
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Time/Tick.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/JobSystem.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file TaskGraph.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>Task Graph</b> type.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Reusable graph of tasks with explicit dependencies.
+	*
+	*	Declare nodes and edges once, Compile(), then Run() the graph every frame.
+	*	Ready nodes are dispatched on the JobSystem: independent nodes overlap across cores.
+	*	Run() does not allocate memory.
+	*/
+	class TaskGraph
+	{
+		/// \cond Internal
+
+		/// Node of the graph.
+		struct Node
+		{
+			/// Debug name of the node.
+			const char* name = nullptr;
+
+			/// Task to execute.
+			std::function<void()> func;
+
+			/// Indices of the nodes depending on this one.
+			std::vector<uint32> successors;
+
+			/// Number of nodes this one depends on.
+			uint32 depNum = 0u;
+
+			/// Start time of the last run.
+			Tick start;
+
+			/// End time of the last run.
+			Tick end;
+		};
+
+		/// \endcond Internal
+
+		/// Registered nodes.
+		std::vector<Node> mNodes;
+
+		/// Remaining dependencies per node during Run().
+		std::unique_ptr<Atomic<uint32>[]> mRemainings;
+
+		/// Nodes without dependency.
+		std::vector<uint32> mRoots;
+
+		/// Topological order of the nodes.
+		std::vector<uint32> mOrder;
+
+		/// Critical path end time per node (computed after Run()).
+		std::vector<Tick> mFinishes;
+
+		/// Completion counter of the current Run().
+		JobCounter mCounter;
+
+		/// Whether Compile() has been called since the last modification.
+		bool mIsCompiled = false;
+
+		/// Wall time of the last Run().
+		Tick mDuration;
+
+		/// Critical path duration of the last Run().
+		Tick mCriticalPath;
+
+		/**
+		*	\brief \b Execute a node and dispatch its ready successors.
+		*
+		*	\param[in] _index	Index of the node.
+		*/
+		SA_ENGINE_API void ExecuteNode(uint32 _index);
+
+	public:
+		/// Invalid node index.
+		static constexpr uint32 InvalidNode = uint32(-1);
+
+		/**
+		*	\brief \b Default constructor.
+		*/
+		TaskGraph() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		TaskGraph(TaskGraph&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		TaskGraph(const TaskGraph&) = delete;
+
+
+		/**
+		*	\brief Add a new node to the graph.
+		*
+		*	\tparam F			Type of the callable.
+		*
+		*	\param[in] _name	Debug name of the node.
+		*	\param[in] _func	Task to execute: void().
+		*
+		*	\return index of the created node.
+		*/
+		template <typename F>
+		uint32 AddNode(const char* _name, F&& _func);
+
+		/**
+		*	\brief Add a dependency: _to starts once _from is completed.
+		*
+		*	\param[in] _from	Index of the node to complete first.
+		*	\param[in] _to		Index of the dependent node.
+		*/
+		SA_ENGINE_API void AddEdge(uint32 _from, uint32 _to);
+
+		/**
+		*	\brief Remove all nodes and edges.
+		*/
+		SA_ENGINE_API void Clear();
+
+
+		/**
+		*	\brief \b Compile the graph: compute the topological order and allocate run resources.
+		*
+		*	Assert the graph has no cycle.
+		*/
+		SA_ENGINE_API void Compile();
+
+		/**
+		*	\brief \b Run the graph and wait for completion.
+		*
+		*	The calling thread executes tasks while waiting.
+		*/
+		SA_ENGINE_API void Run();
+
+
+		/**
+		*	\brief \e Getter of the number of nodes.
+		*
+		*	\return number of nodes.
+		*/
+		SA_ENGINE_API uint32 GetNodeNum() const noexcept;
+
+		/**
+		*	\brief \e Getter of a node's name.
+		*
+		*	\param[in] _index	Index of the node.
+		*
+		*	\return name of the node.
+		*/
+		SA_ENGINE_API const char* GetNodeName(uint32 _index) const;
+
+		/**
+		*	\brief \e Getter of a node's execution time during the last Run().
+		*
+		*	\param[in] _index	Index of the node.
+		*
+		*	\return execution time of the node.
+		*/
+		SA_ENGINE_API Tick GetNodeDuration(uint32 _index) const;
+
+		/**
+		*	\brief \e Getter of the wall time of the last Run().
+		*
+		*	\return duration of the last Run().
+		*/
+		SA_ENGINE_API Tick GetDuration() const noexcept;
+
+		/**
+		*	\brief \e Getter of the critical path duration of the last Run().
+		*
+		*	Longest chain of dependent node durations: lower bound of the Run() duration with infinite workers.
+		*
+		*	\return critical path duration.
+		*/
+		SA_ENGINE_API Tick GetCriticalPath() const noexcept;
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		TaskGraph& operator=(TaskGraph&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		TaskGraph& operator=(const TaskGraph&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/TaskGraph.inl>
+
+#endif // GUARD
@@ -0,0 +1,17 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	template <typename F>
+	uint32 TaskGraph::AddNode(const char* _name, F&& _func)
+	{
+		Node& node = mNodes.emplace_back();
+
+		node.name = _name;
+		node.func = Forward<F>(_func);
+
+		mIsCompiled = false;
+
+		return static_cast<uint32>(mNodes.size() - 1u);
+	}
+}
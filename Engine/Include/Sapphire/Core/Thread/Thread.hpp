@@ -6,6 +6,8 @@
 #define SAPPHIRE_CORE_THREAD_GUARD
 
 #include <thread>
+#include <functional>
+#include <type_traits>
 
 #include <Core/Support/EngineAPI.hpp>
 
@@ -26,18 +28,73 @@ namespace Sa
 	*/
 
 
+	/**
+	*	\brief OS scheduling priority hint of a thread.
+	*/
+	enum class ThreadPriority : uint8
+	{
+		/// Background work: only run when cores are idle.
+		Low,
+
+		/// Default OS time-sharing.
+		Normal,
+
+		/// Latency sensitive (render, audio). May require privileges.
+		High,
+
+		/// Real-time. May require privileges.
+		Critical,
+	};
+
+
 	/**
 	*	\brief Handle of the \e std::thread standard class.
 	*
 	*	Use std:: implementation and Sapphire's norm.
 	*	See more documentation: https://en.cppreference.com/w/cpp/thread/thread
+	*
+	*	Each thread gets a small unique ID, monotonically assigned from 0
+	*	(on creation for Thread instances, on first GetCurrentID() call for other threads).
+	*	IDs are never reused: use them to index per-thread resources.
 	*/
 	class Thread
 	{
 		/// The handled std::thread.
 		std::thread mHandle;
 
+		/// ID of the handled thread.
+		uint32 mID = InvalidID;
+
+		/**
+		*	\brief Reserve a new unique thread ID.
+		*
+		*	\return new thread ID.
+		*/
+		SA_ENGINE_API static uint32 AllocateID() noexcept;
+
+		/**
+		*	\brief \e Setter of the calling thread ID.
+		*
+		*	\param[in] _id		ID allocated by AllocateID().
+		*/
+		SA_ENGINE_API static void SetCurrentID(uint32 _id) noexcept;
+
+		/**
+		*	\brief Entry point of created threads: set the thread ID then run the function.
+		*
+		*	\tparam Function	Function declaration type.
+		*	\tparam Args		Arguments type of the function.
+		*
+		*	\param[in] _id		ID of the created thread.
+		*	\param[in] _func	Function to be executed by the thread.
+		*	\param[in] _args	Arguments forwarded to the function.
+		*/
+		template <typename Function, typename... Args>
+		static void Main(uint32 _id, Function _func, Args... _args);
+
 	public:
+		/// Invalid thread ID.
+		static constexpr uint32 InvalidID = uint32(-1);
 
 		/**
 		*	\brief \b Default constructor.
@@ -57,9 +114,11 @@ namespace Sa
 		Thread(Function&& _func, Args&&... _args);
 
 		/**
-		*	\brief \b Default \e move constructor.
+		*	\brief \e Move constructor.
+		*
+		*	\param[in] _other	Thread to move. Become empty.
 		*/
-		Thread(Thread&&) = default;
+		SA_ENGINE_API Thread(Thread&& _other) noexcept;
 
 		/**
 		*	\brief \b Deleted \e copy constructor.
@@ -75,10 +134,19 @@ namespace Sa
 		/**
 		*	\brief \e Getter of this thread ID.
 		*
-		*	\return This thread ID.
+		*	\return This thread ID, InvalidID if empty.
 		*/
 		SA_ENGINE_API uint32 GetID() const noexcept;
 
+		/**
+		*	\brief \e Getter of the calling thread ID.
+		*
+		*	Assign a new ID on first call from a thread not created by Thread.
+		*
+		*	\return calling thread ID.
+		*/
+		SA_ENGINE_API static uint32 GetCurrentID() noexcept;
+
 		/**
 		*	\brief \e Getter if this thread is currently running a function.
 		*
@@ -102,6 +170,92 @@ namespace Sa
 		*/
 		SA_ENGINE_API void Detatch() noexcept;
 
+
+		/**
+		*	\brief \e Setter of the OS name of this thread (debuggers, profilers, top).
+		*
+		*	Truncated to 15 characters on Linux.
+		*
+		*	\param[in] _name	New name of the thread.
+		*
+		*	\return true on success.
+		*/
+		SA_ENGINE_API bool SetName(const char* _name) noexcept;
+
+		/**
+		*	\brief Restrict this thread to run on a set of logical cores.
+		*
+		*	\param[in] _coreMask	Bit i allows logical core i (first 64 cores only).
+		*
+		*	\return true on success.
+		*/
+		SA_ENGINE_API bool SetAffinity(uint64 _coreMask) noexcept;
+
+		/**
+		*	\brief Restrict this thread to run on the cores of a NUMA node.
+		*
+		*	Memory first touched by the thread is then allocated on this node.
+		*
+		*	\param[in] _node	NUMA node index in [0, GetNumaNodeNum()[.
+		*
+		*	\return true on success.
+		*/
+		SA_ENGINE_API bool SetNumaNode(uint32 _node) noexcept;
+
+		/**
+		*	\brief \e Setter of the OS scheduling priority hint of this thread.
+		*
+		*	\param[in] _priority	New priority.
+		*
+		*	\return true on success (High and Critical may fail without privileges).
+		*/
+		SA_ENGINE_API bool SetPriority(ThreadPriority _priority) noexcept;
+
+
+		/**
+		*	\brief \e Setter of the OS name of the calling thread.
+		*
+		*	\param[in] _name	New name of the thread.
+		*
+		*	\return true on success.
+		*/
+		SA_ENGINE_API static bool SetCurrentName(const char* _name) noexcept;
+
+		/**
+		*	\brief Restrict the calling thread to run on a set of logical cores.
+		*
+		*	\param[in] _coreMask	Bit i allows logical core i (first 64 cores only).
+		*
+		*	\return true on success.
+		*/
+		SA_ENGINE_API static bool SetCurrentAffinity(uint64 _coreMask) noexcept;
+
+		/**
+		*	\brief Restrict the calling thread to run on the cores of a NUMA node.
+		*
+		*	\param[in] _node	NUMA node index in [0, GetNumaNodeNum()[.
+		*
+		*	\return true on success.
+		*/
+		SA_ENGINE_API static bool SetCurrentNumaNode(uint32 _node) noexcept;
+
+		/**
+		*	\brief \e Setter of the OS scheduling priority hint of the calling thread.
+		*
+		*	\param[in] _priority	New priority.
+		*
+		*	\return true on success.
+		*/
+		SA_ENGINE_API static bool SetCurrentPriority(ThreadPriority _priority) noexcept;
+
+		/**
+		*	\brief \e Getter of the number of NUMA nodes.
+		*
+		*	\return number of NUMA nodes (1 on non-NUMA systems).
+		*/
+		SA_ENGINE_API static uint32 GetNumaNodeNum() noexcept;
+
+
 		/**
 		*	\brief \e Getter of the number of concurrent threads supported by the implementation.
 		*
@@ -120,11 +274,13 @@ namespace Sa
 
 
 		/**
-		*	\brief \b Default \e move operator=.
+		*	\brief \e Move operator=.
+		*
+		*	\param[in] _rhs	Thread to move. Become empty.
 		*
 		*	\return this instance.
 		*/
-		Thread& operator=(Thread&&) = default;
+		SA_ENGINE_API Thread& operator=(Thread&& _rhs) noexcept;
 
 		/**
 		*	\brief \b Deleted \e copy operator=.
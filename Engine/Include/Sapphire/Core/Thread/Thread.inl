@@ -3,7 +3,18 @@
 namespace Sa
 {
 	template <typename Function, typename... Args>
-	Thread::Thread(Function&& _func, Args&&... _args) : mHandle{ Move(_func), Forward<Args>(_args)... }
+	Thread::Thread(Function&& _func, Args&&... _args) :
+		mID{ AllocateID() }
 	{
+		mHandle = std::thread(&Main<typename std::decay<Function>::type, typename std::decay<Args>::type...>,
+			mID, Forward<Function>(_func), Forward<Args>(_args)...);
+	}
+
+	template <typename Function, typename... Args>
+	void Thread::Main(uint32 _id, Function _func, Args... _args)
+	{
+		SetCurrentID(_id);
+
+		std::invoke(Move(_func), Move(_args)...);
 	}
 }
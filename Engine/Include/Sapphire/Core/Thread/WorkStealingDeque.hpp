@@ -0,0 +1,139 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_WORK_STEALING_DEQUE_GUARD
+#define SAPPHIRE_CORE_WORK_STEALING_DEQUE_GUARD
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/CacheLine.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file WorkStealingDeque.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>work-stealing deque</b> type.
+	*
+	*	\ingroup Thread
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Bounded lock-free <b>Chase-Lev</b> work-stealing deque.
+	*
+	*	The owner thread Push() and Pop() at the bottom (LIFO),
+	*	any other thread may Steal() from the top (FIFO).
+	*	Reference: "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al., 2013).
+	*
+	*	\tparam T			Type of element. Must be trivially copyable (usually a pointer).
+	*	\tparam capacity	Max number of elements. Must be a power of 2.
+	*/
+	template <typename T, uint32 capacity>
+	class WorkStealingDeque
+	{
+		static_assert(capacity && (capacity & (capacity - 1u)) == 0u, "WorkStealingDeque capacity must be a power of 2!");
+
+		/// Mask to wrap indices in mBuffer.
+		static constexpr int64 sMask = static_cast<int64>(capacity) - 1;
+
+		/// Top index: stolen by other threads.
+		alignas(CacheLineSize) Atomic<int64> mTop = 0;
+
+		/// Bottom index: owned by the owner thread.
+		alignas(CacheLineSize) Atomic<int64> mBottom = 0;
+
+		/// Ring buffer of elements.
+		alignas(CacheLineSize) Atomic<T> mBuffer[capacity];
+
+	public:
+		/**
+		*	\brief \b Default constructor.
+		*/
+		WorkStealingDeque() = default;
+
+		/**
+		*	\brief \b Deleted \e move constructor.
+		*/
+		WorkStealingDeque(WorkStealingDeque&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy constructor.
+		*/
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+
+
+		/**
+		*	\brief \e Getter of the approximate number of elements.
+		*
+		*	\return number of elements at the time of the call.
+		*/
+		uint32 Size() const noexcept;
+
+		/**
+		*	\brief Whether the deque is (approximately) empty.
+		*
+		*	\return true if empty at the time of the call.
+		*/
+		bool IsEmpty() const noexcept;
+
+
+		/**
+		*	\brief \b Push an element at the bottom.
+		*
+		*	Owner thread only.
+		*
+		*	\param[in] _elem	Element to push.
+		*
+		*	\return false if the deque is full.
+		*/
+		bool Push(T _elem) noexcept;
+
+		/**
+		*	\brief \b Pop an element from the bottom.
+		*
+		*	Owner thread only.
+		*
+		*	\param[out] _elem	Popped element.
+		*
+		*	\return false if the deque is empty.
+		*/
+		bool Pop(T& _elem) noexcept;
+
+		/**
+		*	\brief \b Steal an element from the top.
+		*
+		*	Can be called from any thread.
+		*
+		*	\param[out] _elem	Stolen element.
+		*
+		*	\return false if the deque is empty or the steal lost a race.
+		*/
+		bool Steal(T& _elem) noexcept;
+
+
+		/**
+		*	\brief \b Deleted \e move operator=.
+		*
+		*	\return this instance.
+		*/
+		WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+		/**
+		*	\brief \b Deleted \e copy operator=.
+		*
+		*	\return this instance.
+		*/
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+	};
+
+
+	/** \} */
+}
+
+#include <Core/Thread/WorkStealingDeque.inl>
+
+#endif // GUARD
@@ -0,0 +1,91 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+namespace Sa
+{
+	template <typename T, uint32 capacity>
+	uint32 WorkStealingDeque<T, capacity>::Size() const noexcept
+	{
+		const int64 bottom = mBottom.Get(MemoryOrder::Relaxed);
+		const int64 top = mTop.Get(MemoryOrder::Relaxed);
+
+		return bottom > top ? static_cast<uint32>(bottom - top) : 0u;
+	}
+
+	template <typename T, uint32 capacity>
+	bool WorkStealingDeque<T, capacity>::IsEmpty() const noexcept
+	{
+		return Size() == 0u;
+	}
+
+
+	template <typename T, uint32 capacity>
+	bool WorkStealingDeque<T, capacity>::Push(T _elem) noexcept
+	{
+		const int64 bottom = mBottom.Get(MemoryOrder::Relaxed);
+		const int64 top = mTop.Get(MemoryOrder::Acquire);
+
+		// Full.
+		if (bottom - top >= static_cast<int64>(capacity))
+			return false;
+
+		mBuffer[bottom & sMask].Set(_elem, MemoryOrder::Relaxed);
+
+		// Publish the element before the new bottom.
+		AtomicThreadFence(MemoryOrder::Release);
+		mBottom.Set(bottom + 1, MemoryOrder::Relaxed);
+
+		return true;
+	}
+
+	template <typename T, uint32 capacity>
+	bool WorkStealingDeque<T, capacity>::Pop(T& _elem) noexcept
+	{
+		const int64 bottom = mBottom.Get(MemoryOrder::Relaxed) - 1;
+		mBottom.Set(bottom, MemoryOrder::Relaxed);
+
+		// Order the bottom reservation with the top read (races with Steal()).
+		AtomicThreadFence(MemoryOrder::SeqCst);
+
+		int64 top = mTop.Get(MemoryOrder::Relaxed);
+
+		// Empty: restore bottom.
+		if (top > bottom)
+		{
+			mBottom.Set(bottom + 1, MemoryOrder::Relaxed);
+			return false;
+		}
+
+		_elem = mBuffer[bottom & sMask].Get(MemoryOrder::Relaxed);
+
+		// More than one element left: no race possible.
+		if (top < bottom)
+			return true;
+
+		// Last element: race against thieves.
+		const bool bSuccess = mTop.CompareExchangeStrong(top, top + 1, MemoryOrder::SeqCst, MemoryOrder::Relaxed);
+
+		mBottom.Set(bottom + 1, MemoryOrder::Relaxed);
+
+		return bSuccess;
+	}
+
+	template <typename T, uint32 capacity>
+	bool WorkStealingDeque<T, capacity>::Steal(T& _elem) noexcept
+	{
+		int64 top = mTop.Get(MemoryOrder::Acquire);
+
+		// Order the top read with the bottom read (races with Pop()).
+		AtomicThreadFence(MemoryOrder::SeqCst);
+
+		const int64 bottom = mBottom.Get(MemoryOrder::Acquire);
+
+		// Empty.
+		if (top >= bottom)
+			return false;
+
+		_elem = mBuffer[top & sMask].Get(MemoryOrder::Relaxed);
+
+		// Lost the race against the owner or another thief.
+		return mTop.CompareExchangeStrong(top, top + 1, MemoryOrder::SeqCst, MemoryOrder::Relaxed);
+	}
+}
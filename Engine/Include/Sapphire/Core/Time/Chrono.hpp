@@ -20,11 +20,13 @@ namespace Sa
 
 	/**
 	*	\brief Chronometer class to measure a <b>period of time</b>.
+	*
+	*	Measure with Time::NanoSeconds(): integer nanoseconds, no precision loss.
 	*/
 	class Chrono
 	{
-		/// The handled start time.
-		Tick mStart;
+		/// The handled start time (Time::NanoSeconds()).
+		int64 mStart = 0;
 
 	public:
 
@@ -0,0 +1,135 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_CPU_CLOCK_GUARD
+#define SAPPHIRE_CORE_CPU_CLOCK_GUARD
+
+#include <Core/Types/Int.hpp>
+
+#include <Core/Support/EngineAPI.hpp>
+#include <Core/Support/Compilers.hpp>
+#include <Core/Support/Architectures.hpp>
+
+#if SA_x64
+
+	#if SA_MSVC
+
+		#include <intrin.h>
+
+	#else
+
+		#include <x86intrin.h>
+
+	#endif
+
+#endif
+
+namespace Sa
+{
+	/**
+	*	\file CpuClock.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>CPU clock</b> (time stamp counter).
+	*
+	*	\ingroup Time
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Static calibrated CPU cycle counter (rdtsc / rdtscp).
+	*
+	*	Cheaper than Time::NanoSeconds() (no system call nor vDSO): profiling fast path.
+	*	Cycles are converted to Time::NanoSeconds() domain with a fixed-point ratio,
+	*	calibrated against Time::NanoSeconds() on first conversion (spin of CalibrationTime).
+	*
+	*	NanoSeconds() falls back to Time::NanoSeconds() without invariant TSC (see IsSupported()).
+	*	Non-x64 architectures always use Time::NanoSeconds().
+	*/
+	class CpuClock
+	{
+	public:
+		/// Calibration duration (in nanoseconds).
+		static constexpr int64 CalibrationTime = 5000000;
+
+
+		/**
+		*	\brief Whether the CPU counter is usable as a clock: x64 with invariant TSC
+		*	(constant rate, synchronized across cores).
+		*
+		*	\return true if supported.
+		*/
+		SA_ENGINE_API static bool IsSupported() noexcept;
+
+		/**
+		*	\brief Read the CPU counter (rdtsc: may be reordered with surrounding instructions).
+		*
+		*	\return current cycles.
+		*/
+		static uint64 Cycles() noexcept;
+
+		/**
+		*	\brief Read the CPU counter once previous instructions are done (rdtscp).
+		*
+		*	\return current cycles.
+		*/
+		static uint64 CyclesSerialized() noexcept;
+
+		/**
+		*	\brief \e Getter of the calibrated CPU counter frequency.
+		*
+		*	\return frequency (in cycles per second).
+		*/
+		SA_ENGINE_API static uint64 GetFrequency() noexcept;
+
+		/**
+		*	\brief Convert cycles to Time::NanoSeconds() domain.
+		*
+		*	\param[in] _cycles	Cycles to convert (see Cycles()).
+		*
+		*	\return time in nanoseconds.
+		*/
+		SA_ENGINE_API static int64 ToNanoSeconds(uint64 _cycles) noexcept;
+
+		/**
+		*	\brief Get the time from the CPU counter in Time::NanoSeconds() domain.
+		*
+		*	\return time in nanoseconds.
+		*/
+		SA_ENGINE_API static int64 NanoSeconds() noexcept;
+	};
+
+
+	inline uint64 CpuClock::Cycles() noexcept
+	{
+#if SA_x64
+
+		return __rdtsc();
+
+#else
+
+		return static_cast<uint64>(NanoSeconds());
+
+#endif
+	}
+
+	inline uint64 CpuClock::CyclesSerialized() noexcept
+	{
+#if SA_x64
+
+		unsigned int aux;
+		return __rdtscp(&aux);
+
+#else
+
+		return static_cast<uint64>(NanoSeconds());
+
+#endif
+	}
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -0,0 +1,139 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_CORE_FRAME_LIMITER_GUARD
+#define SAPPHIRE_CORE_FRAME_LIMITER_GUARD
+
+#include <Core/Types/Int.hpp>
+#include <Core/Support/EngineAPI.hpp>
+
+namespace Sa
+{
+	/**
+	*	\file FrameLimiter.hpp
+	*
+	*	\brief \b Definition of Sapphire's <b>frame limiter</b>.
+	*
+	*	\ingroup Time
+	*	\{
+	*/
+
+
+	/**
+	*	\brief Frame limiter pacing mode.
+	*/
+	enum class FrameLimitMode : uint8
+	{
+		/// No limit.
+		None,
+
+		/// Sleep until the next frame of the target rate.
+		Sleep,
+
+		/// Let the presentation pace frames (vsync present mode), Sleep mode fallback otherwise.
+		WaitForPresent,
+	};
+
+
+	/**
+	*	\brief Frame-rate cap: call Wait() once per frame.
+	*
+	*	Frames are scheduled on a fixed cadence of the target rate (no drift).
+	*	Waiting uses Time::SleepUntil(): OS sleep then spin of the final slice.
+	*	A frame later than a whole period resynchronizes the cadence (no burst to catch up).
+	*/
+	class FrameLimiter
+	{
+		/// Target frame period (in nanoseconds, 0 for no limit).
+		int64 mPeriod = 0;
+
+		/// Next frame deadline (Time::NanoSeconds(), 0 to resynchronize).
+		int64 mNextFrame = 0;
+
+		/// Final slice to spin (in nanoseconds).
+		int64 mSpinTime = DefaultSpinTime;
+
+		/// Pacing mode.
+		FrameLimitMode mMode = FrameLimitMode::Sleep;
+
+		/// Whether the presentation paces frames.
+		bool mbPresentPaced = false;
+
+	public:
+		/// Default final slice to spin (in nanoseconds).
+		static constexpr int64 DefaultSpinTime = 200000;
+
+		/**
+		*	\brief \b Default contructor.
+		*/
+		FrameLimiter() = default;
+
+		/**
+		*	\brief \e Value contructor.
+		*
+		*	\param[in] _rate	Target rate (in frames per second).
+		*	\param[in] _mode	Pacing mode.
+		*/
+		SA_ENGINE_API FrameLimiter(float _rate, FrameLimitMode _mode = FrameLimitMode::Sleep) noexcept;
+
+
+		/**
+		*	\brief \e Getter of the target rate.
+		*
+		*	\return target rate (in frames per second, 0 for no limit).
+		*/
+		SA_ENGINE_API float GetTargetRate() const noexcept;
+
+		/**
+		*	\brief \e Setter of the target rate.
+		*
+		*	\param[in] _rate	Target rate (in frames per second, 0 for no limit).
+		*/
+		SA_ENGINE_API void SetTargetRate(float _rate) noexcept;
+
+		/**
+		*	\brief \e Getter of the pacing mode.
+		*
+		*	\return pacing mode.
+		*/
+		SA_ENGINE_API FrameLimitMode GetMode() const noexcept;
+
+		/**
+		*	\brief \e Setter of the pacing mode.
+		*
+		*	\param[in] _mode	Pacing mode.
+		*/
+		SA_ENGINE_API void SetMode(FrameLimitMode _mode) noexcept;
+
+		/**
+		*	\brief \e Setter of the final slice to spin (see Time::SleepUntil()).
+		*
+		*	\param[in] _spinTime	Spin time (in nanoseconds). Higher is more precise, lower burns less CPU.
+		*/
+		SA_ENGINE_API void SetSpinTime(int64 _spinTime) noexcept;
+
+		/**
+		*	\brief \e Setter of the presentation pacing (ex: IRenderSurface::IsPresentPaced()).
+		*
+		*	\param[in] _bPaced	Whether the presentation blocks on vertical blank.
+		*/
+		SA_ENGINE_API void SetPresentPaced(bool _bPaced) noexcept;
+
+
+		/**
+		*	\brief Wait until the next frame.
+		*/
+		SA_ENGINE_API void Wait() noexcept;
+
+		/**
+		*	\brief Resynchronize the cadence on the next Wait() (ex: after loading).
+		*/
+		SA_ENGINE_API void Reset() noexcept;
+	};
+
+
+	/** \} */
+}
+
+#endif // GUARD
@@ -29,13 +29,18 @@ namespace Sa
 	*	\brief \e Time-relative class which provide \b conversions with other \e time-relative classes.
 	*
 	*	1 Tick is 1 MicroSecond (1e-6 second).
+	*	Time is stored as integer nanoseconds: Tick arithmetic and comparisons never lose precision.
+	*	The float interface (constructor, cast) stays in microseconds.
 	*/
 	class Tick
 	{
-		/// The handled time.
-		float mTime = 0.0f;
+		/// The handled time (in nanoseconds).
+		int64 mTime = 0;
 
 	public:
+		/// Constant to convert Ticks to NanoSeconds.
+		static constexpr int64 ToNanoSeconds = 1000;
+
 		/// Constant to convert Ticks to MilliSeconds.
 		static constexpr float ToMilliSeconds = 1.0f / 1000.0f;
 
@@ -96,6 +101,23 @@ namespace Sa
 		*/
 		SA_ENGINE_API explicit Tick(Hour _time) noexcept;
 
+		/**
+		*	\brief Create a Tick from integer nanoseconds (no precision loss).
+		*
+		*	\param[in] _ns		Time in nanoseconds.
+		*
+		*	\return created Tick.
+		*/
+		SA_ENGINE_API static Tick FromNanoSeconds(int64 _ns) noexcept;
+
+
+		/**
+		*	\brief \e Getter of the handled time in integer nanoseconds.
+		*
+		*	\return time in nanoseconds.
+		*/
+		SA_ENGINE_API int64 GetNanoSeconds() const noexcept;
+
 
 		/**
 		*	\brief Access the handled value.
@@ -131,6 +153,98 @@ namespace Sa
 		*	\return \c Hour converted from \c Tick.
 		*/
 		SA_ENGINE_API operator Hour() const noexcept;
+
+
+		/**
+		*	\brief \b Add two Ticks.
+		*
+		*	\param[in] _rhs	Tick to add.
+		*
+		*	\return sum of the Ticks.
+		*/
+		SA_ENGINE_API Tick operator+(Tick _rhs) const noexcept;
+
+		/**
+		*	\brief \b Subtract two Ticks.
+		*
+		*	\param[in] _rhs	Tick to subtract.
+		*
+		*	\return difference of the Ticks.
+		*/
+		SA_ENGINE_API Tick operator-(Tick _rhs) const noexcept;
+
+		/**
+		*	\brief \b Add a Tick to this.
+		*
+		*	\param[in] _rhs	Tick to add.
+		*
+		*	\return this instance.
+		*/
+		SA_ENGINE_API Tick& operator+=(Tick _rhs) noexcept;
+
+		/**
+		*	\brief \b Subtract a Tick to this.
+		*
+		*	\param[in] _rhs	Tick to subtract.
+		*
+		*	\return this instance.
+		*/
+		SA_ENGINE_API Tick& operator-=(Tick _rhs) noexcept;
+
+
+		/**
+		*	\brief \e Compare 2 Ticks equality.
+		*
+		*	\param[in] _rhs	Other Tick to compare to.
+		*
+		*	\return Whether this and _rhs are equal.
+		*/
+		SA_ENGINE_API bool operator==(Tick _rhs) const noexcept;
+
+		/**
+		*	\brief \e Compare 2 Ticks inequality.
+		*
+		*	\param[in] _rhs	Other Tick to compare to.
+		*
+		*	\return Whether this and _rhs are non-equal.
+		*/
+		SA_ENGINE_API bool operator!=(Tick _rhs) const noexcept;
+
+		/**
+		*	\brief \e Compare 2 Ticks.
+		*
+		*	\param[in] _rhs	Other Tick to compare to.
+		*
+		*	\return Whether this is less than _rhs.
+		*/
+		SA_ENGINE_API bool operator<(Tick _rhs) const noexcept;
+
+		/**
+		*	\brief \e Compare 2 Ticks.
+		*
+		*	\param[in] _rhs	Other Tick to compare to.
+		*
+		*	\return Whether this is less or equal to _rhs.
+		*/
+		SA_ENGINE_API bool operator<=(Tick _rhs) const noexcept;
+
+		/**
+		*	\brief \e Compare 2 Ticks.
+		*
+		*	\param[in] _rhs	Other Tick to compare to.
+		*
+		*	\return Whether this is greater than _rhs.
+		*/
+		SA_ENGINE_API bool operator>(Tick _rhs) const noexcept;
+
+		/**
+		*	\brief \e Compare 2 Ticks.
+		*
+		*	\param[in] _rhs	Other Tick to compare to.
+		*
+		*	\return Whether this is greater or equal to _rhs.
+		*/
+		SA_ENGINE_API bool operator>=(Tick _rhs) const noexcept;
 	};
 
 	/**
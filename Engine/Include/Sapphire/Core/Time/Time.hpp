@@ -41,9 +41,6 @@ namespace Sa
 		{
 			/// Queried start time value.
 			const uint64 start = 0u;
-
-			/// Queried hardware frequency value.
-			const float hardwareFrequency = 0.0f;
 		};
 		/// \endcond Internal
 
@@ -54,13 +51,6 @@ namespace Sa
 		*/
 		const uint64 mStart = 0u;
 
-		/**
-		*	\brief Hardware dependant constant to convert <b> hardware ticks </b> to <b> Sappire's ticks </b> (multiplication).
-		*
-		*	Windows implementation.
-		*/
-		const float mHardwareFrequency = -1.0f;
-
 		/**
 		*	\brief \e Value Constructor to init constants.
 		*
@@ -78,11 +68,11 @@ namespace Sa
 #else
 
 		/**
-		*	\brief Queried time at the beginnig of the program (in ticks).
+		*	\brief Queried time at the beginnig of the program (in nanoseconds).
 		*
 		*	Unix implementation.
 		*/
-		const Tick mStart = 0.0f;
+		const int64 mStart = 0;
 
 		/**
 		*	\brief \e Default Constructor.
@@ -97,6 +87,9 @@ namespace Sa
 		static Time sInstance;
 
 	public:
+		/// Default final slice of SleepUntil() spinned on NanoSeconds() instead of sleeping (in nanoseconds).
+		static constexpr int64 SleepSpinTime = 100000;
+
 
 		/**
 		*	\brief Get the time in \c seconds since the beginning of the program.
@@ -112,6 +105,17 @@ namespace Sa
 		*/
 		SA_ENGINE_API static Tick Ticks();
 
+		/**
+		*	\brief Get the monotonic high-resolution clock time in integer nanoseconds.
+		*
+		*	Unix: CLOCK_MONOTONIC_RAW (not slewed by NTP). Windows: QueryPerformanceCounter.
+		*	Arbitrary origin: only differences are meaningful.
+		*	See CpuClock for a cheaper calibrated CPU counter.
+		*
+		*	\return time in nanoseconds.
+		*/
+		SA_ENGINE_API static int64 NanoSeconds() noexcept;
+
 		/**
 		*	\brief Get the current local date time.
 		*
@@ -119,6 +123,24 @@ namespace Sa
 		*/
 		SA_ENGINE_API static DateTime Date() noexcept;
 
+		/**
+		*	\brief Convert a timestamp (see Timestamp()) to local date time.
+		*
+		*	\param[in] _timestamp	Seconds since the Epoch.
+		*
+		*	\return local date time.
+		*/
+		SA_ENGINE_API static DateTime Date(uint64 _timestamp) noexcept;
+
+		/**
+		*	\brief Get the current timestamp: seconds since the Epoch.
+		*
+		*	Cheaper than Date(): no calendar conversion. Convert later with Date(uint64).
+		*
+		*	\return current timestamp.
+		*/
+		SA_ENGINE_API static uint64 Timestamp() noexcept;
+
 		/**
 		*	\brief Get the current date time at Greenwich.
 		*
@@ -139,9 +161,23 @@ namespace Sa
 		/**
 		*	\brief Sleep the program for an amount of time (in millisecond).
 		*
+		*	OS sleep only (SleepUntil() without spin): may overshoot by the OS timer slack.
+		*
 		*	\param[in] _ms		Amount of time to sleep in millisecond.
 		*/
 		SA_ENGINE_API static void Sleep(MilliSecond _ms) noexcept;
+
+		/**
+		*	\brief Sleep the calling thread until a NanoSeconds() deadline.
+		*
+		*	Sleep on the OS timer (Unix: absolute clock_nanosleep, no drift on interruption;
+		*	Windows: high resolution waitable timer, or timeBeginPeriod(1) on older systems) until
+		*	_spinTime before the deadline, then spin on NanoSeconds(): OS timer slack is not overshot.
+		*
+		*	\param[in] _deadline	Wake-up time (see NanoSeconds()).
+		*	\param[in] _spinTime	Final slice to spin (in nanoseconds).
+		*/
+		SA_ENGINE_API static void SleepUntil(int64 _deadline, int64 _spinTime = SleepSpinTime) noexcept;
 	};
 
 
@@ -6,144 +6,193 @@
 #define SAPPHIRE_CORE_EVENT_GUARD
 
 #include <vector>
+#include <type_traits>
 
 #include <Collections/Debug>
 
+#include <Core/Types/Int.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/FutexMutex.hpp>
+#include <Core/Thread/ThreadMode.hpp>
+
 namespace Sa
 {
 	namespace Internal
 	{
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		class EventBase
+		/**
+		*	\brief Bound function or member function of an Event.
+		*
+		*	The function pointer is stored inline: no heap allocation per binding.
+		*/
+		template <typename R, typename... Args>
+		struct EventDelegate
 		{
-		protected:
-			std::vector<FuncHandle> mFunctions;
-			std::vector<FuncMemberHandle> mMemberFunctions;
+			/// Inline storage size: fit any member function pointer.
+			static constexpr uint32 StorageSize = 3u * sizeof(void*);
 
-		public:
-			EventBase() = default;
+			/// Bound object (nullptr for free functions).
+			void* caller = nullptr;
 
-			EventBase(EventBase&&) = delete;
-			EventBase(const EventBase&) = delete;
+			/// Function or member function pointer.
+			alignas(void*) uint8 func[StorageSize]{};
 
-			~EventBase();
+			/// Type-erased call of func on caller.
+			R(*invoke)(const EventDelegate&, const Args&...) = nullptr;
 
+			/// Optional output of the call result.
+			R* result = nullptr;
 
-			bool IsEmpty() const noexcept;
 
-			void Clear();
+			static EventDelegate Create(R(*_func)(Args...), R* _result = nullptr) noexcept;
 
+			template <typename C>
+			static EventDelegate Create(C* _caller, R(C::* _func)(Args...), R* _result = nullptr) noexcept;
 
-			void Add(R(*_func)(Args...));
+			/// Whether both delegates bind the same function (result ignored).
+			bool IsSame(const EventDelegate& _other) const noexcept;
 
-			template <typename C>
-			void Add(C* _caller, R(C::* _func)(Args...));
+			void Execute(const Args&... _args) const;
+		};
 
 
-			void Remove(R(*_func)(Args...));
+		/**
+		*	\brief \e Internal Event implementation <b>ThreadMode dependant</b>.
+		*/
+		template <ThreadMode thMode, typename R, typename... Args>
+		class EventBase;
 
-			template <typename C>
-			void Remove(const C* _caller, R(C::* _func)(Args...));
+		/**
+		*	\brief \e Internal Event \b thread-unsafe implementation.
+		*/
+		template <typename R, typename... Args>
+		class EventBase<ThreadMode::Unsafe, R, Args...>
+		{
+		protected:
+			using Delegate = EventDelegate<R, Args...>;
 
+			std::vector<Delegate> mDelegates;
 
-			void RRemove(R(*_func)(Args...));
+			void Add(const Delegate& _delegate);
+			void Remove(const Delegate& _delegate, bool _bReverse);
 
-			template <typename C>
-			void RRemove(const C* _caller, R(C::* _func)(Args...));
+		public:
+			EventBase() = default;
 
+			EventBase(EventBase&&) = delete;
+			EventBase(const EventBase&) = delete;
+
+			bool IsEmpty() const noexcept;
 
-			void Execute(const Args&... _args);
+			void Clear();
 
+			void Execute(const Args&... _args) const;
 
 			EventBase& operator=(EventBase&&) = delete;
 			EventBase& operator=(const EventBase&) = delete;
-
-			void operator+=(R(*_func)(Args...));
-			void operator-=(R(*_func)(Args...));
-
-			void operator()(const Args&... _args);
 		};
 
-		struct FuncMemberDataBase
+		/**
+		*	\brief \e Internal Event \b thread-safe implementation.
+		*
+		*	Copy-on-write subscriber list: Add / Remove copy the list under a lock and publish it atomically.
+		*	Execute() is lock-free and allocation-free: it reads the current list snapshot.
+		*	Replaced lists are freed once no Execute() is running (quiescent state).
+		*	Add / Remove may be called from a callback during Execute().
+		*/
+		template <typename R, typename... Args>
+		class EventBase<ThreadMode::Safe, R, Args...>
 		{
-			// Ensure correct destruction on delete.
-			virtual ~FuncMemberDataBase() = default;
-		};
+		protected:
+			using Delegate = EventDelegate<R, Args...>;
+			using List = std::vector<Delegate>;
 
-		template <typename C, typename R, typename... Args>
-		struct FuncMemberData : public FuncMemberDataBase
-		{
-			C* caller = nullptr;
-			R(C::* func)(Args...) = nullptr;
+			/// Current subscriber list (immutable once published).
+			Atomic<const List*> mList = nullptr;
 
-			FuncMemberData(C* _caller, R(C::* _func)(Args...)) :
-				caller{ _caller },
-				func{ _func }
-			{}
-		};
+			/// Number of running Execute().
+			mutable Atomic<uint32> mReaderNum = 0u;
 
+			/// Serialize writers.
+			FutexMutex mWriteMutex;
 
-		template <typename... Args>
-		struct FuncHandle_void
-		{
-			void(*func)(Args...) = nullptr;
-		};
+			/// Replaced lists waiting for running Execute() to end (guarded by mWriteMutex).
+			std::vector<const List*> mRetired;
 
-		template <typename... Args>
-		struct FuncMemberHandle_void
-		{
-			FuncMemberDataBase* data = nullptr;
-			void(*func)(void*, Args...) = nullptr;
-		};
+			/// Publish a new list and retire the previous one (mWriteMutex locked).
+			void Publish(const List* _list);
 
+			void Add(const Delegate& _delegate);
+			void Remove(const Delegate& _delegate, bool _bReverse);
 
-		template <typename R, typename... Args>
-		struct FuncHandle_R
-		{
-			R(*func)(Args...) = nullptr;
-			R* result = nullptr;
-		};
+		public:
+			EventBase() = default;
 
-		template <typename R, typename... Args>
-		struct FuncMemberHandle_R
-		{
-			FuncMemberDataBase* data = nullptr;
-			R(*func)(void*, Args...) = nullptr;
-			R* result = nullptr;
+			EventBase(EventBase&&) = delete;
+			EventBase(const EventBase&) = delete;
+
+			~EventBase();
+
+			bool IsEmpty() const noexcept;
+
+			void Clear();
+
+			void Execute(const Args&... _args) const;
+
+			EventBase& operator=(EventBase&&) = delete;
+			EventBase& operator=(const EventBase&) = delete;
 		};
 	}
 
 
-	template <typename R, typename... Args>
+	/**
+	*	\brief Multicast delegate: call every bound function on Execute().
+	*
+	*	\tparam Sig		Function signature: R(Args...).
+	*	\tparam thMode	Thread-mode. Safe allows Add / Remove during concurrent Execute().
+	*/
+	template <typename Sig, ThreadMode thMode = ThreadMode::Unsafe>
 	class Event;
 
-	template <typename... Args>
-	class Event<void(Args...)> : public Internal::EventBase<Internal::FuncHandle_void<Args...>, Internal::FuncMemberHandle_void<Args...>, void, Args...>
+	template <typename R, typename... Args, ThreadMode thMode>
+	class Event<R(Args...), thMode> : public Internal::EventBase<thMode, R, Args...>
 	{
-	};
+		using Base = Internal::EventBase<thMode, R, Args...>;
+		using Delegate = typename Base::Delegate;
 
+	public:
+		using Base::Execute;
 
-	template <typename R, typename... Args>
-	class Event<R(Args...)> : public Internal::EventBase<Internal::FuncHandle_R<R, Args...>, Internal::FuncMemberHandle_R<R, Args...>, R, Args...>
-	{
-		using FuncHandle = Internal::FuncHandle_R<R, Args...>;
-		using FuncMemberHandle = Internal::FuncMemberHandle_R<R, Args...>;
-		using Base = Internal::EventBase<FuncHandle, FuncMemberHandle, R, Args...>;
+		void Add(R(*_func)(Args...));
 
-		using Base::mFunctions;
-		using Base::mMemberFunctions;
+		template <typename C>
+		void Add(C* _caller, R(C::* _func)(Args...));
 
-	public:
-		using Base::Add;
+		/// Add with result output (non-void R only).
+		template <typename T = R, typename = std::enable_if_t<!std::is_void_v<T>>>
+		void Add(R(*_func)(Args...), T* _result);
+
+		/// Add with result output (non-void R only).
+		template <typename C, typename T = R, typename = std::enable_if_t<!std::is_void_v<T>>>
+		void Add(C* _caller, R(C::* _func)(Args...), T* _result);
+
+
+		void Remove(R(*_func)(Args...));
+
+		template <typename C>
+		void Remove(const C* _caller, R(C::* _func)(Args...));
 
-		void Add(R(*_func)(Args...), R* _result);
+
+		void RRemove(R(*_func)(Args...));
 
 		template <typename C>
-		void Add(C * _caller, R(C:: * _func)(Args...), R* _result);
+		void RRemove(const C* _caller, R(C::* _func)(Args...));
+
 
-		void Execute(const Args&... _args);
+		void operator+=(R(*_func)(Args...));
+		void operator-=(R(*_func)(Args...));
 
-		void operator()(const Args&... _args);
+		void operator()(const Args&... _args) const;
 	};
 }
 
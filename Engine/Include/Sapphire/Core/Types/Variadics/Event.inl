@@ -1,230 +1,326 @@
 // Copyright 2020 Sapphire development team. All Rights Reserved.
 
+#include <cstring>
+
 namespace Sa
 {
 	namespace Internal
 	{
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		EventBase<FuncHandle, FuncMemberHandle, R, Args...>::~EventBase()
+		template <typename R, typename... Args>
+		EventDelegate<R, Args...> EventDelegate<R, Args...>::Create(R(*_func)(Args...), R* _result) noexcept
 		{
-			Clear();
-		}
+			using Func = R(*)(Args...);
 
+			EventDelegate delegate;
 
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		bool EventBase<FuncHandle, FuncMemberHandle, R, Args...>::IsEmpty() const noexcept
-		{
-			return mFunctions.size() == 0 && mMemberFunctions.size() == 0;
+			std::memcpy(delegate.func, &_func, sizeof(Func));
+
+			delegate.invoke = [](const EventDelegate& _delegate, const Args&... _args) -> R
+			{
+				Func func = nullptr;
+				std::memcpy(&func, _delegate.func, sizeof(Func));
+
+				return func(_args...);
+			};
+
+			delegate.result = _result;
+
+			return delegate;
 		}
 
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::Clear()
+		template <typename R, typename... Args>
+		template <typename C>
+		EventDelegate<R, Args...> EventDelegate<R, Args...>::Create(C* _caller, R(C::* _func)(Args...), R* _result) noexcept
 		{
-			mFunctions.clear();
+			using Func = R(C::*)(Args...);
+
+			static_assert(sizeof(Func) <= StorageSize, "Member function pointer doesn't fit in EventDelegate storage!");
+
+			EventDelegate delegate;
 
-			for (auto it = mMemberFunctions.begin(); it != mMemberFunctions.end(); ++it)
+			delegate.caller = _caller;
+
+			std::memcpy(delegate.func, &_func, sizeof(Func));
+
+			delegate.invoke = [](const EventDelegate& _delegate, const Args&... _args) -> R
 			{
-				SA_ASSERT(it->data, Nullptr, Tools, L"Internal function call: data nullptr!");
+				Func func = nullptr;
+				std::memcpy(&func, _delegate.func, sizeof(Func));
 
-				delete it->data;
-			}
+				return (static_cast<C*>(_delegate.caller)->*func)(_args...);
+			};
 
-			mMemberFunctions.clear();
-		}
+			delegate.result = _result;
 
+			return delegate;
+		}
 
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::Add(R(*_func)(Args...))
+		template <typename R, typename... Args>
+		bool EventDelegate<R, Args...>::IsSame(const EventDelegate& _other) const noexcept
 		{
-			SA_ASSERT(_func, Nullptr, Tools, L"Add nullptr function!");
-
-			mFunctions.push_back(FuncHandle{ _func });
+			return caller == _other.caller && std::memcmp(func, _other.func, StorageSize) == 0;
 		}
 
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		template <typename C>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::Add(C* _caller, R(C::* _func)(Args...))
+		template <typename R, typename... Args>
+		void EventDelegate<R, Args...>::Execute(const Args&... _args) const
 		{
-			SA_ASSERT(_caller, Nullptr, Tools, L"Add nullptr caller!");
-			SA_ASSERT(_func, Nullptr, Tools, L"Add nullptr function!");
+			if constexpr (std::is_void_v<R>)
+				invoke(*this, _args...);
+			else
+			{
+				if (result)
+					*result = invoke(*this, _args...);
+				else
+					invoke(*this, _args...);
+			}
+		}
 
-			mMemberFunctions.push_back(FuncMemberHandle{
-				new FuncMemberData<C, R, Args...>{ _caller, _func },
 
-				[](void* _data, Args... _args)
-				{
-					FuncMemberData<C, R, Args...>* cData = reinterpret_cast<FuncMemberData<C, R, Args...>*>(_data);
+//{ Unsafe
 
-					SA_ASSERT(cData, Nullptr, Tools, L"Internal function call: data nullptr!");
+		template <typename R, typename... Args>
+		bool EventBase<ThreadMode::Unsafe, R, Args...>::IsEmpty() const noexcept
+		{
+			return mDelegates.empty();
+		}
 
-					return (cData->caller->*cData->func)(_args...);
-				}
-			});
+		template <typename R, typename... Args>
+		void EventBase<ThreadMode::Unsafe, R, Args...>::Clear()
+		{
+			mDelegates.clear();
 		}
 
+		template <typename R, typename... Args>
+		void EventBase<ThreadMode::Unsafe, R, Args...>::Add(const Delegate& _delegate)
+		{
+			mDelegates.push_back(_delegate);
+		}
 
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::Remove(R(*_func)(Args...))
+		template <typename R, typename... Args>
+		void EventBase<ThreadMode::Unsafe, R, Args...>::Remove(const Delegate& _delegate, bool _bReverse)
 		{
-			SA_ASSERT(_func, Nullptr, Tools, L"Remove nullptr function!");
+			const uint32 num = static_cast<uint32>(mDelegates.size());
 
-			for (auto it = mFunctions.begin(); it != mFunctions.end(); ++it)
+			for (uint32 i = 0u; i < num; ++i)
 			{
-				if (it->func == _func)
+				const uint32 index = _bReverse ? num - 1u - i : i;
+
+				if (mDelegates[index].IsSame(_delegate))
 				{
-					mFunctions.erase(it);
+					mDelegates.erase(mDelegates.begin() + index);
 					return;
 				}
 			}
 		}
 
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		template <typename C>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::Remove(const C* _caller, R(C::* _func)(Args...))
+		template <typename R, typename... Args>
+		void EventBase<ThreadMode::Unsafe, R, Args...>::Execute(const Args&... _args) const
 		{
-			SA_ASSERT(_caller, Nullptr, Tools, L"Remove nullptr caller!");
-			SA_ASSERT(_func, Nullptr, Tools, L"Remove nullptr function!");
-
-			for (auto it = mMemberFunctions.begin(); it != mMemberFunctions.end(); ++it)
+			// Index loop and copy: a callback may add or remove delegates.
+			for (uint32 i = 0u; i < mDelegates.size(); ++i)
 			{
-				FuncMemberData<C, R, Args...>* data = reinterpret_cast<FuncMemberData<C, R, Args...>*>(it->data);
-
-				SA_ASSERT(data, Nullptr, Tools, L"Internal function call: data nullptr!");
-
-				if (data->caller == _caller && data->func == _func)
-				{
-					delete data;
+				const Delegate delegate = mDelegates[i];
 
-					mMemberFunctions.erase(it);
-					return;
-				}
+				delegate.Execute(_args...);
 			}
 		}
 
+//}
 
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::RRemove(R(*_func)(Args...))
+//{ Safe
+
+		template <typename R, typename... Args>
+		EventBase<ThreadMode::Safe, R, Args...>::~EventBase()
 		{
-			SA_ASSERT(_func, Nullptr, Tools, L"RRemove nullptr function!");
+			delete mList.Get(MemoryOrder::Acquire);
 
-			for (auto it = mFunctions.rbegin(); it != mFunctions.rend(); ++it)
-			{
-				if (it->func == _func)
-				{
-					mFunctions.erase(it);
-					return;
-				}
-			}
+			for (const List* list : mRetired)
+				delete list;
 		}
 
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		template <typename C>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::RRemove(const C* _caller, R(C::* _func)(Args...))
+		template <typename R, typename... Args>
+		bool EventBase<ThreadMode::Safe, R, Args...>::IsEmpty() const noexcept
 		{
-			SA_ASSERT(_caller, Nullptr, Tools, L"RRemove nullptr caller!");
-			SA_ASSERT(_func, Nullptr, Tools, L"RRemove nullptr function!");
+			const List* const list = mList.Get(MemoryOrder::Acquire);
 
-			for (auto it = mMemberFunctions.rbegin(); it != mMemberFunctions.rend(); ++it)
-			{
-				FuncMemberData<C, R, Args...>* data = reinterpret_cast<FuncMemberData<C, R, Args...>*>(it->data);
+			return !list || list->empty();
+		}
 
-				SA_ASSERT(data, Nullptr, Tools, L"Internal function call: data nullptr!");
+		template <typename R, typename... Args>
+		void EventBase<ThreadMode::Safe, R, Args...>::Publish(const List* _list)
+		{
+			const List* const prev = mList.Exchange(_list, MemoryOrder::SeqCst);
 
-				if (data->caller == _caller && data->func == _func)
-				{
-					delete data;
+			if (prev)
+				mRetired.push_back(prev);
 
-					mMemberFunctions.erase(it);
-					return;
-				}
+			// No running Execute(): nobody can still read a retired list.
+			// Readers starting from now load the new list.
+			if (mReaderNum.Get(MemoryOrder::SeqCst) == 0u)
+			{
+				for (const List* list : mRetired)
+					delete list;
+
+				mRetired.clear();
 			}
 		}
 
-
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::Execute(const Args&... _args)
+		template <typename R, typename... Args>
+		void EventBase<ThreadMode::Safe, R, Args...>::Clear()
 		{
-			for (auto it = mFunctions.begin(); it != mFunctions.end(); ++it)
-				it->func(_args...);
+			RAII<FutexMutex> lock(mWriteMutex);
 
-			for (auto it = mMemberFunctions.begin(); it != mMemberFunctions.end(); ++it)
-				it->func(it->data, _args...);
+			Publish(nullptr);
 		}
 
-
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::operator+=(R(*_func)(Args...))
+		template <typename R, typename... Args>
+		void EventBase<ThreadMode::Safe, R, Args...>::Add(const Delegate& _delegate)
 		{
-			Add(_func);
+			RAII<FutexMutex> lock(mWriteMutex);
+
+			const List* const prev = mList.Get(MemoryOrder::Relaxed);
+			List* const list = prev ? new List(*prev) : new List();
+
+			list->push_back(_delegate);
+
+			Publish(list);
 		}
 
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::operator-=(R(*_func)(Args...))
+		template <typename R, typename... Args>
+		void EventBase<ThreadMode::Safe, R, Args...>::Remove(const Delegate& _delegate, bool _bReverse)
 		{
-			Remove(_func);
+			RAII<FutexMutex> lock(mWriteMutex);
+
+			const List* const prev = mList.Get(MemoryOrder::Relaxed);
+
+			if (!prev)
+				return;
+
+			const uint32 num = static_cast<uint32>(prev->size());
+
+			for (uint32 i = 0u; i < num; ++i)
+			{
+				const uint32 index = _bReverse ? num - 1u - i : i;
+
+				if ((*prev)[index].IsSame(_delegate))
+				{
+					List* const list = new List(*prev);
+					list->erase(list->begin() + index);
+
+					Publish(list);
+					return;
+				}
+			}
 		}
 
-		template <typename FuncHandle, typename FuncMemberHandle, typename R, typename... Args>
-		void EventBase<FuncHandle, FuncMemberHandle, R, Args...>::operator()(const Args&... _args)
+		template <typename R, typename... Args>
+		void EventBase<ThreadMode::Safe, R, Args...>::Execute(const Args&... _args) const
 		{
-			Execute(_args...);
+			mReaderNum.FetchAdd(1u, MemoryOrder::SeqCst);
+
+			if (const List* const list = mList.Get(MemoryOrder::SeqCst))
+			{
+				for (const Delegate& delegate : *list)
+					delegate.Execute(_args...);
+			}
+
+			mReaderNum.FetchSub(1u, MemoryOrder::Release);
 		}
+
+//}
 	}
 
 
-	template <typename R, typename... Args>
-	void Event<R(Args...)>::Add(R(*_func)(Args...), R* _result)
+	template <typename R, typename... Args, ThreadMode thMode>
+	void Event<R(Args...), thMode>::Add(R(*_func)(Args...))
 	{
 		SA_ASSERT(_func, Nullptr, Tools, L"Add nullptr function!");
 
-		mFunctions.push_back(FuncHandle{ _func, _result });
+		Base::Add(Delegate::Create(_func));
 	}
 
-	template <typename R, typename... Args>
+	template <typename R, typename... Args, ThreadMode thMode>
 	template <typename C>
-	void Event<R(Args...)>::Add(C* _caller, R(C::* _func)(Args...), R* _result)
+	void Event<R(Args...), thMode>::Add(C* _caller, R(C::* _func)(Args...))
 	{
 		SA_ASSERT(_caller, Nullptr, Tools, L"Add nullptr caller!");
 		SA_ASSERT(_func, Nullptr, Tools, L"Add nullptr function!");
 
-		mMemberFunctions.push_back(FuncMemberHandle{
-			new Internal::FuncMemberData<C, R, Args...>{ _caller, _func },
+		Base::Add(Delegate::Create(_caller, _func));
+	}
 
-			[](void* _data, Args... _args)
-			{
-				Internal::FuncMemberData<C, R, Args...>* cData = reinterpret_cast<Internal::FuncMemberData<C, R, Args...>*>(_data);
+	template <typename R, typename... Args, ThreadMode thMode>
+	template <typename T, typename>
+	void Event<R(Args...), thMode>::Add(R(*_func)(Args...), T* _result)
+	{
+		SA_ASSERT(_func, Nullptr, Tools, L"Add nullptr function!");
 
-				SA_ASSERT(cData, Nullptr, Tools, L"Internal function call: data nullptr!");
+		Base::Add(Delegate::Create(_func, _result));
+	}
 
-				return (cData->caller->*cData->func)(_args...);
-			},
+	template <typename R, typename... Args, ThreadMode thMode>
+	template <typename C, typename T, typename>
+	void Event<R(Args...), thMode>::Add(C* _caller, R(C::* _func)(Args...), T* _result)
+	{
+		SA_ASSERT(_caller, Nullptr, Tools, L"Add nullptr caller!");
+		SA_ASSERT(_func, Nullptr, Tools, L"Add nullptr function!");
 
-			_result
-		});
+		Base::Add(Delegate::Create(_caller, _func, _result));
 	}
 
-	template <typename R, typename... Args>
-	void Event<R(Args...)>::Execute(const Args&... _args)
+
+	template <typename R, typename... Args, ThreadMode thMode>
+	void Event<R(Args...), thMode>::Remove(R(*_func)(Args...))
 	{
-		for (auto it = mFunctions.begin(); it != mFunctions.end(); ++it)
-		{
-			if(it->result)
-				*it->result = it->func(_args...);
-			else
-				it->func(_args...);
-		}
+		SA_ASSERT(_func, Nullptr, Tools, L"Remove nullptr function!");
 
-		for (auto it = mMemberFunctions.begin(); it != mMemberFunctions.end(); ++it)
-		{
-			if(it->result)
-				*it->result = it->func(it->data, _args...);
-			else
-				it->func(it->data, _args...);
-		}
+		Base::Remove(Delegate::Create(_func), false);
+	}
+
+	template <typename R, typename... Args, ThreadMode thMode>
+	template <typename C>
+	void Event<R(Args...), thMode>::Remove(const C* _caller, R(C::* _func)(Args...))
+	{
+		SA_ASSERT(_caller, Nullptr, Tools, L"Remove nullptr caller!");
+		SA_ASSERT(_func, Nullptr, Tools, L"Remove nullptr function!");
+
+		Base::Remove(Delegate::Create(const_cast<C*>(_caller), _func), false);
+	}
+
+
+	template <typename R, typename... Args, ThreadMode thMode>
+	void Event<R(Args...), thMode>::RRemove(R(*_func)(Args...))
+	{
+		SA_ASSERT(_func, Nullptr, Tools, L"RRemove nullptr function!");
+
+		Base::Remove(Delegate::Create(_func), true);
+	}
+
+	template <typename R, typename... Args, ThreadMode thMode>
+	template <typename C>
+	void Event<R(Args...), thMode>::RRemove(const C* _caller, R(C::* _func)(Args...))
+	{
+		SA_ASSERT(_caller, Nullptr, Tools, L"RRemove nullptr caller!");
+		SA_ASSERT(_func, Nullptr, Tools, L"RRemove nullptr function!");
+
+		Base::Remove(Delegate::Create(const_cast<C*>(_caller), _func), true);
+	}
+
+
+	template <typename R, typename... Args, ThreadMode thMode>
+	void Event<R(Args...), thMode>::operator+=(R(*_func)(Args...))
+	{
+		Add(_func);
+	}
+
+	template <typename R, typename... Args, ThreadMode thMode>
+	void Event<R(Args...), thMode>::operator-=(R(*_func)(Args...))
+	{
+		Remove(_func);
 	}
 
-	template <typename R, typename... Args>
-	void Event<R(Args...)>::operator()(const Args&... _args)
+	template <typename R, typename... Args, ThreadMode thMode>
+	void Event<R(Args...), thMode>::operator()(const Args&... _args) const
 	{
 		Execute(_args...);
 	}
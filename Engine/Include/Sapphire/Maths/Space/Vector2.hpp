@@ -5,6 +5,8 @@
 #ifndef SAPPHIRE_MATHS_VECTOR2_GUARD
 #define SAPPHIRE_MATHS_VECTOR2_GUARD
 
+#include <Core/Algorithms/Hash.hpp>
+
 #include <Maths/Misc/Maths.hpp>
 
 namespace Sa
@@ -668,6 +670,21 @@ namespace Sa
 	using Vector2d = Vector2<double>;
 
 
+
+	/**
+	*	\brief Hash functor specialization for Vec2: combine the component hashes.
+	*
+	*	-0.0 and 0.0 components hash the same.
+	*	Components equal within the operator== threshold but not exactly may hash differently.
+	*
+	*	\tparam T	Type of the vector.
+	*/
+	template <typename T>
+	struct Hash<Vec2<T>>
+	{
+		uint64 operator()(const Vec2<T>& _vec) const noexcept;
+	};
+
 	/** \} */
 }
 
@@ -442,4 +442,11 @@ namespace Sa
 
 		return Vec2(_lhs / _rhs.x, _lhs / _rhs.y);
 	}
+
+
+	template <typename T>
+	uint64 Hash<Vec2<T>>::operator()(const Vec2<T>& _vec) const noexcept
+	{
+		return HashCombine(Hash<T>()(_vec.x), Hash<T>()(_vec.y));
+	}
 }
@@ -5,6 +5,8 @@
 #ifndef SAPPHIRE_MATHS_VECTOR3_GUARD
 #define SAPPHIRE_MATHS_VECTOR3_GUARD
 
+#include <Core/Algorithms/Hash.hpp>
+
 #include <Maths/Misc/Maths.hpp>
 
 namespace Sa
@@ -671,6 +673,21 @@ namespace Sa
 	using Vector3d = Vector3<double>;
 
 
+
+	/**
+	*	\brief Hash functor specialization for Vec3: combine the component hashes.
+	*
+	*	-0.0 and 0.0 components hash the same.
+	*	Components equal within the operator== threshold but not exactly may hash differently.
+	*
+	*	\tparam T	Type of the vector.
+	*/
+	template <typename T>
+	struct Hash<Vec3<T>>
+	{
+		uint64 operator()(const Vec3<T>& _vec) const noexcept;
+	};
+
 	/** \} */
 }
 
@@ -519,4 +519,11 @@ namespace Sa
 
 		return Vec3(_lhs / _rhs.x, _lhs / _rhs.y, _lhs / _rhs.z);
 	}
+
+
+	template <typename T>
+	uint64 Hash<Vec3<T>>::operator()(const Vec3<T>& _vec) const noexcept
+	{
+		return HashCombine(HashCombine(Hash<T>()(_vec.x), Hash<T>()(_vec.y)), Hash<T>()(_vec.z));
+	}
 }
@@ -5,6 +5,10 @@
 #ifndef SAPPHIRE_RENDERING_IFRAME_BUFFER_GUARD
 #define SAPPHIRE_RENDERING_IFRAME_BUFFER_GUARD
 
+#include <Core/Config.hpp>
+#include <Core/Misc/Macro.hpp>
+#include <Core/Memory/FrameArena.hpp>
+
 #include <Rendering/Framework/Buffers/IImageBuffer.hpp>
 
 namespace Sa
@@ -17,13 +21,54 @@ namespace Sa
 		virtual void Begin() = 0;
 		virtual void NextSubpass() = 0;
 		virtual void End() = 0;
+
+		// GPU profile scope (name in static storage), see SA_GPU_PROFILE_SCOPE.
+		virtual void BeginGpuScope(const char* _name) = 0;
+		virtual void EndGpuScope() = 0;
+	};
+
+	// RAII GPU profile scope on a frame buffer.
+	class GpuProfileScope
+	{
+		IFrameBuffer& mBuffer;
+
+	public:
+		GpuProfileScope(IFrameBuffer& _buffer, const char* _name) : mBuffer{ _buffer }
+		{
+			mBuffer.BeginGpuScope(_name);
+		}
+
+		GpuProfileScope(GpuProfileScope&&) = delete;
+		GpuProfileScope(const GpuProfileScope&) = delete;
+
+		~GpuProfileScope()
+		{
+			mBuffer.EndGpuScope();
+		}
+
+		GpuProfileScope& operator=(GpuProfileScope&&) = delete;
+		GpuProfileScope& operator=(const GpuProfileScope&) = delete;
 	};
 
 	struct RenderFrame
 	{
 		const uint32 index = ~uint32();
 		IFrameBuffer& buffer;
+
+		// Temporary allocations of this frame (reset when the frame comes back).
+		FrameArena& arena;
 	};
 }
 
+#if SA_PROFILING
+
+	// Profile the current scope on the GPU (_name: string literal).
+	#define SA_GPU_PROFILE_SCOPE(_buffer, _name) const Sa::GpuProfileScope SA_CONCAT(__saGpuProfileScope, __LINE__)(_buffer, _name)
+
+#else
+
+	#define SA_GPU_PROFILE_SCOPE(...)
+
+#endif
+
 #endif // GUARD
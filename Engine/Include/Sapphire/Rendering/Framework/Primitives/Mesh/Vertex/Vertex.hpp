@@ -30,6 +30,16 @@ namespace Sa
 		bool operator==(const Vertex& _rhs) const noexcept;
 		bool operator!=(const Vertex& _rhs) const noexcept;
 	};
+
+
+	/**
+	*	\brief Hash functor specialization for Vertex: combine the component hashes (no padding, -0.0 == 0.0).
+	*/
+	template <VertexComp Comps>
+	struct Hash<Vertex<Comps>>
+	{
+		uint64 operator()(const Vertex<Comps>& _vertex) const noexcept;
+	};
 }
 
 #include <Rendering/Framework/Primitives/Mesh/Vertex/Vertex.inl>
@@ -75,4 +75,28 @@ namespace Sa
 	{
 		return !(*this == _rhs);
 	}
+
+
+	template <VertexComp Comps>
+	uint64 Hash<Vertex<Comps>>::operator()(const Vertex<Comps>& _vertex) const noexcept
+	{
+		uint64 hash = 0u;
+
+		if constexpr ((Comps & VertexComp::Position) != VertexComp::None)
+			hash = HashCombine(hash, Hash<Vec3f>()(_vertex.position));
+
+		if constexpr ((Comps & VertexComp::Normal) != VertexComp::None)
+			hash = HashCombine(hash, Hash<Vec3f>()(_vertex.normal));
+
+		if constexpr ((Comps & VertexComp::Tangent) != VertexComp::None)
+			hash = HashCombine(hash, Hash<Vec3f>()(_vertex.tangent));
+
+		if constexpr ((Comps & VertexComp::Texture) != VertexComp::None)
+			hash = HashCombine(hash, Hash<Vec2f>()(_vertex.texture));
+
+		if constexpr ((Comps & VertexComp::Color) != VertexComp::None)
+			hash = HashCombine(hash, Hash<Vec3f>()(_vertex.color));
+
+		return hash;
+	}
 }
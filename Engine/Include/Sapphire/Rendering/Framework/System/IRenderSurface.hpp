@@ -24,6 +24,9 @@ namespace Sa
 	public:
 		virtual Format GetFormat() const noexcept = 0;
 
+		// Whether presentation blocks on vertical blank (see FrameLimitMode::WaitForPresent).
+		virtual bool IsPresentPaced() const noexcept = 0;
+
 		virtual void Create(const IRenderInstance& _instance) = 0;
 		virtual void Destroy(const IRenderInstance& _instance) = 0;
 
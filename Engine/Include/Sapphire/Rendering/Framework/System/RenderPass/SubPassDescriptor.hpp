@@ -37,6 +37,9 @@ namespace Sa
 
 	struct SubPassDescriptor
 	{
+		// Name in GPU profiles (static storage).
+		const char* name = "Subpass";
+
 		// All color attachment must have the same sample count.
 		SampleBits sampling = SampleBits::Sample1Bit;
 
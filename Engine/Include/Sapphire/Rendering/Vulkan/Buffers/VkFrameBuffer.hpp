@@ -18,6 +18,7 @@ namespace Sa::Vk
 {
 	class Device;
 	class RenderPass;
+	class GpuProfiler;
 
 	class FrameBuffer : public IFrameBuffer
 	{
@@ -30,6 +31,12 @@ namespace Sa::Vk
 		std::vector<ImageBuffer> mInputAttachments;
 		std::vector<VkClearValue> mClearValues;
 
+		// Subpass names of GPU profiles.
+		std::vector<const char*> mSubpassNames;
+		uint32 mSubpassIndex = 0u;
+
+		GpuProfiler* mGpuProfiler = nullptr;
+
 		void AddClearColor(Format _format, const Color& _clearColor);
 
 	public:
@@ -45,6 +52,12 @@ namespace Sa::Vk
 		void Begin() override final;
 		void NextSubpass() override final;
 		void End() override final;
+
+		void BeginGpuScope(const char* _name) override final;
+		void EndGpuScope() override final;
+
+		// Record GPU timestamps of subpasses and scopes (nullptr to disable).
+		void SetGpuProfiler(GpuProfiler* _profiler) noexcept;
 	};
 }
 
@@ -5,6 +5,8 @@
 #ifndef SAPPHIRE_RENDERING_VK_MATERIAL_GUARD
 #define SAPPHIRE_RENDERING_VK_MATERIAL_GUARD
 
+#include <Core/Memory/ArenaAllocator.hpp>
+
 #include <Rendering/Framework/Primitives/Material/IMaterial.hpp>
 
 #include <Rendering/APIConfig.hpp>
@@ -30,9 +32,9 @@ namespace Sa::Vk
 		
 		void CountDescriptors(const MaterialBindingInfos& _binding, uint32& _bufferDescSize, uint32& _imageDescSize) const noexcept;
 		void FillDescriptorWrites(const MaterialBindingInfos& _binding,
-			std::vector<VkDescriptorBufferInfo>& _bufferDescs,
-			std::vector<VkDescriptorImageInfo>& _imageDescs,
-			std::vector<VkWriteDescriptorSet>& _descWrites,
+			ScratchVector<VkDescriptorBufferInfo>& _bufferDescs,
+			ScratchVector<VkDescriptorImageInfo>& _imageDescs,
+			ScratchVector<VkWriteDescriptorSet>& _descWrites,
 			uint32 _descIndex = uint32 (-1)) const noexcept;
 		
 		void DestroyDescriptorSets(const Device& _device);
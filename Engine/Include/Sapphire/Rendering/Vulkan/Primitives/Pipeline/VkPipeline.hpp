@@ -5,6 +5,8 @@
 #ifndef SAPPHIRE_RENDERING_VK_PIPELINE_GUARD
 #define SAPPHIRE_RENDERING_VK_PIPELINE_GUARD
 
+#include <Core/Memory/ArenaAllocator.hpp>
+
 #include <Rendering/Framework/Primitives/Pipeline/IPipeline.hpp>
 
 #include <Rendering/APIConfig.hpp>
@@ -34,7 +36,7 @@ namespace Sa::Vk
 		void DestroyPipelineHandle(const Device& _device);
 
 
-		void FillShaderStages(std::vector<VkPipelineShaderStageCreateInfo>& _stages, const std::vector<PipelineShaderInfos>& _shaders);
+		void FillShaderStages(ScratchVector<VkPipelineShaderStageCreateInfo>& _stages, const std::vector<PipelineShaderInfos>& _shaders);
 		
 		static void FillVertexBindings(VkPipelineVertexInputStateCreateInfo& _vertexInputInfo, std::unique_ptr<VkVertexInputBindingDescription>& _bindingDesc,
 			std::unique_ptr<VkVertexInputAttributeDescription[]>& _attribDescs, const VertexBindingLayout& _vertexBindingLayout) noexcept;
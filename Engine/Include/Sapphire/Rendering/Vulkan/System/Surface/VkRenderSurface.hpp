@@ -32,6 +32,7 @@ namespace Sa::Vk
 		RenderSurface(VkSurfaceKHR _handle) noexcept;
 
 		Format GetFormat() const noexcept override final;
+		bool IsPresentPaced() const noexcept override final;
 
 		void Create(const IRenderInstance& _instance) override final;
 		void Destroy(const IRenderInstance& _instance) override final;
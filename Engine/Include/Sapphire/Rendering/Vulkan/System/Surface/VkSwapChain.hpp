@@ -5,8 +5,12 @@
 #ifndef SAPPHIRE_RENDERING_VK_SWAP_CHAIN_GUARD
 #define SAPPHIRE_RENDERING_VK_SWAP_CHAIN_GUARD
 
+#include <Core/Memory/PoolAllocator.hpp>
+
 #include <Rendering/Vulkan/Buffers/VkFrameBuffer.hpp>
 
+#include <Rendering/Vulkan/System/VkGpuProfiler.hpp>
+
 #if SA_RENDERING_API == SA_VULKAN
 
 namespace Sa::Vk
@@ -22,6 +26,7 @@ namespace Sa::Vk
 
 		Vec2ui mExtent;
 		Format mFormat = Format::sRGBA_32;
+		VkPresentModeKHR mPresentMode = VK_PRESENT_MODE_FIFO_KHR;
 
 		uint32 mImageNum = 1u;
 		uint32 mFrameIndex = 0u;
@@ -32,11 +37,19 @@ namespace Sa::Vk
 			VkSemaphore acquireSemaphore = VK_NULL_HANDLE;
 			VkSemaphore presentSemaphore = VK_NULL_HANDLE;
 			VkFence		fence = VK_NULL_HANDLE;
+
+			// Graphics submit time, 0 once the fence was observed signaled.
+			int64 submitTime = 0;
 		};
 
 		std::vector<Synchronisation> mFramesSynch;
 
 		std::vector<FrameBuffer*> mFrameBuffers;
+		PoolAllocator<FrameBuffer, 4u> mFrameBufferPool;
+
+		FrameArena mFrameArena;
+
+		GpuProfiler mGpuProfiler;
 
 
 		void CreateSwapChainKHR(const Device& _device, const RenderSurface& _surface);
@@ -45,9 +58,17 @@ namespace Sa::Vk
 		void CreateSynchronisation(const Device& _device);
 		void DestroySynchronisation(const Device& _device);
 
+		void RecordGpuLatency(Synchronisation& _synch, int64 _now);
+		void PollGpuLatencies(const Device& _device);
+
 	public:
+		static constexpr uint64 FrameArenaCapacity = 1024u * 1024u;
+
 		Format GetFormat() const noexcept;
 
+		// FIFO present modes block on vertical blank.
+		bool IsPresentPaced() const noexcept;
+
 		void Create(const Device& _device, const RenderSurface& _surface);
 		void Destroy(const Device& _device);
 
@@ -0,0 +1,90 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_RENDERING_VK_GPU_PROFILER_GUARD
+#define SAPPHIRE_RENDERING_VK_GPU_PROFILER_GUARD
+
+#include <vector>
+
+#include <Core/Types/Int.hpp>
+
+#include <Rendering/APIConfig.hpp>
+
+#if SA_RENDERING_API == SA_VULKAN
+
+namespace Sa::Vk
+{
+	class Device;
+	class CommandBuffer;
+
+	/**
+	*	\brief GPU timestamp profiler: one VkQueryPool per frame in flight.
+	*
+	*	Scopes write vkCmdWriteTimestamp pairs in the frame command buffer.
+	*	Results are read back without blocking when the frame slot is reused (its fence is signaled),
+	*	converted to Profiler::GetTime() domain and pushed to the "GPU" profiler track.
+	*/
+	class SA_ENGINE_API GpuProfiler
+	{
+		struct Scope
+		{
+			const char* name = nullptr;
+			uint32 depth = 0u;
+		};
+
+		struct FrameQueries
+		{
+			VkQueryPool pool = VK_NULL_HANDLE;
+
+			// Recorded scopes: timestamps 2 * i (begin) and 2 * i + 1 (end).
+			std::vector<Scope> scopes;
+		};
+
+		std::vector<FrameQueries> mFrames;
+		uint32 mFrameIndex = 0u;
+
+		// Open scope indices of the current frame (~uint32() for dropped scopes).
+		std::vector<uint32> mOpenScopes;
+
+		std::vector<uint64> mResults;
+
+		// GPU ticks to nanoseconds.
+		double mTimestampPeriod = 1.0;
+		uint64 mTimestampMask = ~uint64();
+
+		// Calibration: matching GPU ticks and Profiler::GetTime().
+		uint64 mGpuReference = 0u;
+		uint64 mCpuReference = 0u;
+
+		uint32 mTrack = ~uint32();
+
+		bool mbSupported = false;
+
+		void Calibrate(const Device& _device);
+
+		uint64 ToProfilerTime(uint64 _ticks) const noexcept;
+
+	public:
+		// Max scopes per frame.
+		static constexpr uint32 MaxScopeNum = 64u;
+
+		bool IsSupported() const noexcept;
+
+		void Create(const Device& _device, uint32 _frameNum);
+		void Destroy(const Device& _device);
+
+		// Read back the previous results of the frame slot (fence must be signaled) and select it.
+		void NewFrame(const Device& _device, uint32 _frameIndex);
+
+		// Reset the frame queries: outside of a render pass, first command of the frame.
+		void BeginCommands(const CommandBuffer& _commandBuffer);
+
+		void BeginScope(const CommandBuffer& _commandBuffer, const char* _name);
+		void EndScope(const CommandBuffer& _commandBuffer);
+	};
+}
+
+#endif
+
+#endif // GUARD
@@ -21,8 +21,12 @@ namespace Sa::Vk
 
 #else
 
-	// Still execute vk method.
-	#define SA_VK_ASSERT(_predicate, ...) { _predicate; }
+	// Still execute vk method. Device lost: dump flight recorder (done by assertion failure in debug).
+	#define SA_VK_ASSERT(_predicate, ...)\
+	{\
+		if (SA_UNLIKELY((_predicate) == VK_ERROR_DEVICE_LOST))\
+			Sa::FlightRecorder::Dump("Vulkan device lost");\
+	}
 
 #endif
 }
@@ -5,6 +5,8 @@
 #ifndef SAPPHIRE_RENDERING_VK_RENDER_INSTANCE_GUARD
 #define SAPPHIRE_RENDERING_VK_RENDER_INSTANCE_GUARD
 
+#include <Core/Memory/PoolAllocator.hpp>
+
 #include <Rendering/Framework/System/IRenderInstance.hpp>
 
 #include <Rendering/Vulkan/System/VkValidationLayers.hpp>
@@ -25,6 +27,8 @@ namespace Sa::Vk
 
 #endif
 
+		PoolAllocator<RenderSurface, 4u> mSurfacePool;
+
 	public:
 		Device device;
 		
@@ -26,13 +26,16 @@ namespace Sa
 	class SA_ENGINE_API IWindow : public IInterface
 	{
 	public:
-		mutable Event<void(const IWindow&, uint32, uint32)> onResizeEvent;
+		mutable Event<void(const IWindow&, uint32, uint32), ThreadMode::Safe> onResizeEvent;
 
 		virtual void Create(uint32 _width, uint32 _height, const char* _name = "Main Window") = 0;
 		virtual void Destroy() = 0;
 
 		virtual void Update() = 0;
 
+		// Sync point: call events queued by Update() (ex: onResizeEvent).
+		virtual void DispatchEvents() = 0;
+
 		virtual bool ShouldClose() const = 0;
 
 #if SA_RENDERING_API == SA_VULKAN
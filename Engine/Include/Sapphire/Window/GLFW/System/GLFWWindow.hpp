@@ -5,6 +5,8 @@
 #ifndef SAPPHIRE_WINDOW_GLFW_WINDOW_GUARD
 #define SAPPHIRE_WINDOW_GLFW_WINDOW_GUARD
 
+#include <Core/Thread/EventQueue.hpp>
+
 #include <Window/Framework/System/IWindow.hpp>
 
 
@@ -21,6 +23,15 @@ namespace Sa::GLFW
 	{
 		GLFWwindow* mHandle = nullptr;
 
+		struct ResizeEvent
+		{
+			uint32 width = 0u;
+			uint32 height = 0u;
+		};
+
+		// Filled by GLFW callbacks, dispatched by DispatchEvents().
+		EventQueue<ResizeEvent> mResizeEvents;
+
 		static void ResizeCallback(GLFWwindow* _handle, int32 _width, int32 _height);
 
 	public:
@@ -28,6 +39,7 @@ namespace Sa::GLFW
 		void Destroy() override final;
 
 		void Update() override final;
+		void DispatchEvents() override final;
 
 		bool ShouldClose() const override final;
 
@@ -0,0 +1,278 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Algorithms/MemStream.hpp>
+
+#include <cstring> // std::mem*
+
+#include <Core/Support/Compilers.hpp>
+#include <Core/Support/Architectures.hpp>
+
+#if defined(__SSE2__) || (SA_MSVC && SA_x64)
+
+	/// Whether MemStream algorithms use SSE2 / AVX2 instructions.
+	#define SA_MEM_STREAM_SIMD 1
+
+	#include <immintrin.h>
+
+	#if SA_MSVC
+
+		#include <intrin.h>
+
+		/// Enable AVX2 intrinsics in a function (MSVC: always available).
+		#define SA_MEM_STREAM_AVX2_TARGET
+
+	#else
+
+		/// Enable AVX2 intrinsics in a function (no global -mavx2).
+		#define SA_MEM_STREAM_AVX2_TARGET __attribute__((target("avx2")))
+
+	#endif
+
+#else
+
+	/// Whether MemStream algorithms use SSE2 / AVX2 instructions.
+	#define SA_MEM_STREAM_SIMD 0
+
+#endif
+
+namespace Sa
+{
+	/**
+	*	Under this size, std::mem* is faster: data likely stays in cache (ex: per-frame uniform buffer update)
+	*	and head / tail handling and fence cost are not amortized.
+	*/
+	static constexpr uint64 sStreamMinSize = 4096u;
+
+
+#if SA_MEM_STREAM_SIMD
+
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// Bytes from _ptr to the next _align boundary.
+		static uint64 BytesToAlign(const void* _ptr, uint64 _align) noexcept
+		{
+			return (_align - (reinterpret_cast<uint64>(_ptr) & (_align - 1u))) & (_align - 1u);
+		}
+
+		static bool HasAVX2() noexcept
+		{
+#if SA_MSVC
+
+			int regs[4];
+			__cpuid(regs, 0);
+
+			if (regs[0] < 7)
+				return false;
+
+			// OS saves YMM registers.
+			__cpuid(regs, 1);
+
+			if (!(regs[2] & (1 << 27)) || (_xgetbv(0) & 0x6) != 0x6)
+				return false;
+
+			__cpuidex(regs, 7, 0);
+
+			return (regs[1] & (1 << 5)) != 0;
+
+#else
+
+			// May run before constructors calling it.
+			__builtin_cpu_init();
+
+			return __builtin_cpu_supports("avx2");
+
+#endif
+		}
+
+		/// Whether AVX2 path is used (resolved once).
+		static const bool sUseAVX2 = HasAVX2();
+
+
+		static void StreamCopySSE2(const uint8* _src, uint8* _dest, uint64 _size) noexcept
+		{
+			for (; _size >= 64u; _size -= 64u, _src += 64u, _dest += 64u)
+			{
+				const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_src));
+				const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_src + 16u));
+				const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_src + 32u));
+				const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_src + 48u));
+
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest), r0);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest + 16u), r1);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest + 32u), r2);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest + 48u), r3);
+			}
+
+			for (; _size >= 16u; _size -= 16u, _src += 16u, _dest += 16u)
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest), _mm_loadu_si128(reinterpret_cast<const __m128i*>(_src)));
+		}
+
+		SA_MEM_STREAM_AVX2_TARGET
+		static void StreamCopyAVX2(const uint8* _src, uint8* _dest, uint64 _size) noexcept
+		{
+			for (; _size >= 128u; _size -= 128u, _src += 128u, _dest += 128u)
+			{
+				const __m256i r0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_src));
+				const __m256i r1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_src + 32u));
+				const __m256i r2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_src + 64u));
+				const __m256i r3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_src + 96u));
+
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(_dest), r0);
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(_dest + 32u), r1);
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(_dest + 64u), r2);
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(_dest + 96u), r3);
+			}
+
+			for (; _size >= 32u; _size -= 32u, _src += 32u, _dest += 32u)
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(_dest), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_src)));
+		}
+
+		/// _size must be a multiple of 32: pattern period is up to 32 bytes.
+		static void StreamFillSSE2(uint8* _dest, const uint8* _pattern, uint64 _size) noexcept
+		{
+			const __m128i p0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_pattern));
+			const __m128i p1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_pattern + 16u));
+
+			for (; _size >= 64u; _size -= 64u, _dest += 64u)
+			{
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest), p0);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest + 16u), p1);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest + 32u), p0);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest + 48u), p1);
+			}
+
+			if (_size)
+			{
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest), p0);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(_dest + 16u), p1);
+			}
+		}
+
+		/// _size must be a multiple of 32.
+		SA_MEM_STREAM_AVX2_TARGET
+		static void StreamFillAVX2(uint8* _dest, const uint8* _pattern, uint64 _size) noexcept
+		{
+			const __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_pattern));
+
+			for (; _size >= 128u; _size -= 128u, _dest += 128u)
+			{
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(_dest), p);
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(_dest + 32u), p);
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(_dest + 64u), p);
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(_dest + 96u), p);
+			}
+
+			for (; _size >= 32u; _size -= 32u, _dest += 32u)
+				_mm256_stream_si256(reinterpret_cast<__m256i*>(_dest), p);
+		}
+	}
+
+	/// \endcond Internal
+
+#endif
+
+
+	void MemStreamCopy(const void* _src, void* _dest, uint64 _size) noexcept
+	{
+#if SA_MEM_STREAM_SIMD
+
+		if (_size >= sStreamMinSize)
+		{
+			const uint8* src = static_cast<const uint8*>(_src);
+			uint8* dest = static_cast<uint8*>(_dest);
+
+			const uint64 vecSize = Internal::sUseAVX2 ? 32u : 16u;
+
+			// Regular copy until dest is vector aligned.
+			const uint64 head = Internal::BytesToAlign(dest, vecSize);
+			std::memcpy(dest, src, head);
+
+			src += head;
+			dest += head;
+			_size -= head;
+
+			const uint64 body = _size & ~(vecSize - 1u);
+
+			if (Internal::sUseAVX2)
+				Internal::StreamCopyAVX2(src, dest, body);
+			else
+				Internal::StreamCopySSE2(src, dest, body);
+
+			std::memcpy(dest + body, src + body, _size - body);
+
+			// Order streaming stores before following stores (ex: buffer unmap / submit flag).
+			_mm_sfence();
+
+			return;
+		}
+
+#endif
+
+		std::memcpy(_dest, _src, _size);
+	}
+
+	void MemStreamFill(void* _dest, const void* _pattern, uint32 _patternSize, uint64 _size) noexcept
+	{
+		uint8* dest = static_cast<uint8*>(_dest);
+		const uint8* pattern = static_cast<const uint8*>(_pattern);
+
+#if SA_MEM_STREAM_SIMD
+
+		if (_size >= sStreamMinSize && 32u % _patternSize == 0u)
+		{
+			// Pattern repeated on 2 vectors: vector pattern starts at any phase.
+			alignas(32) uint8 repeated[64];
+
+			for (uint32 i = 0u; i < 64u; i += _patternSize)
+				std::memcpy(repeated + i, pattern, _patternSize);
+
+			const uint64 vecSize = Internal::sUseAVX2 ? 32u : 16u;
+
+			// Regular fill until dest is vector aligned.
+			const uint64 head = Internal::BytesToAlign(dest, vecSize);
+			std::memcpy(dest, repeated, head);
+
+			const uint8* const phased = repeated + head % _patternSize;
+
+			const uint64 body = (_size - head) & ~uint64(31u);
+
+			if (Internal::sUseAVX2)
+				Internal::StreamFillAVX2(dest + head, phased, body);
+			else
+				Internal::StreamFillSSE2(dest + head, phased, body);
+
+			// Tail starts at the same phase: body is a multiple of 32, so of _patternSize.
+			std::memcpy(dest + head + body, phased, _size - head - body);
+
+			_mm_sfence();
+
+			return;
+		}
+
+#endif
+
+		if (_patternSize == 1u)
+		{
+			std::memset(dest, *pattern, _size);
+			return;
+		}
+
+		for (uint64 i = 0u; i + _patternSize <= _size; i += _patternSize)
+			std::memcpy(dest + i, pattern, _patternSize);
+	}
+
+	const char8* GetMemStreamISA() noexcept
+	{
+#if SA_MEM_STREAM_SIMD
+
+		return Internal::sUseAVX2 ? "AVX2" : "SSE2";
+
+#else
+
+		return "Scalar";
+
+#endif
+	}
+}
@@ -0,0 +1,98 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Debug/CrashHandler.hpp>
+
+#include <csignal>
+
+#include <Core/Support/Platforms.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+
+namespace Sa
+{
+	/// Handled fatal signals.
+	static constexpr int sCrashSignals[] =
+	{
+		SIGSEGV,
+		SIGILL,
+		SIGFPE,
+		SIGABRT,
+#if SA_UNIX
+		SIGBUS,
+#endif
+	};
+
+	/// Number of handled signals.
+	static constexpr uint32 sCrashSignalNum = sizeof(sCrashSignals) / sizeof(int);
+
+	/// Handlers replaced by crash handlers.
+	static void (*sPrevSignalHandlers[sCrashSignalNum])(int) = {};
+
+	/// Hooks, called in CrashStage order.
+	static Atomic<CrashHandler::Hook> sHooks[static_cast<uint32>(CrashStage::Count)];
+
+	/// Whether handlers are installed.
+	static Atomic<uint32> sbInstalled;
+
+
+	static const char* GetSignalReason(int _signal) noexcept
+	{
+		switch (_signal)
+		{
+			case SIGSEGV:
+				return "Fatal signal SIGSEGV";
+			case SIGILL:
+				return "Fatal signal SIGILL";
+			case SIGFPE:
+				return "Fatal signal SIGFPE";
+			case SIGABRT:
+				return "Fatal signal SIGABRT";
+#if SA_UNIX
+			case SIGBUS:
+				return "Fatal signal SIGBUS";
+#endif
+			default:
+				return "Fatal signal";
+		}
+	}
+
+	static void SignalHandler(int _signal)
+	{
+		const char* const reason = GetSignalReason(_signal);
+
+		for (uint32 i = 0u; i < static_cast<uint32>(CrashStage::Count); ++i)
+		{
+			if (const CrashHandler::Hook hook = sHooks[i].Get(MemoryOrder::Acquire))
+				hook(reason);
+		}
+
+		for (uint32 i = 0u; i < sCrashSignalNum; ++i)
+		{
+			if (sCrashSignals[i] == _signal)
+			{
+				void (*prev)(int) = sPrevSignalHandlers[i];
+				std::signal(_signal, prev == SIG_ERR || prev == nullptr ? SIG_DFL : prev);
+				break;
+			}
+		}
+
+		std::raise(_signal);
+	}
+
+
+	void CrashHandler::SetHook(CrashStage _stage, Hook _hook) noexcept
+	{
+		sHooks[static_cast<uint32>(_stage)].Set(_hook, MemoryOrder::Release);
+
+		Install();
+	}
+
+	void CrashHandler::Install() noexcept
+	{
+		if (sbInstalled.Get(MemoryOrder::Relaxed) || sbInstalled.Exchange(1u))
+			return;
+
+		for (uint32 i = 0u; i < sCrashSignalNum; ++i)
+			sPrevSignalHandlers[i] = std::signal(sCrashSignals[i], &SignalHandler);
+	}
+}
@@ -3,14 +3,45 @@
 #include <iostream>
 
 #include <Core/Debug/Debug.hpp>
+#include <Core/Debug/Logger.hpp>
+
+#include <Core/Thread/SharedMutex.hpp>
+#include <Core/Containers/FlatHashMap.hpp>
 
 namespace Sa
 {
 #if SA_LOGGING || SA_ASSERTION
 
-	std::vector<LogChannel> Debug::channels{ LogChannel(L"Default") };
+	/// Guard channels: read on every log, written on channel (un)registration only.
+	static SharedMutex sChannelsMutex;
+
+	/// Default channel: always registered (function-local: may log during static initialization).
+	static LogChannel& GetDefaultChannel()
+	{
+		static LogChannel channel(L"Default");
+
+		return channel;
+	}
+
+	/// Registered channels by ID (function-local: channels are registered during static initialization).
+	static FlatHashMap<StringId, LogChannel*>& GetChannels()
+	{
+		// Never destroyed: channels may log until the end of static destruction.
+		static FlatHashMap<StringId, LogChannel*>* const channels = new FlatHashMap<StringId, LogChannel*>();
+
+		return *channels;
+	}
+
+#if SA_ASSERT_TRACE_SUCCESS
+
+	LogLvlFlags Debug::levelMask = LogLvlFlags(LogLvlFlag::Normal | LogLvlFlag::Infos | LogLvlFlag::Warning | LogLvlFlag::Error | LogLvlFlag::AssertSuccess | LogLvlFlag::AssertFailed);
+
+#else
+
 	LogLvlFlags Debug::levelMask = LogLvlFlags(LogLvlFlag::Normal | LogLvlFlag::Infos | LogLvlFlag::Warning | LogLvlFlag::Error | LogLvlFlag::AssertFailed);
 
+#endif
+
 	const wchar* Debug::GetFileNameFromPath(const wchar* _filePath) noexcept
 	{
 		// Remove characters until last backslash.
@@ -32,42 +63,54 @@ namespace Sa
 		return fileName;
 	}
 
-	LogChannel& Debug::GetChannel(const wchar* _name)
+	LogChannel& Debug::GetChannel(StringId _id, const wchar* _name) noexcept
 	{
-		SA_ASSERT(_name, InvalidParam, Default, L"Param _name is nullptr!")
+		// Don't assert in channel lookup: assertion creation looks up channels.
+
+		if (_id == SA_STRING_ID(L"Default"))
+			return GetDefaultChannel();
 
-		for (auto it = channels.begin(); it != channels.end(); ++it)
 		{
-			if (wcscmp(it->name, _name) == 0)
-				return *it;
+			RAII<SharedMutex> lock(sChannelsMutex, true);
+
+			if (LogChannel* const* chan = GetChannels().Find(_id))
+				return **chan;
 		}
 
-		SA_ASSERT(_name, InvalidParam, Default, L"No channel with name found!")
+		// First use of a channel without SA_LOG_CHAN_DEFINE.
+		return _name ? RegisterChannel(_name) : GetDefaultChannel();
+	}
 
-		return channels[0];
+	LogChannel& Debug::GetChannel(const wchar* _name) noexcept
+	{
+		return _name ? GetChannel(StringId(_name), _name) : GetDefaultChannel();
 	}
 
 	LogChannel& Debug::RegisterChannel(const wchar* _chan) noexcept
 	{
 		if (!_chan)
-			return channels[0];
+			return GetDefaultChannel();
+
+		const StringId id(_chan);
 
-		return channels.emplace_back(_chan);
+		if (id == SA_STRING_ID(L"Default"))
+			return GetDefaultChannel();
+
+		RAII<SharedMutex> lock(sChannelsMutex);
+
+		std::pair<LogChannel**, bool> res = GetChannels().Emplace(id, nullptr);
+
+		// Heap allocated: reference must survive table rehash. Never freed (see UnRegisterChannel()).
+		if (res.second)
+			*res.first = new LogChannel(_chan);
+
+		return **res.first;
 	}
 
 	void Debug::UnRegisterChannel(const wchar* _chan) noexcept
 	{
-		if (!_chan)
-			return;
-
-		for (auto it = channels.begin(); it != channels.end(); ++it)
-		{
-			if (wcscmp(it->name, _chan) == 0)
-			{
-				channels.erase(it);
-				return;
-			}
-		}
+		// Never freed: a thread may still log on a reference from GetChannel() (ex: during static destruction).
+		(void)_chan;
 	}
 
 
@@ -75,8 +118,33 @@ namespace Sa
 	{
 #if SA_LOGGING
 
+	#if SA_LOG_ASYNC
+
+		Logger::Push(_log);
+
+	#else
+
+		std::wcout << _log << std::endl;
+
+	#endif
+
+#endif
+	}
+
+	void Debug::LogImmediate_Internal(const Sa::Log& _log) noexcept
+	{
+#if SA_LOGGING
+
+	#if SA_LOG_ASYNC
+
+		Logger::WriteImmediate(_log);
+
+	#else
+
 		std::wcout << _log << std::endl;
 
+	#endif
+
 #endif
 	}
 
@@ -85,7 +153,19 @@ namespace Sa
 #if SA_LOGGING
 
 		if (levelMask.IsSet(_log.level) && _log.channel.enableLog)
+		{
+			FlightRecorder::RecordLog(_log);
 			Log_Internal(_log);
+		}
+
+#endif
+	}
+
+	void Debug::Flush() noexcept
+	{
+#if SA_LOGGING && SA_LOG_ASYNC
+
+		Logger::Flush();
 
 #endif
 	}
@@ -34,7 +34,8 @@ namespace Sa
 	void ExceptionBase::Output(std::wostream& _stream) const noexcept
 	{
 		// Output date.
-		_stream << '[' << date.hour << ':' << date.minute << ':' << date.second << "]\t";
+		OutputDate(_stream);
+		_stream << '\t';
 
 		// Output title.
 		_stream << 'E' << static_cast<uint16>(code) << '\t' << str << ": ";
@@ -50,4 +51,9 @@ namespace Sa
 		// Output location.
 		_stream << '\t' << file << ':' << line << " - " << function << '\n';
 	}
+
+	bool ExceptionBase::HasDetails() const noexcept
+	{
+		return true;
+	}
 }
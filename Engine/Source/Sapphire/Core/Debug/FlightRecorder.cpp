@@ -0,0 +1,545 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Debug/FlightRecorder.hpp>
+
+#include <sstream>
+
+#include <fcntl.h>
+
+#include <Core/Support/Platforms.hpp>
+
+#if SA_WIN
+
+	#include <io.h>
+	#include <sys/stat.h>
+
+#else
+
+	#include <unistd.h>
+
+#endif
+
+#include <Core/Debug/Log.hpp>
+#include <Core/Debug/CrashHandler.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/CacheLine.hpp>
+
+#include <Core/Time/Time.hpp>
+
+namespace Sa
+{
+#if SA_FLIGHT_RECORDER
+
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// Kind of flight record.
+		enum class FlightRecordKind : uint8
+		{
+			/// Log message.
+			Log,
+
+			/// Frame marker.
+			Frame,
+
+			/// GPU submission.
+			GpuSubmit,
+
+			/// User event.
+			Event,
+		};
+
+		/// Fixed-size flight record (2 cache lines).
+		struct alignas(CacheLineSize) FlightRecord
+		{
+			/// Record index + 1 once written, 0 while written.
+			Atomic<uint64> seq;
+
+			/// Record time (Time::NanoSeconds()).
+			uint64 time;
+
+			/// Frame number, submission ID or event value.
+			uint64 value;
+
+			/// Log's file (static storage).
+			const wchar* file;
+
+			/// Log's channel name (static storage).
+			const wchar* channel;
+
+			/// Log's line.
+			uint32 line;
+
+			/// Record kind.
+			FlightRecordKind kind;
+
+			/// Log's level.
+			LogLvlFlag level;
+
+			/// Log message, submission or event name (ASCII, truncated).
+			char text[FlightRecorder::MaxTextLength + 1u];
+		};
+
+		static_assert(sizeof(FlightRecord) == 2u * CacheLineSize, "FlightRecord size must be 2 cache lines!");
+	}
+
+	/// \endcond Internal
+
+	using namespace Internal;
+
+
+	/// Mask to wrap record indices.
+	static constexpr uint64 sRecordMask = FlightRecorder::Capacity - 1u;
+
+	static_assert((FlightRecorder::Capacity & sRecordMask) == 0u, "FlightRecorder capacity must be a power of 2!");
+
+	/// Preallocated records (zero-initialized: usable during static initialization).
+	static FlightRecord sRecords[FlightRecorder::Capacity];
+
+	/// Next record index.
+	alignas(CacheLineSize) static Atomic<uint64> sNextIndex;
+
+	/// Frame counter.
+	alignas(CacheLineSize) static Atomic<uint64> sFrameNum;
+
+	/// GPU submission counter.
+	static Atomic<uint64> sGpuSubmitNum;
+
+	/// Whether crash handlers are installed.
+	static Atomic<uint32> sbStarted;
+
+	/// Whether a dump is in progress.
+	static Atomic<uint32> sbDumping;
+
+	/// Dump file path.
+	static const char* sDumpPath = "SapphireFlightRecorder.log";
+
+
+	/// Max length of a formatted record line.
+	static constexpr uint64 sDumpLineSize = 384u;
+
+	/// Preallocated dump buffer: no allocation on crash.
+	static char sDumpBuffer[(FlightRecorder::Capacity + 4u) * sDumpLineSize];
+
+
+	static uint64 GetTimeNs() noexcept
+	{
+		// clock_gettime: async-signal-safe.
+		return static_cast<uint64>(Time::NanoSeconds());
+	}
+
+	template <typename CharT>
+	static void CopyText(char* _dst, const CharT* _src) noexcept
+	{
+		uint32 i = 0u;
+
+		if (_src)
+		{
+			// Non-ASCII characters are replaced: dump stays plain text.
+			for (; i < FlightRecorder::MaxTextLength && _src[i]; ++i)
+				_dst[i] = static_cast<uint32>(_src[i]) < 128u ? static_cast<char>(_src[i]) : '?';
+		}
+
+		_dst[i] = '\0';
+	}
+
+	/// Acquire and invalidate the next record.
+	static FlightRecord& BeginRecord(FlightRecordKind _kind, uint64& _index) noexcept
+	{
+		if (!sbStarted.Get(MemoryOrder::Relaxed) && !sbStarted.Exchange(1u))
+			FlightRecorder::InstallCrashHandlers();
+
+		_index = sNextIndex.FetchAdd(1u, MemoryOrder::Relaxed);
+
+		FlightRecord& record = sRecords[_index & sRecordMask];
+
+		// Seqlock: readers discard the record until seq is set.
+		// Lossy by design: a writer lapping the whole ring during this write may tear the record.
+		record.seq.Set(0u, MemoryOrder::Relaxed);
+		AtomicThreadFence(MemoryOrder::Release);
+
+		record.time = GetTimeNs();
+		record.kind = _kind;
+
+		return record;
+	}
+
+	static void EndRecord(FlightRecord& _record, uint64 _index) noexcept
+	{
+		_record.seq.Set(_index + 1u, MemoryOrder::Release);
+	}
+
+#endif
+
+	void FlightRecorder::RecordLog(const wchar* _str, LogLvlFlag _level, const wchar* _channel, const wchar* _file, uint32 _line) noexcept
+	{
+#if SA_FLIGHT_RECORDER
+
+		uint64 index = 0u;
+		FlightRecord& record = BeginRecord(FlightRecordKind::Log, index);
+
+		record.value = 0u;
+		record.file = _file;
+		record.channel = _channel;
+		record.line = _line;
+		record.level = _level;
+		CopyText(record.text, _str);
+
+		EndRecord(record, index);
+
+#else
+
+		(void)_str;
+		(void)_level;
+		(void)_channel;
+		(void)_file;
+		(void)_line;
+
+#endif
+	}
+
+	void FlightRecorder::RecordLog(const Log& _log) noexcept
+	{
+#if SA_FLIGHT_RECORDER
+
+		// Derived logs (exceptions) output details: keep the first line, without date.
+		if (_log.HasDetails())
+		{
+			std::wostringstream stream;
+			_log.Output(stream);
+
+			std::wstring text = stream.str();
+
+			const uint64 dateEnd = text.find(L'\t');
+
+			if (dateEnd != std::wstring::npos)
+				text.erase(0u, dateEnd + 1u);
+
+			const uint64 lineEnd = text.find(L'\n');
+
+			if (lineEnd != std::wstring::npos)
+				text.resize(lineEnd);
+
+			for (wchar& c : text)
+			{
+				if (c == L'\t')
+					c = L' ';
+			}
+
+			RecordLog(text.c_str(), _log.level, _log.channel.name, _log.file, _log.line);
+		}
+		else
+			RecordLog(_log.str, _log.level, _log.channel.name, _log.file, _log.line);
+
+#else
+
+		(void)_log;
+
+#endif
+	}
+
+	uint64 FlightRecorder::RecordFrame() noexcept
+	{
+#if SA_FLIGHT_RECORDER
+
+		const uint64 frame = sFrameNum.FetchAdd(1u, MemoryOrder::Relaxed);
+
+		uint64 index = 0u;
+		FlightRecord& record = BeginRecord(FlightRecordKind::Frame, index);
+
+		record.value = frame;
+		record.text[0] = '\0';
+
+		EndRecord(record, index);
+
+		return frame;
+
+#else
+
+		return 0u;
+
+#endif
+	}
+
+	uint64 FlightRecorder::RecordGpuSubmit(const char* _name) noexcept
+	{
+#if SA_FLIGHT_RECORDER
+
+		const uint64 id = sGpuSubmitNum.FetchAdd(1u, MemoryOrder::Relaxed);
+
+		uint64 index = 0u;
+		FlightRecord& record = BeginRecord(FlightRecordKind::GpuSubmit, index);
+
+		record.value = id;
+		CopyText(record.text, _name);
+
+		EndRecord(record, index);
+
+		return id;
+
+#else
+
+		(void)_name;
+
+		return 0u;
+
+#endif
+	}
+
+	void FlightRecorder::RecordEvent(const char* _name, uint64 _value) noexcept
+	{
+#if SA_FLIGHT_RECORDER
+
+		uint64 index = 0u;
+		FlightRecord& record = BeginRecord(FlightRecordKind::Event, index);
+
+		record.value = _value;
+		CopyText(record.text, _name);
+
+		EndRecord(record, index);
+
+#else
+
+		(void)_name;
+		(void)_value;
+
+#endif
+	}
+
+
+	void FlightRecorder::SetDumpPath(const char* _path) noexcept
+	{
+#if SA_FLIGHT_RECORDER
+
+		sDumpPath = _path;
+
+#else
+
+		(void)_path;
+
+#endif
+	}
+
+#if SA_FLIGHT_RECORDER
+
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// Bounded append into the dump buffer (async-signal-safe formatting).
+		struct DumpWriter
+		{
+			char* data = nullptr;
+			uint64 size = 0u;
+			uint64 capacity = 0u;
+
+			void Append(char _c) noexcept
+			{
+				if (size < capacity)
+					data[size++] = _c;
+			}
+
+			template <typename CharT>
+			void Append(const CharT* _str, uint32 _maxLen = 64u) noexcept
+			{
+				if (!_str)
+					return;
+
+				for (uint32 i = 0u; i < _maxLen && _str[i]; ++i)
+					Append(static_cast<uint32>(_str[i]) < 128u ? static_cast<char>(_str[i]) : '?');
+			}
+
+			void AppendUInt(uint64 _value, uint32 _minDigits = 1u) noexcept
+			{
+				char digits[20];
+				uint32 num = 0u;
+
+				do
+				{
+					digits[num++] = static_cast<char>('0' + _value % 10u);
+					_value /= 10u;
+				} while (_value);
+
+				for (; num < _minDigits; ++num)
+					digits[num] = '0';
+
+				while (num)
+					Append(digits[--num]);
+			}
+		};
+	}
+
+	/// \endcond Internal
+
+	static const wchar* GetFileName(const wchar* _path) noexcept
+	{
+		const wchar* name = _path;
+
+		for (const wchar* c = _path; *c; ++c)
+		{
+			if (*c == L'/' || *c == L'\\')
+				name = c + 1;
+		}
+
+		return name;
+	}
+
+	static void DumpRecord(DumpWriter& _writer, const FlightRecord& _record, uint64 _now) noexcept
+	{
+		// Time relative to the dump: "-12.345678 ms".
+		const uint64 delta = _now > _record.time ? _now - _record.time : 0u;
+
+		_writer.Append('-');
+		_writer.AppendUInt(delta / 1000000u);
+		_writer.Append('.');
+		_writer.AppendUInt(delta % 1000000u, 6u);
+		_writer.Append(" ms\t");
+
+		switch (_record.kind)
+		{
+			case FlightRecordKind::Log:
+				_writer.Append(GetLogLevelName(_record.level));
+				_writer.Append(" {");
+				_writer.Append(_record.channel);
+				_writer.Append("}\t");
+				_writer.Append(_record.text, FlightRecorder::MaxTextLength);
+
+				if (_record.file)
+				{
+					_writer.Append("\t(");
+					_writer.Append(GetFileName(_record.file));
+					_writer.Append(':');
+					_writer.AppendUInt(_record.line);
+					_writer.Append(')');
+				}
+				break;
+			case FlightRecordKind::Frame:
+				_writer.Append("Frame ");
+				_writer.AppendUInt(_record.value);
+				break;
+			case FlightRecordKind::GpuSubmit:
+				_writer.Append("GpuSubmit ");
+				_writer.AppendUInt(_record.value);
+				_writer.Append('\t');
+				_writer.Append(_record.text, FlightRecorder::MaxTextLength);
+				break;
+			case FlightRecordKind::Event:
+				_writer.Append("Event ");
+				_writer.Append(_record.text, FlightRecorder::MaxTextLength);
+				_writer.Append(" = ");
+				_writer.AppendUInt(_record.value);
+				break;
+			default:
+				break;
+		}
+
+		_writer.Append('\n');
+	}
+
+#endif
+
+	bool FlightRecorder::Dump(const char* _reason) noexcept
+	{
+#if SA_FLIGHT_RECORDER
+
+		const char* const path = sDumpPath;
+
+		if (!path || sbDumping.Exchange(1u))
+			return false;
+
+		const uint64 now = GetTimeNs();
+		const uint64 end = sNextIndex.Get(MemoryOrder::Acquire);
+		const uint64 begin = end > Capacity ? end - Capacity : 0u;
+
+		DumpWriter writer{ sDumpBuffer, 0u, sizeof(sDumpBuffer) };
+
+		writer.Append("Sapphire flight recorder: ");
+		writer.Append(_reason, 256u);
+		writer.Append("\nRecords: ");
+		writer.AppendUInt(end - begin);
+		writer.Append(" / ");
+		writer.AppendUInt(end);
+		writer.Append("\n\n");
+
+		for (uint64 i = begin; i < end; ++i)
+		{
+			const FlightRecord& slot = sRecords[i & sRecordMask];
+
+			if (slot.seq.Get(MemoryOrder::Acquire) != i + 1u)
+				continue;
+
+			FlightRecord record;
+			record.time = slot.time;
+			record.value = slot.value;
+			record.file = slot.file;
+			record.channel = slot.channel;
+			record.line = slot.line;
+			record.kind = slot.kind;
+			record.level = slot.level;
+
+			for (uint32 j = 0u; j <= MaxTextLength; ++j)
+				record.text[j] = slot.text[j];
+
+			record.text[MaxTextLength] = '\0';
+
+			// Overwritten while copied: discard.
+			AtomicThreadFence(MemoryOrder::Acquire);
+
+			if (slot.seq.Get(MemoryOrder::Relaxed) != i + 1u)
+				continue;
+
+			DumpRecord(writer, record, now);
+		}
+
+	#if SA_WIN
+
+		const int file = _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+		const bool bSuccess = file >= 0 && _write(file, sDumpBuffer, static_cast<unsigned int>(writer.size)) == static_cast<int>(writer.size);
+
+		if (file >= 0)
+			_close(file);
+
+	#else
+
+		const int file = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		const bool bSuccess = file >= 0 && write(file, sDumpBuffer, writer.size) == static_cast<ssize_t>(writer.size);
+
+		if (file >= 0)
+			close(file);
+
+	#endif
+
+		sbDumping.Set(0u, MemoryOrder::Release);
+
+		return bSuccess;
+
+#else
+
+		(void)_reason;
+
+		return false;
+
+#endif
+	}
+
+#if SA_FLIGHT_RECORDER
+
+	static void CrashDumpHook(const char* _reason)
+	{
+		FlightRecorder::Dump(_reason);
+	}
+
+#endif
+
+	void FlightRecorder::InstallCrashHandlers() noexcept
+	{
+#if SA_FLIGHT_RECORDER
+
+		// First stage: dump before any best-effort output.
+		CrashHandler::SetHook(CrashStage::Dump, &CrashDumpHook);
+
+#endif
+	}
+}
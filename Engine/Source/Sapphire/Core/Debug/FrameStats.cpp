@@ -0,0 +1,164 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Debug/FrameStats.hpp>
+
+#include <vector>
+#include <algorithm>
+
+#include <Core/Debug/FlightRecorder.hpp>
+
+#include <Core/Time/Time.hpp>
+
+namespace Sa
+{
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// Rolling window of samples.
+		struct FrameStatRing
+		{
+			/// Samples (circular).
+			int64 samples[FrameStats::Capacity];
+
+			/// Next write index.
+			uint32 pos = 0u;
+
+			/// Number of valid samples.
+			uint32 num = 0u;
+
+			/// Sum of the valid samples.
+			int64 sum = 0;
+
+
+			void Push(int64 _sample) noexcept
+			{
+				if (num == FrameStats::Capacity)
+					sum -= samples[pos];
+				else
+					++num;
+
+				samples[pos] = _sample;
+				sum += _sample;
+
+				pos = (pos + 1u) % FrameStats::Capacity;
+			}
+
+			int64 Average() const noexcept
+			{
+				return num ? sum / static_cast<int64>(num) : 0;
+			}
+		};
+	}
+
+	/// \endcond Internal
+
+	using namespace Internal;
+
+
+	/// Statistic windows.
+	static FrameStatRing sRings[static_cast<uint32>(FrameStat::Count)];
+
+	/// Previous NewFrame() time (0 before first frame).
+	static int64 sPrevFrameTime = 0;
+
+	/// Frame number.
+	static uint64 sFrameNum = 0u;
+
+	/// Stutter number.
+	static uint64 sStutterNum = 0u;
+
+	/// Frame time / rolling average ratio of a stutter.
+	static float sStutterFactor = 2.0f;
+
+
+	void FrameStats::NewFrame() noexcept
+	{
+		const int64 now = Time::NanoSeconds();
+
+		if (sPrevFrameTime != 0)
+		{
+			const int64 frameTime = now - sPrevFrameTime;
+			const FrameStatRing& ring = sRings[static_cast<uint32>(FrameStat::CpuFrame)];
+
+			// Compare to the average before pushing: a spike must not raise its own threshold.
+			if (ring.num >= StutterMinSampleNum &&
+				static_cast<float>(frameTime) > sStutterFactor * static_cast<float>(ring.Average()))
+			{
+				++sStutterNum;
+				FlightRecorder::RecordEvent("Stutter (ns)", static_cast<uint64>(frameTime));
+			}
+
+			Record(FrameStat::CpuFrame, frameTime);
+		}
+
+		sPrevFrameTime = now;
+		++sFrameNum;
+	}
+
+	void FrameStats::Record(FrameStat _stat, int64 _time) noexcept
+	{
+		sRings[static_cast<uint32>(_stat)].Push(_time);
+	}
+
+
+	FrameStatSummary FrameStats::GetSummary(FrameStat _stat)
+	{
+		const FrameStatRing& ring = sRings[static_cast<uint32>(_stat)];
+
+		FrameStatSummary summary;
+
+		if (ring.num == 0u)
+			return summary;
+
+		std::vector<int64> sorted(ring.samples, ring.samples + ring.num);
+		std::sort(sorted.begin(), sorted.end());
+
+		// Nearest-rank percentile.
+		auto percentile = [&sorted](uint32 _p)
+		{
+			const uint64 rank = (static_cast<uint64>(_p) * sorted.size() + 99u) / 100u;
+
+			return sorted[rank ? rank - 1u : 0u];
+		};
+
+		summary.sampleNum = ring.num;
+		summary.min = sorted.front();
+		summary.avg = ring.Average();
+		summary.p95 = percentile(95u);
+		summary.p99 = percentile(99u);
+		summary.max = sorted.back();
+
+		return summary;
+	}
+
+	uint64 FrameStats::GetFrameNum() noexcept
+	{
+		return sFrameNum;
+	}
+
+	uint64 FrameStats::GetStutterNum() noexcept
+	{
+		return sStutterNum;
+	}
+
+	float FrameStats::GetStutterFactor() noexcept
+	{
+		return sStutterFactor;
+	}
+
+	void FrameStats::SetStutterFactor(float _factor) noexcept
+	{
+		sStutterFactor = _factor;
+	}
+
+	void FrameStats::Reset() noexcept
+	{
+		for (FrameStatRing& ring : sRings)
+			ring = FrameStatRing{};
+
+		sPrevFrameTime = 0;
+		sFrameNum = 0u;
+		sStutterNum = 0u;
+	}
+}
@@ -4,8 +4,6 @@
 
 #include <Core/Time/Time.hpp>
 
-#include <Core/Algorithms/Move.hpp>
-
 namespace Sa
 {
 	Log::Log(
@@ -22,7 +20,26 @@ namespace Sa
 		str{ _str },
 		level{ _level },
 		channel{ _channel },
-		date{ Time::Date() }
+		timestamp{ Time::Timestamp() }
+	{
+	}
+
+	Log::Log(
+		const wchar* _file,
+		const char8* _function,
+		uint32 _line,
+		const wchar* _str,
+		LogLvlFlag _level,
+		const LogChannel& _channel,
+		uint64 _timestamp
+	) noexcept :
+		file{ _file },
+		function{ _function },
+		line{ _line },
+		str{ _str },
+		level{ _level },
+		channel{ _channel },
+		timestamp{ _timestamp }
 	{
 	}
 
@@ -33,7 +50,7 @@ namespace Sa
 		str{ _other.str },
 		level{ _other.level },
 		channel{ _other.channel },
-		date{ Move(_other.date) }
+		timestamp{ _other.timestamp }
 	{
 	}
 
@@ -44,14 +61,29 @@ namespace Sa
 		str{ _other.str },
 		level{ _other.level },
 		channel{ _other.channel },
-		date{ _other.date }
+		timestamp{ _other.timestamp }
+	{
+	}
+
+	void Log::OutputDate(std::wostream& _stream) const noexcept
 	{
+		// Logs come in bursts: convert each second once.
+		thread_local uint64 cachedTimestamp = ~uint64(0);
+		thread_local DateTime cachedDate;
+
+		if (timestamp != cachedTimestamp)
+		{
+			cachedTimestamp = timestamp;
+			cachedDate = Time::Date(timestamp);
+		}
+
+		_stream << '[' << cachedDate.hour << ':' << cachedDate.minute << ':' << cachedDate.second << ']';
 	}
 
 	void Log::Output(std::wostream& _stream) const noexcept
 	{
 		// Output date.
-		_stream << '[' << date.hour << ':' << date.minute << ':' << date.second << ']';
+		OutputDate(_stream);
 
 		// Output message.
 		_stream << '\t' << str << '\n';
@@ -63,6 +95,11 @@ namespace Sa
 		_stream << '\t' << file << ':' << line << " - " << function << '\n';
 	}
 
+	bool Log::HasDetails() const noexcept
+	{
+		return false;
+	}
+
 	std::wostream& Log::operator>>(std::wostream& _stream) const noexcept
 	{
 		Output(_stream);
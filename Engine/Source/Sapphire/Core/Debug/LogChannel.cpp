@@ -6,7 +6,7 @@
 
 namespace Sa
 {
-	LogChannel::LogChannel(const wchar* _name) noexcept : name{ _name }
+	LogChannel::LogChannel(const wchar* _name) noexcept : name{ _name }, id{ _name }
 	{
 	}
 
@@ -18,7 +18,7 @@ namespace Sa
 
 	RAII<LogChannel>::~RAII() noexcept
 	{
-		Debug::UnRegisterChannel(mHandle.name);
+		// Channels are never freed: other threads may still log on it during static destruction.
 	}
 
 #endif
@@ -0,0 +1,593 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Debug/Logger.hpp>
+
+#include <new>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <sstream>
+#include <iostream>
+
+#include <Core/Support/Platforms.hpp>
+
+#if SA_WIN
+
+	#include <io.h>
+
+#else
+
+	#include <unistd.h>
+
+#endif
+
+#include <Core/Debug/CrashHandler.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/CacheLine.hpp>
+#include <Core/Thread/SpinLock.hpp>
+#include <Core/Thread/FutexMutex.hpp>
+#include <Core/Thread/Thread.hpp>
+
+#include <Core/Time/Time.hpp>
+
+namespace Sa
+{
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// Kind of ring record.
+		enum class LogRecordKind : uint8
+		{
+			/// Log fields: formatted by Log::Output on the sink.
+			Log,
+
+			/// Already formatted text (ex: exceptions with details).
+			Formatted,
+
+			/// Unused end of ring: next record starts at the beginning.
+			Padding,
+		};
+
+		/// Compact log record header, followed by the null-terminated message (wchar).
+		struct LogRecord
+		{
+			/// Total record size in bytes (header + text), multiple of 8.
+			uint32 size = 0u;
+
+			/// Record kind.
+			LogRecordKind kind = LogRecordKind::Log;
+
+			/// Level of Log.
+			LogLvlFlag level = LogLvlFlag::Normal;
+
+			/// Log's line number.
+			uint32 line = 0u;
+
+			/// Log's file name (static storage).
+			const wchar* file = nullptr;
+
+			/// Log's function name (static storage).
+			const char8* function = nullptr;
+
+			/// Log's channel name (static storage: channel object may be unregistered before output).
+			const wchar* channel = nullptr;
+
+			/// Creation time of Log.
+			uint64 timestamp = 0u;
+
+
+			const wchar* GetText() const noexcept
+			{
+				return reinterpret_cast<const wchar*>(this + 1);
+			}
+		};
+
+		static_assert(sizeof(LogRecord) % 8u == 0u, "LogRecord size must keep 8 bytes alignment!");
+
+
+		/// Per-thread SPSC byte ring of variable size records.
+		struct LogRing
+		{
+			/// Ring size in bytes.
+			static constexpr uint64 Capacity = 64u * 1024u;
+
+			/// Mask to wrap positions in data.
+			static constexpr uint64 Mask = Capacity - 1u;
+
+			/// Max record size: longer messages are truncated.
+			static constexpr uint64 MaxRecordSize = Capacity / 4u;
+
+
+			/// Read position: written by the consumer.
+			alignas(CacheLineSize) Atomic<uint64> head = 0u;
+
+			/// Write position: written by the producer.
+			alignas(CacheLineSize) Atomic<uint64> tail = 0u;
+
+			/// Producer's cached value of head.
+			uint64 cachedHead = 0u;
+
+			/// Whether the producer thread exited: free once drained.
+			Atomic<uint32> bOrphan = 0u;
+
+			/// Next registered ring.
+			LogRing* next = nullptr;
+
+			/// Records.
+			alignas(CacheLineSize) uint8 data[Capacity];
+
+
+			/**
+			*	\brief Try to write a record.
+			*
+			*	\return false if the ring is full.
+			*/
+			bool TryWrite(const Log& _log, LogRecordKind _kind, const wchar* _text, uint64 _textLen) noexcept
+			{
+				const uint64 maxTextLen = (MaxRecordSize - sizeof(LogRecord)) / sizeof(wchar) - 1u;
+
+				if (_textLen > maxTextLen)
+					_textLen = maxTextLen;
+
+				const uint64 size = (sizeof(LogRecord) + (_textLen + 1u) * sizeof(wchar) + 7u) & ~uint64(7u);
+
+				const uint64 pos = tail.Get(MemoryOrder::Relaxed);
+				const uint64 offset = pos & Mask;
+
+				// Records are contiguous: skip the end of ring if too small.
+				const uint64 padding = offset + size > Capacity ? Capacity - offset : 0u;
+
+				if (pos + padding + size - cachedHead > Capacity)
+				{
+					cachedHead = head.Get(MemoryOrder::Acquire);
+
+					if (pos + padding + size - cachedHead > Capacity)
+						return false;
+				}
+
+				if (padding)
+				{
+					// Only size and kind fit in the smallest padding (8 bytes).
+					LogRecord* const pad = reinterpret_cast<LogRecord*>(data + offset);
+					pad->size = static_cast<uint32>(padding);
+					pad->kind = LogRecordKind::Padding;
+				}
+
+				LogRecord* const record = new(data + ((pos + padding) & Mask)) LogRecord();
+				record->size = static_cast<uint32>(size);
+				record->kind = _kind;
+				record->level = _log.level;
+				record->line = _log.line;
+				record->file = _log.file;
+				record->function = _log.function;
+				record->channel = _log.channel.name;
+				record->timestamp = _log.timestamp;
+
+				wchar* const text = reinterpret_cast<wchar*>(record + 1);
+				std::memcpy(text, _text, _textLen * sizeof(wchar));
+				text[_textLen] = L'\0';
+
+				tail.Set(pos + padding + size, MemoryOrder::Release);
+
+				return true;
+			}
+
+			/**
+			*	\brief Format every record into _stream.
+			*
+			*	\return Whether any record was read.
+			*/
+			bool Read(std::wostream& _stream) noexcept
+			{
+				uint64 pos = head.Get(MemoryOrder::Relaxed);
+				const uint64 end = tail.Get(MemoryOrder::Acquire);
+
+				if (pos == end)
+					return false;
+
+				while (pos != end)
+				{
+					const LogRecord* const record = reinterpret_cast<const LogRecord*>(data + (pos & Mask));
+
+					if (record->kind == LogRecordKind::Log)
+					{
+						const LogChannel channel(record->channel);
+
+						Log(record->file, record->function, record->line, record->GetText(),
+							record->level, channel, record->timestamp).Output(_stream);
+
+						_stream << L'\n';
+					}
+					else if (record->kind == LogRecordKind::Formatted)
+						_stream << record->GetText() << L'\n';
+
+					pos += record->size;
+				}
+
+				head.Set(pos, MemoryOrder::Release);
+
+				return true;
+			}
+		};
+
+
+		/// Register the calling thread's ring, orphan it on thread exit.
+		struct LogRingHandle
+		{
+			LogRing* ring = nullptr;
+
+			~LogRingHandle()
+			{
+				if (ring)
+					ring->bOrphan.Set(1u, MemoryOrder::Release);
+
+				ring = nullptr;
+			}
+		};
+	}
+
+	/// \endcond Internal
+
+	using namespace Internal;
+
+
+	/// Registered rings (push front by producers under sRingsLock, removal by drainer).
+	static LogRing* sRings = nullptr;
+
+	/// Guard sRings list.
+	static SpinLock sRingsLock;
+
+	/// Single consumer of the rings (sink thread or flushing thread).
+	static FutexMutex sDrainMutex;
+
+	/// Calling thread's ring.
+	static thread_local LogRingHandle sThreadRing;
+
+
+	/// Sink state: 0 not started, 1 running, 2 shut down.
+	static Atomic<uint32> sSinkState = 0u;
+
+	/// Incremented to wake the sink thread.
+	static Atomic<uint32> sSinkSignal = 0u;
+
+	/// Whether the sink thread is waiting on sSinkSignal.
+	static Atomic<uint32> sSinkSleeping = 0u;
+
+	/// Sink thread (never destroyed: joined in Shutdown()).
+	static Thread* sSinkThread = nullptr;
+
+	/// Batching delay of the sink after output (in milliseconds).
+	static constexpr float sSinkBatchDelay = 2.0f;
+
+
+	/// Format batch: reused (never destroyed, may be used during static destruction).
+	static std::wostringstream& GetBatchStream()
+	{
+		static std::wostringstream* const stream = new std::wostringstream();
+
+		return *stream;
+	}
+
+	/// Drain every ring into one write (sDrainMutex must be locked).
+	static bool DrainRings() noexcept
+	{
+		std::wostringstream& batch = GetBatchStream();
+		batch.str(std::wstring());
+
+		LogRing* ring = nullptr;
+
+		{
+			RAII<SpinLock> lock(sRingsLock);
+			ring = sRings;
+		}
+
+		bool bAny = false;
+
+		while (ring)
+		{
+			LogRing* const next = ring->next;
+
+			bAny |= ring->Read(batch);
+
+			// Producer exited: no more write once bOrphan is seen.
+			if (ring->bOrphan.Get(MemoryOrder::Acquire) && !ring->Read(batch))
+			{
+				RAII<SpinLock> lock(sRingsLock);
+
+				LogRing** link = &sRings;
+
+				while (*link != ring)
+					link = &(*link)->next;
+
+				*link = next;
+
+				delete ring;
+			}
+
+			ring = next;
+		}
+
+		if (bAny)
+		{
+			std::wcout << batch.str();
+			std::wcout.flush();
+		}
+
+		return bAny;
+	}
+
+	/// Whether any ring has records.
+	static bool HasPendingRecords() noexcept
+	{
+		RAII<SpinLock> lock(sRingsLock);
+
+		for (LogRing* ring = sRings; ring; ring = ring->next)
+		{
+			if (ring->head.Get(MemoryOrder::Relaxed) != ring->tail.Get(MemoryOrder::Acquire))
+				return true;
+		}
+
+		return false;
+	}
+
+	/// Wake the sink if waiting.
+	static void WakeSink() noexcept
+	{
+		// Pair with the sink's fence: either the sink sees the record, or we see it sleeping.
+		AtomicThreadFence(MemoryOrder::SeqCst);
+
+		if (sSinkSleeping.Get(MemoryOrder::Relaxed) && sSinkSleeping.Exchange(0u))
+		{
+			sSinkSignal.FetchAdd(1u);
+			sSinkSignal.NotifyOne();
+		}
+	}
+
+	static void SinkMain()
+	{
+		Thread::SetCurrentName("Sa Logger");
+		Thread::SetCurrentPriority(ThreadPriority::Low);
+
+		while (sSinkState.Get(MemoryOrder::Acquire) == 1u)
+		{
+			bool bAny = false;
+
+			{
+				RAII<FutexMutex> lock(sDrainMutex);
+				bAny = DrainRings();
+			}
+
+			if (bAny)
+			{
+				// Let producers fill a batch.
+				Time::Sleep(sSinkBatchDelay);
+				continue;
+			}
+
+			const uint32 signal = sSinkSignal.Get();
+
+			sSinkSleeping.Set(1u);
+			AtomicThreadFence(MemoryOrder::SeqCst);
+
+			if (!HasPendingRecords() && sSinkState.Get() == 1u)
+				sSinkSignal.Wait(signal);
+
+			sSinkSleeping.Set(0u);
+		}
+	}
+
+	static void StartSink() noexcept
+	{
+		uint32 expected = 0u;
+
+		if (!sSinkState.CompareExchangeStrong(expected, 1u))
+			return;
+
+		sSinkThread = new Thread(&SinkMain);
+
+		Logger::InstallCrashHandlers();
+
+		// Before static destruction of objects created after the first log.
+		std::atexit(&Logger::Shutdown);
+	}
+
+
+	void Logger::Push(const Log& _log) noexcept
+	{
+		if (sSinkState.Get(MemoryOrder::Relaxed) == 0u)
+			StartSink();
+		else if (sSinkState.Get(MemoryOrder::Acquire) == 2u)
+		{
+			// Shut down (exit): synchronous output.
+			WriteImmediate(_log);
+			return;
+		}
+
+		LogRing*& ring = sThreadRing.ring;
+
+		if (!ring)
+		{
+			ring = new LogRing();
+
+			RAII<SpinLock> lock(sRingsLock);
+
+			ring->next = sRings;
+			sRings = ring;
+		}
+
+		LogRecordKind kind = LogRecordKind::Log;
+		const wchar* text = _log.str ? _log.str : L"";
+		std::wstring formatted;
+
+		// Derived logs (exceptions) output more fields: format on the producer.
+		if (_log.HasDetails())
+		{
+			std::wostringstream stream;
+			_log.Output(stream);
+
+			formatted = stream.str();
+
+			kind = LogRecordKind::Formatted;
+			text = formatted.c_str();
+		}
+
+		const uint64 textLen = kind == LogRecordKind::Formatted ? formatted.size() : std::wcslen(text);
+
+		while (!ring->TryWrite(_log, kind, text, textLen))
+		{
+			// Shutdown() raced with this push: no sink to make room anymore.
+			if (sSinkState.Get(MemoryOrder::Acquire) != 1u)
+				Flush();
+			else
+			{
+				WakeSink();
+				Thread::Yield();
+			}
+		}
+
+		WakeSink();
+
+		// Written after the final flush of Shutdown() (ordered by WakeSink() fence): output it now.
+		if (sSinkState.Get() == 2u)
+			Flush();
+	}
+
+	void Logger::Flush() noexcept
+	{
+		RAII<FutexMutex> lock(sDrainMutex);
+
+		DrainRings();
+	}
+
+	void Logger::WriteImmediate(const Log& _log) noexcept
+	{
+		RAII<FutexMutex> lock(sDrainMutex);
+
+		DrainRings();
+
+		std::wcout << _log << std::endl;
+	}
+
+
+	/// Preallocated crash output buffer: no allocation in signal handler.
+	static char sCrashBuffer[4096];
+
+	/// Bounded append into sCrashBuffer, written to stderr when full (async-signal-safe).
+	struct CrashWriter
+	{
+		uint64 size = 0u;
+
+		void Write() noexcept
+		{
+	#if SA_WIN
+			_write(2, sCrashBuffer, static_cast<unsigned int>(size));
+	#else
+			(void)!write(2, sCrashBuffer, size);
+	#endif
+			size = 0u;
+		}
+
+		void Append(char _c) noexcept
+		{
+			if (size == sizeof(sCrashBuffer))
+				Write();
+
+			sCrashBuffer[size++] = _c;
+		}
+
+		template <typename CharT>
+		void Append(const CharT* _str) noexcept
+		{
+			if (!_str)
+				return;
+
+			// Non-ASCII characters are replaced: no locale conversion.
+			for (; *_str; ++_str)
+				Append(static_cast<uint32>(*_str) < 128u ? static_cast<char>(*_str) : '?');
+		}
+	};
+
+	void Logger::CrashFlush() noexcept
+	{
+		// Best effort: the crash may come from the drainer or a ring registration.
+		if (!sDrainMutex.TryLock())
+			return;
+
+		if (!sRingsLock.TryLock())
+		{
+			sDrainMutex.Unlock();
+			return;
+		}
+
+		CrashWriter writer;
+
+		for (LogRing* ring = sRings; ring; ring = ring->next)
+		{
+			uint64 pos = ring->head.Get(MemoryOrder::Relaxed);
+			const uint64 end = ring->tail.Get(MemoryOrder::Acquire);
+
+			while (pos != end)
+			{
+				const LogRecord* const record = reinterpret_cast<const LogRecord*>(ring->data + (pos & LogRing::Mask));
+
+				if (record->kind == LogRecordKind::Log)
+				{
+					writer.Append('{');
+					writer.Append(GetLogLevelName(record->level));
+					writer.Append(" - ");
+					writer.Append(record->channel);
+					writer.Append("}\t");
+				}
+
+				if (record->kind != LogRecordKind::Padding)
+				{
+					writer.Append(record->GetText());
+					writer.Append('\n');
+				}
+
+				pos += record->size;
+			}
+
+			ring->head.Set(pos, MemoryOrder::Release);
+		}
+
+		if (writer.size)
+			writer.Write();
+
+		sRingsLock.Unlock();
+		sDrainMutex.Unlock();
+	}
+
+
+	static void CrashFlushHook(const char* _reason)
+	{
+		(void)_reason;
+
+		Logger::CrashFlush();
+	}
+
+	void Logger::InstallCrashHandlers() noexcept
+	{
+		// After the flight recorder dump: the flush may give up on busy rings.
+		CrashHandler::SetHook(CrashStage::Flush, &CrashFlushHook);
+	}
+
+	void Logger::Shutdown() noexcept
+	{
+		uint32 expected = 1u;
+
+		if (!sSinkState.CompareExchangeStrong(expected, 2u))
+			return;
+
+		sSinkSignal.FetchAdd(1u);
+		sSinkSignal.NotifyAll();
+
+		sSinkThread->Join();
+		delete sSinkThread;
+		sSinkThread = nullptr;
+
+		Flush();
+	}
+}
@@ -0,0 +1,578 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Debug/Profiler.hpp>
+
+#include <fstream>
+#include <algorithm>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/CacheLine.hpp>
+#include <Core/Thread/SpinLock.hpp>
+#include <Core/Thread/FutexMutex.hpp>
+
+#include <Core/Time/Time.hpp>
+#include <Core/Time/CpuClock.hpp>
+
+namespace Sa
+{
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// Zone stored in a thread buffer.
+		struct ProfileRecord
+		{
+			const char* name;
+			uint64 begin;
+			uint64 end;
+			uint32 depth;
+		};
+
+		/// Per-thread SPSC zone buffer.
+		struct ProfileRing
+		{
+			/// Zone capacity.
+			static constexpr uint64 Capacity = 8192u;
+
+			/// Mask to wrap positions in records.
+			static constexpr uint64 Mask = Capacity - 1u;
+
+
+			/// Read position: written by the collector.
+			alignas(CacheLineSize) Atomic<uint64> head = 0u;
+
+			/// Write position: written by the producer.
+			alignas(CacheLineSize) Atomic<uint64> tail = 0u;
+
+			/// Producer's cached value of head.
+			uint64 cachedHead = 0u;
+
+			/// Thread (or track) index.
+			uint32 thread = 0u;
+
+			/// Thread (or track) name (static storage).
+			Atomic<const char*> name = nullptr;
+
+			/// Whether the producer thread exited: free once collected.
+			Atomic<uint32> bOrphan = 0u;
+
+			/// Next registered ring.
+			ProfileRing* next = nullptr;
+
+			/// Records.
+			ProfileRecord records[Capacity];
+
+
+			bool TryPush(const ProfileRecord& _record) noexcept
+			{
+				const uint64 pos = tail.Get(MemoryOrder::Relaxed);
+
+				if (pos - cachedHead >= Capacity)
+				{
+					cachedHead = head.Get(MemoryOrder::Acquire);
+
+					if (pos - cachedHead >= Capacity)
+						return false;
+				}
+
+				records[pos & Mask] = _record;
+
+				tail.Set(pos + 1u, MemoryOrder::Release);
+
+				return true;
+			}
+
+			void Collect(std::vector<ProfileZone>& _zones)
+			{
+				uint64 pos = head.Get(MemoryOrder::Relaxed);
+				const uint64 end = tail.Get(MemoryOrder::Acquire);
+
+				for (; pos != end; ++pos)
+				{
+					const ProfileRecord& record = records[pos & Mask];
+					_zones.push_back(ProfileZone{ record.name, record.begin, record.end, thread, record.depth });
+				}
+
+				head.Set(pos, MemoryOrder::Release);
+			}
+		};
+
+
+		/// Register the calling thread's ring, orphan it on thread exit.
+		struct ProfileRingHandle
+		{
+			ProfileRing* ring = nullptr;
+
+			~ProfileRingHandle()
+			{
+				if (ring)
+					ring->bOrphan.Set(1u, MemoryOrder::Release);
+
+				ring = nullptr;
+			}
+		};
+
+		/// Thread entry of a capture.
+		struct ProfileThreadInfo
+		{
+			uint32 thread = 0u;
+			const char* name = nullptr;
+		};
+	}
+
+	/// \endcond Internal
+
+	using namespace Internal;
+
+
+	/// Registered rings (push front by producers under sRingsLock, removal by collector).
+	static ProfileRing* sRings = nullptr;
+
+	/// Guard sRings list.
+	static SpinLock sRingsLock;
+
+	/// Next thread index.
+	static uint32 sThreadNum = 0u;
+
+	/// Calling thread's ring.
+	static thread_local ProfileRingHandle sThreadRing;
+
+	/// Track rings (guarded by sRingsLock on creation / destruction).
+	static ProfileRing* sTracks[Profiler::MaxTrackNum] = {};
+
+	/// Calling thread's zone depth.
+	static thread_local uint32 sThreadDepth = 0u;
+
+	/// Zones dropped on full rings.
+	static Atomic<uint64> sDroppedZoneNum = 0u;
+
+
+	/// Guard collection, frames and captures.
+	static FutexMutex sCollectMutex;
+
+	/// Collected zones of the current frame (reused).
+	static std::vector<ProfileZone> sFrameZones;
+
+	/// Last ended frame.
+	static ProfileFrame sLastFrame;
+
+	/// Current frame index.
+	static uint64 sFrameIndex = 0u;
+
+	/// Current frame begin time.
+	static uint64 sFrameBegin = 0u;
+
+
+	/// Whether a capture is running.
+	static bool sbCapturing = false;
+
+	/// Capture start time.
+	static uint64 sCaptureBegin = 0u;
+
+	/// Captured zones.
+	static std::vector<ProfileZone> sCaptureZones;
+
+	/// Captured frame begin times.
+	static std::vector<uint64> sCaptureFrames;
+
+	/// Captured thread names.
+	static std::vector<ProfileThreadInfo> sCaptureThreads;
+
+
+	/// Allocate and register a new ring.
+	static ProfileRing* CreateRing()
+	{
+		ProfileRing* const ring = new ProfileRing();
+
+		RAII<SpinLock> lock(sRingsLock);
+
+		ring->thread = sThreadNum++;
+		ring->next = sRings;
+		sRings = ring;
+
+		return ring;
+	}
+
+	static ProfileRing& GetThreadRing() noexcept
+	{
+		ProfileRing*& ring = sThreadRing.ring;
+
+		if (!ring)
+			ring = CreateRing();
+
+		return *ring;
+	}
+
+	/// Collect every ring into _zones (sCollectMutex must be locked).
+	static void CollectRings(std::vector<ProfileZone>& _zones)
+	{
+		ProfileRing* ring = nullptr;
+
+		{
+			RAII<SpinLock> lock(sRingsLock);
+			ring = sRings;
+		}
+
+		while (ring)
+		{
+			ProfileRing* const next = ring->next;
+
+			ring->Collect(_zones);
+
+			if (sbCapturing)
+			{
+				const char* const name = ring->name.Get(MemoryOrder::Acquire);
+
+				auto it = std::find_if(sCaptureThreads.begin(), sCaptureThreads.end(),
+					[ring](const ProfileThreadInfo& _info) { return _info.thread == ring->thread; });
+
+				if (it == sCaptureThreads.end())
+					sCaptureThreads.push_back(ProfileThreadInfo{ ring->thread, name });
+				else if (name)
+					it->name = name;
+			}
+
+			// Producer exited: no more push once bOrphan is seen.
+			if (ring->bOrphan.Get(MemoryOrder::Acquire))
+			{
+				ring->Collect(_zones);
+
+				RAII<SpinLock> lock(sRingsLock);
+
+				ProfileRing** link = &sRings;
+
+				while (*link != ring)
+					link = &(*link)->next;
+
+				*link = next;
+
+				delete ring;
+			}
+
+			ring = next;
+		}
+	}
+
+	/// Build the merged zone hierarchy of a frame.
+	static void AggregateFrame(std::vector<ProfileZone>& _zones, ProfileFrame& _frame)
+	{
+		_frame.nodes.clear();
+
+		// Parents begin before (or with) their children.
+		std::sort(_zones.begin(), _zones.end(), [](const ProfileZone& _lhs, const ProfileZone& _rhs)
+		{
+			if (_lhs.thread != _rhs.thread)
+				return _lhs.thread < _rhs.thread;
+
+			if (_lhs.begin != _rhs.begin)
+				return _lhs.begin < _rhs.begin;
+
+			return _lhs.depth < _rhs.depth;
+		});
+
+		// Open zones: node index and end time.
+		std::vector<std::pair<uint32, uint64>> stack;
+		uint32 currThread = Profiler::NoParent;
+		uint32 threadFirstNode = 0u;
+
+		for (const ProfileZone& zone : _zones)
+		{
+			if (zone.thread != currThread)
+			{
+				currThread = zone.thread;
+				threadFirstNode = static_cast<uint32>(_frame.nodes.size());
+				stack.clear();
+			}
+
+			// Close ended zones (parent began in a previous frame: zone becomes a root).
+			while (!stack.empty() && (stack.size() > zone.depth || zone.begin >= stack.back().second))
+				stack.pop_back();
+
+			const uint32 parent = stack.empty() ? Profiler::NoParent : stack.back().first;
+			const uint64 duration = zone.end - zone.begin;
+
+			uint32 nodeIndex = Profiler::NoParent;
+
+			for (uint32 i = threadFirstNode; i < _frame.nodes.size(); ++i)
+			{
+				if (_frame.nodes[i].parent == parent && _frame.nodes[i].name == zone.name)
+				{
+					nodeIndex = i;
+					break;
+				}
+			}
+
+			if (nodeIndex == Profiler::NoParent)
+			{
+				nodeIndex = static_cast<uint32>(_frame.nodes.size());
+
+				ProfileNode& node = _frame.nodes.emplace_back();
+				node.name = zone.name;
+				node.parent = parent;
+				node.thread = zone.thread;
+				node.depth = static_cast<uint32>(stack.size());
+			}
+
+			ProfileNode& node = _frame.nodes[nodeIndex];
+			++node.callCount;
+			node.totalTime += duration;
+
+			stack.emplace_back(nodeIndex, zone.end);
+		}
+
+		for (ProfileNode& node : _frame.nodes)
+			node.selfTime = node.totalTime;
+
+		for (const ProfileNode& node : _frame.nodes)
+		{
+			if (node.parent != Profiler::NoParent)
+			{
+				ProfileNode& parent = _frame.nodes[node.parent];
+				parent.selfTime = parent.selfTime > node.totalTime ? parent.selfTime - node.totalTime : 0u;
+			}
+		}
+	}
+
+
+	uint64 Profiler::GetTime() noexcept
+	{
+#if SA_PROFILING_CPU_CLOCK
+		return static_cast<uint64>(CpuClock::NanoSeconds());
+#else
+		return static_cast<uint64>(Time::NanoSeconds());
+#endif
+	}
+
+	void Profiler::PushZone(const char* _name, uint64 _begin, uint64 _end, uint32 _depth) noexcept
+	{
+		// Never block the profiled thread.
+		if (!GetThreadRing().TryPush(ProfileRecord{ _name, _begin, _end, _depth }))
+			sDroppedZoneNum.FetchAdd(1u, MemoryOrder::Relaxed);
+	}
+
+	void Profiler::SetCurrentThreadName(const char* _name) noexcept
+	{
+		GetThreadRing().name.Set(_name, MemoryOrder::Release);
+	}
+
+	const char* Profiler::GetThreadName(uint32 _thread) noexcept
+	{
+		RAII<SpinLock> lock(sRingsLock);
+
+		for (ProfileRing* ring = sRings; ring; ring = ring->next)
+		{
+			if (ring->thread == _thread)
+				return ring->name.Get(MemoryOrder::Acquire);
+		}
+
+		return nullptr;
+	}
+
+	uint32 Profiler::CreateTrack(const char* _name)
+	{
+		ProfileRing* const ring = CreateRing();
+		ring->name.Set(_name, MemoryOrder::Release);
+
+		RAII<SpinLock> lock(sRingsLock);
+
+		for (uint32 i = 0u; i < MaxTrackNum; ++i)
+		{
+			if (!sTracks[i])
+			{
+				sTracks[i] = ring;
+				return i;
+			}
+		}
+
+		// No free slot: freed on next collection.
+		ring->bOrphan.Set(1u, MemoryOrder::Release);
+
+		return NoTrack;
+	}
+
+	void Profiler::DestroyTrack(uint32 _track) noexcept
+	{
+		if (_track >= MaxTrackNum)
+			return;
+
+		RAII<SpinLock> lock(sRingsLock);
+
+		if (sTracks[_track])
+		{
+			sTracks[_track]->bOrphan.Set(1u, MemoryOrder::Release);
+			sTracks[_track] = nullptr;
+		}
+	}
+
+	void Profiler::PushTrackZone(uint32 _track, const char* _name, uint64 _begin, uint64 _end, uint32 _depth) noexcept
+	{
+		// Single producer: the track can't be destroyed concurrently.
+		ProfileRing* const ring = _track < MaxTrackNum ? sTracks[_track] : nullptr;
+
+		if (!ring || !ring->TryPush(ProfileRecord{ _name, _begin, _end, _depth }))
+			sDroppedZoneNum.FetchAdd(1u, MemoryOrder::Relaxed);
+	}
+
+	uint64 Profiler::GetDroppedZoneNum() noexcept
+	{
+		return sDroppedZoneNum.Get(MemoryOrder::Relaxed);
+	}
+
+
+	void Profiler::NewFrame()
+	{
+		RAII<FutexMutex> lock(sCollectMutex);
+
+		const uint64 now = GetTime();
+
+		sFrameZones.clear();
+		CollectRings(sFrameZones);
+
+		if (sbCapturing)
+		{
+			sCaptureZones.insert(sCaptureZones.end(), sFrameZones.begin(), sFrameZones.end());
+			sCaptureFrames.push_back(now);
+		}
+
+		sLastFrame.index = sFrameIndex++;
+		sLastFrame.begin = sFrameBegin ? sFrameBegin : now;
+		sLastFrame.end = now;
+
+		AggregateFrame(sFrameZones, sLastFrame);
+
+		sFrameBegin = now;
+	}
+
+	const ProfileFrame& Profiler::GetLastFrame() noexcept
+	{
+		return sLastFrame;
+	}
+
+
+	void Profiler::StartCapture()
+	{
+		RAII<FutexMutex> lock(sCollectMutex);
+
+		// Drop zones ended before the capture.
+		sFrameZones.clear();
+		CollectRings(sFrameZones);
+		sFrameZones.clear();
+
+		sCaptureZones.clear();
+		sCaptureFrames.clear();
+		sCaptureThreads.clear();
+
+		sCaptureBegin = GetTime();
+		sbCapturing = true;
+	}
+
+	/// Write a JSON string (names are static identifiers: only escape quotes and backslashes).
+	static void WriteJSONString(std::ofstream& _stream, const char* _str)
+	{
+		_stream << '"';
+
+		for (const char* c = _str ? _str : "Unknown"; *c; ++c)
+		{
+			if (*c == '"' || *c == '\\')
+				_stream << '\\';
+
+			_stream << *c;
+		}
+
+		_stream << '"';
+	}
+
+	/// Write a time relative to the capture (microseconds, nanosecond precision).
+	static void WriteJSONTime(std::ofstream& _stream, uint64 _time)
+	{
+		const uint64 ns = _time > sCaptureBegin ? _time - sCaptureBegin : 0u;
+
+		_stream << ns / 1000u << '.';
+
+		const uint64 frac = ns % 1000u;
+
+		_stream << static_cast<char>('0' + frac / 100u) << static_cast<char>('0' + frac / 10u % 10u) << static_cast<char>('0' + frac % 10u);
+	}
+
+	bool Profiler::StopCapture(const std::string& _path)
+	{
+		RAII<FutexMutex> lock(sCollectMutex);
+
+		if (!sbCapturing)
+			return false;
+
+		// Zones ended since the last frame.
+		CollectRings(sCaptureZones);
+
+		sbCapturing = false;
+
+		std::ofstream stream(_path, std::ios::out | std::ios::trunc);
+
+		if (!stream.is_open())
+			return false;
+
+		stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+		bool bFirst = true;
+
+		for (const ProfileThreadInfo& info : sCaptureThreads)
+		{
+			stream << (bFirst ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << info.thread << ",\"args\":{\"name\":";
+
+			if (info.name)
+				WriteJSONString(stream, info.name);
+			else
+				stream << "\"Thread " << info.thread << '"';
+
+			stream << "}}";
+			bFirst = false;
+		}
+
+		for (uint64 i = 0u; i < sCaptureFrames.size(); ++i)
+		{
+			stream << (bFirst ? "" : ",\n") << "{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":";
+			WriteJSONTime(stream, sCaptureFrames[i]);
+			stream << '}';
+			bFirst = false;
+		}
+
+		for (const ProfileZone& zone : sCaptureZones)
+		{
+			// Zone begun before the capture.
+			if (zone.begin < sCaptureBegin)
+				continue;
+
+			stream << (bFirst ? "" : ",\n") << "{\"name\":";
+			WriteJSONString(stream, zone.name);
+			stream << ",\"cat\":\"CPU\",\"ph\":\"X\",\"pid\":1,\"tid\":" << zone.thread << ",\"ts\":";
+			WriteJSONTime(stream, zone.begin);
+			stream << ",\"dur\":";
+			WriteJSONTime(stream, sCaptureBegin + (zone.end - zone.begin));
+			stream << '}';
+			bFirst = false;
+		}
+
+		stream << "\n]}\n";
+
+		sCaptureZones.clear();
+		sCaptureFrames.clear();
+		sCaptureThreads.clear();
+
+		return stream.good();
+	}
+
+
+	ProfileScope::ProfileScope(const char* _name) noexcept :
+		mName{ _name },
+		mBegin{ Profiler::GetTime() },
+		mDepth{ sThreadDepth++ }
+	{
+	}
+
+	ProfileScope::~ProfileScope() noexcept
+	{
+		--sThreadDepth;
+
+		Profiler::PushZone(mName, mBegin, Profiler::GetTime(), mDepth);
+	}
+}
@@ -0,0 +1,113 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Memory/FrameArena.hpp>
+
+#include <cstdlib>
+
+#include <Collections/Debug>
+
+namespace Sa
+{
+	FrameArena::FrameArena(uint64 _capacity, uint32 _bufferNum)
+	{
+		Create(_capacity, _bufferNum);
+	}
+
+	FrameArena::~FrameArena()
+	{
+		Destroy();
+	}
+
+
+	uint32 FrameArena::GetBufferNum() const noexcept
+	{
+		return mBufferNum;
+	}
+
+	uint64 FrameArena::GetUsedSize() const noexcept
+	{
+		const Buffer& buffer = mBuffers[mCurrent];
+		const uint64 offset = buffer.offset.Get(MemoryOrder::Relaxed);
+
+		return (offset < buffer.capacity ? offset : buffer.capacity) + buffer.overflow.GetSize();
+	}
+
+
+	void FrameArena::Create(uint64 _capacity, uint32 _bufferNum)
+	{
+		SA_ASSERT(mBufferNum == 0u, AlreadyCreated, Tools, L"Frame arena already created!");
+		SA_ASSERT(_bufferNum >= 1u && _bufferNum <= MaxBufferNum, OutOfRange, Tools, _bufferNum, 1u, MaxBufferNum);
+
+		for (uint32 i = 0u; i < _bufferNum; ++i)
+		{
+			Buffer& buffer = mBuffers[i];
+
+			buffer.data = static_cast<uint8*>(std::malloc(_capacity));
+
+			SA_ASSERT(buffer.data || !_capacity, Nullptr, Tools, L"Frame arena allocation failed!");
+
+			buffer.capacity = _capacity;
+			buffer.offset.Set(0u, MemoryOrder::Relaxed);
+		}
+
+		mBufferNum = _bufferNum;
+		mCurrent = 0u;
+	}
+
+	void FrameArena::Destroy()
+	{
+		for (uint32 i = 0u; i < mBufferNum; ++i)
+		{
+			Buffer& buffer = mBuffers[i];
+
+			buffer.overflow.Free();
+
+			std::free(buffer.data);
+
+			buffer.data = nullptr;
+			buffer.capacity = 0u;
+			buffer.offset.Set(0u, MemoryOrder::Relaxed);
+		}
+
+		mBufferNum = 0u;
+		mCurrent = 0u;
+	}
+
+
+	void* FrameArena::AllocateOverflow(uint64 _size, uint64 _alignment)
+	{
+		RAII<SpinLock> lock(mOverflowLock);
+
+		return mBuffers[mCurrent].overflow.Allocate(_size, _alignment);
+	}
+
+	void FrameArena::BeginFrame()
+	{
+		SA_ASSERT(mBufferNum, UnInit, Tools, L"Frame arena not created!");
+
+		mCurrent = (mCurrent + 1u) % mBufferNum;
+
+		Buffer& buffer = mBuffers[mCurrent];
+
+		const uint64 overflowSize = buffer.overflow.GetSize();
+
+		// Grow to the peak usage: next cycle fits in the block.
+		if (overflowSize)
+		{
+			const uint64 peakSize = buffer.capacity + overflowSize;
+			const uint64 capacity = AlignUp(peakSize + peakSize / 4u, 4096u);
+
+			buffer.overflow.Free();
+
+			std::free(buffer.data);
+
+			buffer.data = static_cast<uint8*>(std::malloc(capacity));
+
+			SA_ASSERT(buffer.data, Nullptr, Tools, L"Frame arena allocation failed!");
+
+			buffer.capacity = capacity;
+		}
+
+		buffer.offset.Set(0u, MemoryOrder::Relaxed);
+	}
+}
@@ -0,0 +1,123 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Memory/Heap.hpp>
+
+#include <new>
+
+#include <Core/Config.hpp>
+
+#include <Core/Memory/TLSFAllocator.hpp>
+
+#include <Core/Thread/FutexMutex.hpp>
+
+namespace Sa
+{
+	/// Serialize access to the global allocator (constant-initialized).
+	static FutexMutex sHeapMutex;
+
+	/**
+	*	\brief Get the global allocator.
+	*
+	*	Constructed on first use (may be before static initialization when replacing global new)
+	*	and never destroyed (may be used after static destruction).
+	*/
+	static TLSFAllocator& GetHeapAllocator() noexcept
+	{
+		alignas(TLSFAllocator) static uint8 storage[sizeof(TLSFAllocator)];
+		static TLSFAllocator* const allocator = new(storage) TLSFAllocator();
+
+		return *allocator;
+	}
+
+
+	void* Heap::Allocate(uint64 _size, uint64 _alignment, MemoryTag _tag)
+	{
+		TLSFAllocator& allocator = GetHeapAllocator();
+
+		RAII<FutexMutex> lock(sHeapMutex);
+
+		return allocator.Allocate(_size, _alignment, _tag);
+	}
+
+	void Heap::Free(void* _ptr) noexcept
+	{
+		if (!_ptr)
+			return;
+
+		TLSFAllocator& allocator = GetHeapAllocator();
+
+		RAII<FutexMutex> lock(sHeapMutex);
+
+		allocator.Free(_ptr);
+	}
+
+
+	uint64 Heap::GetReservedSize() noexcept
+	{
+		TLSFAllocator& allocator = GetHeapAllocator();
+
+		RAII<FutexMutex> lock(sHeapMutex);
+
+		return allocator.GetReservedSize();
+	}
+
+	uint64 Heap::GetUsedSize() noexcept
+	{
+		TLSFAllocator& allocator = GetHeapAllocator();
+
+		RAII<FutexMutex> lock(sHeapMutex);
+
+		return allocator.GetUsedSize();
+	}
+}
+
+
+#if SA_MEMORY_GLOBAL_NEW
+
+/// \cond Internal
+
+namespace
+{
+	void* HeapNew(std::size_t _size, std::size_t _alignment)
+	{
+		void* const ptr = Sa::Heap::Allocate(_size, _alignment);
+
+		if (!ptr)
+			throw std::bad_alloc();
+
+		return ptr;
+	}
+
+	void* HeapNewNoThrow(std::size_t _size, std::size_t _alignment) noexcept
+	{
+		return Sa::Heap::Allocate(_size, _alignment);
+	}
+}
+
+void* operator new(std::size_t _size) { return HeapNew(_size, 16u); }
+void* operator new[](std::size_t _size) { return HeapNew(_size, 16u); }
+void* operator new(std::size_t _size, const std::nothrow_t&) noexcept { return HeapNewNoThrow(_size, 16u); }
+void* operator new[](std::size_t _size, const std::nothrow_t&) noexcept { return HeapNewNoThrow(_size, 16u); }
+
+void* operator new(std::size_t _size, std::align_val_t _align) { return HeapNew(_size, static_cast<std::size_t>(_align)); }
+void* operator new[](std::size_t _size, std::align_val_t _align) { return HeapNew(_size, static_cast<std::size_t>(_align)); }
+void* operator new(std::size_t _size, std::align_val_t _align, const std::nothrow_t&) noexcept { return HeapNewNoThrow(_size, static_cast<std::size_t>(_align)); }
+void* operator new[](std::size_t _size, std::align_val_t _align, const std::nothrow_t&) noexcept { return HeapNewNoThrow(_size, static_cast<std::size_t>(_align)); }
+
+void operator delete(void* _ptr) noexcept { Sa::Heap::Free(_ptr); }
+void operator delete[](void* _ptr) noexcept { Sa::Heap::Free(_ptr); }
+void operator delete(void* _ptr, const std::nothrow_t&) noexcept { Sa::Heap::Free(_ptr); }
+void operator delete[](void* _ptr, const std::nothrow_t&) noexcept { Sa::Heap::Free(_ptr); }
+void operator delete(void* _ptr, std::size_t) noexcept { Sa::Heap::Free(_ptr); }
+void operator delete[](void* _ptr, std::size_t) noexcept { Sa::Heap::Free(_ptr); }
+
+void operator delete(void* _ptr, std::align_val_t) noexcept { Sa::Heap::Free(_ptr); }
+void operator delete[](void* _ptr, std::align_val_t) noexcept { Sa::Heap::Free(_ptr); }
+void operator delete(void* _ptr, std::align_val_t, const std::nothrow_t&) noexcept { Sa::Heap::Free(_ptr); }
+void operator delete[](void* _ptr, std::align_val_t, const std::nothrow_t&) noexcept { Sa::Heap::Free(_ptr); }
+void operator delete(void* _ptr, std::size_t, std::align_val_t) noexcept { Sa::Heap::Free(_ptr); }
+void operator delete[](void* _ptr, std::size_t, std::align_val_t) noexcept { Sa::Heap::Free(_ptr); }
+
+/// \endcond Internal
+
+#endif
@@ -0,0 +1,134 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Memory/LinearArena.hpp>
+
+#include <cstdlib>
+
+#include <Collections/Debug>
+
+namespace Sa
+{
+	namespace Internal
+	{
+		uint64 ArenaOverflowList::GetSize() const noexcept
+		{
+			return mSize;
+		}
+
+		void* ArenaOverflowList::Allocate(uint64 _size, uint64 _alignment)
+		{
+			SA_ASSERT(IsPowerOfTwo(_alignment), InvalidParam, Tools, L"Alignment must be a power of 2!");
+
+			Block* const block = static_cast<Block*>(std::malloc(sizeof(Block) + _alignment + _size));
+
+			SA_ASSERT(block, Nullptr, Tools, L"Arena overflow allocation failed!");
+
+			block->next = mHead;
+			mHead = block;
+
+			mSize += _size;
+
+			const uint64 data = reinterpret_cast<uint64>(block + 1);
+
+			return reinterpret_cast<void*>(AlignUp(data, _alignment));
+		}
+
+		void ArenaOverflowList::Free() noexcept
+		{
+			while (mHead)
+			{
+				Block* const next = mHead->next;
+
+				std::free(mHead);
+
+				mHead = next;
+			}
+
+			mSize = 0u;
+		}
+	}
+
+
+	LinearArena::LinearArena(uint64 _capacity)
+	{
+		Create(_capacity);
+	}
+
+	LinearArena::~LinearArena()
+	{
+		Destroy();
+	}
+
+
+	uint64 LinearArena::GetCapacity() const noexcept
+	{
+		return mCapacity;
+	}
+
+	uint64 LinearArena::GetUsedSize() const noexcept
+	{
+		return mOffset + mOverflow.GetSize();
+	}
+
+	uint64 LinearArena::GetPeakSize() const noexcept
+	{
+		const uint64 usedSize = GetUsedSize();
+
+		return usedSize > mPeakSize ? usedSize : mPeakSize;
+	}
+
+
+	void LinearArena::Create(uint64 _capacity)
+	{
+		SA_ASSERT(!mData, AlreadyCreated, Tools, L"Arena already created!");
+
+		mData = static_cast<uint8*>(std::malloc(_capacity));
+
+		SA_ASSERT(mData || !_capacity, Nullptr, Tools, L"Arena allocation failed!");
+
+		mCapacity = _capacity;
+		mOffset = 0u;
+		mPeakSize = 0u;
+	}
+
+	void LinearArena::Destroy()
+	{
+		mOverflow.Free();
+
+		std::free(mData);
+
+		mData = nullptr;
+		mCapacity = 0u;
+		mOffset = 0u;
+		mPeakSize = 0u;
+	}
+
+
+	void* LinearArena::AllocateOverflow(uint64 _size, uint64 _alignment)
+	{
+		return mOverflow.Allocate(_size, _alignment);
+	}
+
+	void LinearArena::Reset()
+	{
+		const uint64 peakSize = GetPeakSize();
+
+		mOverflow.Free();
+		mOffset = 0u;
+		mPeakSize = 0u;
+
+		// Grow to the peak usage (and some alignment padding): next cycle fits in the block.
+		if (peakSize > mCapacity)
+		{
+			const uint64 capacity = AlignUp(peakSize + peakSize / 4u, 4096u);
+
+			std::free(mData);
+
+			mData = static_cast<uint8*>(std::malloc(capacity));
+
+			SA_ASSERT(mData, Nullptr, Tools, L"Arena allocation failed!");
+
+			mCapacity = capacity;
+		}
+	}
+}
@@ -0,0 +1,137 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Memory/MemoryTag.hpp>
+
+#include <cwchar>
+#include <string>
+
+#include <Collections/Debug>
+
+#include <Core/Thread/SpinLock.hpp>
+
+namespace Sa
+{
+	/// Registered tag names.
+	static const wchar* sTagNames[MemoryTags::MaxNum] = { L"Default" };
+
+	/// Registered tag number (written under sTagLock).
+	static Atomic<uint32> sTagNum = 1u;
+
+	/// Serialize tag registration.
+	static SpinLock sTagLock;
+
+	/// Per-tag counters.
+	static MemoryTagStats sTagStats[MemoryTags::MaxNum];
+
+	/// Current tag of the calling thread.
+	static thread_local MemoryTag sCurrentTag = MemoryTags::Default;
+
+
+	uint32 MemoryTags::GetNum() noexcept
+	{
+		return sTagNum.Get(MemoryOrder::Acquire);
+	}
+
+	const wchar* MemoryTags::GetName(MemoryTag _tag) noexcept
+	{
+		return _tag < GetNum() ? sTagNames[_tag] : sTagNames[Default];
+	}
+
+	MemoryTagStats& MemoryTags::GetStats(MemoryTag _tag) noexcept
+	{
+		return sTagStats[_tag < MaxNum ? _tag : Default];
+	}
+
+
+	MemoryTag MemoryTags::Register(const wchar* _name) noexcept
+	{
+		RAII<SpinLock> lock(sTagLock);
+
+		const uint32 num = sTagNum.Get(MemoryOrder::Relaxed);
+
+		for (uint32 i = 0u; i < num; ++i)
+		{
+			if (std::wcscmp(sTagNames[i], _name) == 0)
+				return static_cast<MemoryTag>(i);
+		}
+
+		if (num >= MaxNum)
+			return Default;
+
+		sTagNames[num] = _name;
+		sTagNum.Set(num + 1u, MemoryOrder::Release);
+
+		return static_cast<MemoryTag>(num);
+	}
+
+
+	MemoryTag MemoryTags::GetCurrent() noexcept
+	{
+		return sCurrentTag;
+	}
+
+	void MemoryTags::SetCurrent(MemoryTag _tag) noexcept
+	{
+		sCurrentTag = _tag;
+	}
+
+
+	void MemoryTags::OnAllocate(MemoryTag _tag, uint64 _size) noexcept
+	{
+		MemoryTagStats& stats = GetStats(_tag);
+
+		const uint64 liveSize = stats.liveSize.FetchAdd(_size, MemoryOrder::Relaxed) + _size;
+
+		uint64 peakSize = stats.peakSize.Get(MemoryOrder::Relaxed);
+
+		while (liveSize > peakSize && !stats.peakSize.CompareExchangeWeak(peakSize, liveSize, MemoryOrder::Relaxed))
+			;
+
+		stats.liveNum.FetchAdd(1u, MemoryOrder::Relaxed);
+		stats.totalNum.FetchAdd(1u, MemoryOrder::Relaxed);
+	}
+
+	void MemoryTags::OnFree(MemoryTag _tag, uint64 _size) noexcept
+	{
+		MemoryTagStats& stats = GetStats(_tag);
+
+		stats.liveSize.FetchSub(_size, MemoryOrder::Relaxed);
+		stats.liveNum.FetchSub(1u, MemoryOrder::Relaxed);
+	}
+
+
+	void MemoryTags::Log()
+	{
+#if SA_LOGGING
+
+		const uint32 num = GetNum();
+
+		for (uint32 i = 0u; i < num; ++i)
+		{
+			const MemoryTagStats& stats = sTagStats[i];
+
+			const std::wstring str = std::wstring(sTagNames[i]) +
+				L": live " + std::to_wstring(stats.liveSize.Get(MemoryOrder::Relaxed)) +
+				L"B (" + std::to_wstring(stats.liveNum.Get(MemoryOrder::Relaxed)) +
+				L" blocks), peak " + std::to_wstring(stats.peakSize.Get(MemoryOrder::Relaxed)) +
+				L"B, total " + std::to_wstring(stats.totalNum.Get(MemoryOrder::Relaxed)) + L" allocs";
+
+			// Runtime string: SA_LOG only takes literals.
+			Debug::Log(Sa::Log(Debug::GetFileNameFromPath(SA_WIDE(__FILE__)), __SA_FUNC_NAME, __LINE__,
+				str.c_str(), LogLvlFlag::Infos, Debug::GetChannel(L"Tools")));
+		}
+
+#endif
+	}
+
+
+	MemoryTagScope::MemoryTagScope(MemoryTag _tag) noexcept : mPrevious{ sCurrentTag }
+	{
+		sCurrentTag = _tag;
+	}
+
+	MemoryTagScope::~MemoryTagScope() noexcept
+	{
+		sCurrentTag = mPrevious;
+	}
+}
@@ -0,0 +1,33 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Memory/ScratchArena.hpp>
+
+namespace Sa
+{
+	/// Number of opened ScratchScope on the calling thread.
+	static thread_local uint32 sScopeDepth = 0u;
+
+	ScratchScope::ScratchScope() noexcept :
+		mArena{ GetArena() },
+		mMarker{ mArena.GetMarker() }
+	{
+		++sScopeDepth;
+	}
+
+	ScratchScope::~ScratchScope()
+	{
+		// Outermost scope: full reset (free overflows and grow to the peak usage).
+		if (--sScopeDepth == 0u)
+			mArena.Reset();
+		else
+			mArena.Rewind(mMarker);
+	}
+
+
+	LinearArena& ScratchScope::GetArena() noexcept
+	{
+		thread_local LinearArena arena(DefaultCapacity);
+
+		return arena;
+	}
+}
@@ -0,0 +1,435 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Memory/TLSFAllocator.hpp>
+
+#include <cstdlib>
+
+#include <Collections/Debug>
+
+#include <Core/Support/Compilers.hpp>
+#include <Core/Memory/Align.hpp>
+
+#if SA_MSVC
+	#include <intrin.h>
+#endif
+
+namespace Sa
+{
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// Index of the most significant bit set (_value != 0).
+		static uint32 FindLastSet(uint64 _value) noexcept
+		{
+#if SA_MSVC
+			unsigned long index = 0u;
+			_BitScanReverse64(&index, _value);
+			return static_cast<uint32>(index);
+#else
+			return 63u - static_cast<uint32>(__builtin_clzll(_value));
+#endif
+		}
+
+		/// Index of the least significant bit set (_value != 0).
+		static uint32 FindFirstSet(uint32 _value) noexcept
+		{
+#if SA_MSVC
+			unsigned long index = 0u;
+			_BitScanForward(&index, _value);
+			return static_cast<uint32>(index);
+#else
+			return static_cast<uint32>(__builtin_ctz(_value));
+#endif
+		}
+
+		/// Header of a pool requested to the OS.
+		struct TLSFPool
+		{
+			TLSFPool* next;
+			uint64 size;
+		};
+
+		static_assert(sizeof(TLSFPool) == TLSFBlock::HeaderSize, "Pool header must keep block alignment!");
+	}
+
+	/// \endcond Internal
+
+
+	/// Free-list indices of a size.
+	struct TLSFMapping
+	{
+		uint32 fl = 0u;
+		uint32 sl = 0u;
+	};
+
+
+	TLSFAllocator::TLSFAllocator(uint64 _poolSize) noexcept : mPoolSize{ AlignUp(_poolSize, 4096u) }
+	{
+	}
+
+	TLSFAllocator::~TLSFAllocator()
+	{
+		if (mUsedSize)
+			SA_LOG("TLSFAllocator destroyed with allocated blocks!", Warning, Tools);
+
+		Internal::TLSFPool* pool = static_cast<Internal::TLSFPool*>(mPools);
+
+		while (pool)
+		{
+			Internal::TLSFPool* const next = pool->next;
+
+			std::free(pool);
+
+			pool = next;
+		}
+	}
+
+
+	uint64 TLSFAllocator::GetReservedSize() const noexcept
+	{
+		return mReservedSize;
+	}
+
+	uint64 TLSFAllocator::GetUsedSize() const noexcept
+	{
+		return mUsedSize;
+	}
+
+
+	/// Free-list indices where a block of _size is stored.
+	static TLSFMapping MappingInsert(uint64 _size, uint32 _slLog2, uint32 _flShift) noexcept
+	{
+		if (_size < (uint64(1u) << _flShift))
+			return TLSFMapping{ 0u, static_cast<uint32>(_size >> (_flShift - _slLog2)) };
+
+		const uint32 fl = Internal::FindLastSet(_size);
+		const uint32 sl = static_cast<uint32>(_size >> (fl - _slLog2)) ^ (1u << _slLog2);
+
+		return TLSFMapping{ fl - (_flShift - 1u), sl };
+	}
+
+	/// Free-list indices where every block is at least _size (rounded up to the next class).
+	static TLSFMapping MappingSearch(uint64 _size, uint32 _slLog2, uint32 _flShift) noexcept
+	{
+		if (_size >= (uint64(1u) << _flShift))
+			_size += (uint64(1u) << (Internal::FindLastSet(_size) - _slLog2)) - 1u;
+
+		return MappingInsert(_size, _slLog2, _flShift);
+	}
+
+
+	void TLSFAllocator::InsertFree(Block* _block) noexcept
+	{
+		const TLSFMapping map = MappingInsert(_block->GetSize(), SLLog2, FLShift);
+
+		Block*& head = mBlocks[map.fl][map.sl];
+
+		_block->prevFree = nullptr;
+		_block->nextFree = head;
+
+		if (head)
+			head->prevFree = _block;
+
+		head = _block;
+
+		mFLBitmap |= 1u << map.fl;
+		mSLBitmaps[map.fl] |= 1u << map.sl;
+
+		_block->SetFree(true);
+	}
+
+	void TLSFAllocator::RemoveFree(Block* _block) noexcept
+	{
+		const TLSFMapping map = MappingInsert(_block->GetSize(), SLLog2, FLShift);
+
+		if (_block->prevFree)
+			_block->prevFree->nextFree = _block->nextFree;
+		else
+		{
+			mBlocks[map.fl][map.sl] = _block->nextFree;
+
+			// List is now empty.
+			if (!_block->nextFree)
+			{
+				mSLBitmaps[map.fl] &= ~(1u << map.sl);
+
+				if (!mSLBitmaps[map.fl])
+					mFLBitmap &= ~(1u << map.fl);
+			}
+		}
+
+		if (_block->nextFree)
+			_block->nextFree->prevFree = _block->prevFree;
+
+		_block->SetFree(false);
+	}
+
+	TLSFAllocator::Block* TLSFAllocator::FindFree(uint64 _size) noexcept
+	{
+		TLSFMapping map = MappingSearch(_size, SLLog2, FLShift);
+
+		if (map.fl >= FLNum)
+			return nullptr;
+
+		uint32 slMap = mSLBitmaps[map.fl] & (~0u << map.sl);
+
+		if (!slMap)
+		{
+			// Next non-empty first level.
+			const uint32 flMap = map.fl + 1u < FLNum ? mFLBitmap & (~0u << (map.fl + 1u)) : 0u;
+
+			if (!flMap)
+				return nullptr;
+
+			map.fl = Internal::FindFirstSet(flMap);
+			slMap = mSLBitmaps[map.fl];
+		}
+
+		map.sl = Internal::FindFirstSet(slMap);
+
+		Block* const block = mBlocks[map.fl][map.sl];
+
+		RemoveFree(block);
+
+		return block;
+	}
+
+
+	/// Split _block at _size: the remainder becomes a new (unlinked) block.
+	static Internal::TLSFBlock* SplitBlock(Internal::TLSFBlock* _block, uint64 _size) noexcept
+	{
+		using Block = Internal::TLSFBlock;
+
+		Block* const remain = reinterpret_cast<Block*>(static_cast<uint8*>(_block->GetData()) + _size);
+
+		remain->prevPhys = _block;
+		remain->sizeFlags = 0u;
+		remain->SetSize(_block->GetSize() - _size - Block::HeaderSize);
+		remain->GetNext()->prevPhys = remain;
+
+		_block->SetSize(_size);
+
+		return remain;
+	}
+
+	/// Merge _next into _block (physical neighbours).
+	static void MergeBlock(Internal::TLSFBlock* _block, Internal::TLSFBlock* _next) noexcept
+	{
+		_block->SetSize(_block->GetSize() + Internal::TLSFBlock::HeaderSize + _next->GetSize());
+		_block->GetNext()->prevPhys = _block;
+	}
+
+
+	void TLSFAllocator::AddPool(uint64 _size)
+	{
+		using Pool = Internal::TLSFPool;
+
+		// Pool header + first block header + sentinel header.
+		constexpr uint64 overhead = sizeof(Pool) + 2u * Block::HeaderSize;
+
+		// Account for the search round-up (up to 1 / SLNum of the size).
+		uint64 poolSize = AlignUp(_size + (_size >> (SLLog2 - 1u)) + overhead + Alignment, 4096u);
+
+		if (poolSize < mPoolSize)
+			poolSize = mPoolSize;
+
+		Pool* const pool = static_cast<Pool*>(std::malloc(poolSize));
+
+		if (!pool)
+			return;
+
+		pool->next = static_cast<Pool*>(mPools);
+		pool->size = poolSize;
+
+		mPools = pool;
+		mReservedSize += poolSize;
+
+		Block* const first = reinterpret_cast<Block*>(pool + 1);
+		first->prevPhys = nullptr;
+		first->sizeFlags = 0u;
+		first->SetSize(poolSize - overhead);
+
+		// Sentinel: used empty block, never merged.
+		Block* const sentinel = first->GetNext();
+		sentinel->prevPhys = first;
+		sentinel->sizeFlags = 0u;
+
+		InsertFree(first);
+	}
+
+
+	void* TLSFAllocator::Allocate(uint64 _size, uint64 _alignment, MemoryTag _tag)
+	{
+		SA_ASSERT(IsPowerOfTwo(_alignment), InvalidParam, Tools, L"Alignment must be a power of 2!");
+		SA_ASSERT(_size < (uint64(1u) << (FLMax - 1u)), InvalidParam, Tools, L"Allocation size too big!");
+
+		const uint64 size = _size > MinBlockSize ? AlignUp(_size, Alignment) : MinBlockSize;
+
+		// Front gap must be 0 or big enough to hold a free block.
+		constexpr uint64 minGap = Block::HeaderSize + MinBlockSize;
+		const uint64 searchSize = _alignment <= Alignment ? size : size + _alignment + minGap;
+
+		Block* block = FindFree(searchSize);
+
+		if (!block)
+		{
+			AddPool(searchSize);
+			block = FindFree(searchSize);
+
+			if (!block)
+				return nullptr;
+		}
+
+		if (_alignment > Alignment)
+		{
+			uint8* const data = static_cast<uint8*>(block->GetData());
+			uint8* aligned = reinterpret_cast<uint8*>(AlignUp(reinterpret_cast<uint64>(data), _alignment));
+
+			if (aligned != data && static_cast<uint64>(aligned - data) < minGap)
+				aligned = reinterpret_cast<uint8*>(AlignUp(reinterpret_cast<uint64>(data + minGap), _alignment));
+
+			if (aligned != data)
+			{
+				// Give the front gap back: previous physical block is never free.
+				Block* const front = block;
+				block = SplitBlock(front, static_cast<uint64>(aligned - data) - Block::HeaderSize);
+
+				InsertFree(front);
+			}
+		}
+
+		// Give the remainder back: next physical block is never free.
+		if (block->GetSize() >= size + minGap)
+			InsertFree(SplitBlock(block, size));
+
+		block->SetTag(_tag);
+
+		const uint64 blockSize = block->GetSize();
+
+		mUsedSize += blockSize;
+		MemoryTags::OnAllocate(_tag, blockSize);
+
+		return block->GetData();
+	}
+
+	void TLSFAllocator::Free(void* _ptr) noexcept
+	{
+		if (!_ptr)
+			return;
+
+		Block* block = Block::FromData(_ptr);
+
+		const uint64 blockSize = block->GetSize();
+
+		mUsedSize -= blockSize;
+		MemoryTags::OnFree(block->GetTag(), blockSize);
+
+		block->SetTag(MemoryTags::Default);
+
+		Block* const prev = block->prevPhys;
+
+		if (prev && prev->IsFree())
+		{
+			RemoveFree(prev);
+			MergeBlock(prev, block);
+
+			block = prev;
+		}
+
+		Block* const next = block->GetNext();
+
+		if (next->IsFree())
+		{
+			RemoveFree(next);
+			MergeBlock(block, next);
+		}
+
+		InsertFree(block);
+	}
+
+
+	uint64 TLSFAllocator::GetAllocationSize(const void* _ptr) noexcept
+	{
+		return Block::FromData(_ptr)->GetSize();
+	}
+
+	MemoryTag TLSFAllocator::GetAllocationTag(const void* _ptr) noexcept
+	{
+		return Block::FromData(_ptr)->GetTag();
+	}
+
+
+	bool TLSFAllocator::Validate() const noexcept
+	{
+		uint64 usedSize = 0u;
+		uint64 freeNum = 0u;
+
+		// Physical blocks.
+		for (const Internal::TLSFPool* pool = static_cast<const Internal::TLSFPool*>(mPools); pool; pool = pool->next)
+		{
+			Block* block = reinterpret_cast<Block*>(const_cast<Internal::TLSFPool*>(pool + 1));
+			const Block* prev = nullptr;
+
+			while (block->GetSize())
+			{
+				if (block->prevPhys != prev)
+					return false;
+
+				if (block->IsFree())
+				{
+					// Adjacent free blocks must have been merged.
+					if (prev && prev->IsFree())
+						return false;
+
+					const TLSFMapping map = MappingInsert(block->GetSize(), SLLog2, FLShift);
+
+					if (!(mSLBitmaps[map.fl] & (1u << map.sl)))
+						return false;
+
+					++freeNum;
+				}
+				else
+					usedSize += block->GetSize();
+
+				prev = block;
+				block = block->GetNext();
+			}
+
+			// Sentinel.
+			if (block->prevPhys != prev || block->IsFree() ||
+				reinterpret_cast<const uint8*>(block) + Block::HeaderSize != reinterpret_cast<const uint8*>(pool) + pool->size)
+				return false;
+		}
+
+		if (usedSize != mUsedSize)
+			return false;
+
+		// Free-lists.
+		for (uint32 fl = 0u; fl < FLNum; ++fl)
+		{
+			if (static_cast<bool>(mFLBitmap & (1u << fl)) != static_cast<bool>(mSLBitmaps[fl]))
+				return false;
+
+			for (uint32 sl = 0u; sl < SLNum; ++sl)
+			{
+				const Block* block = mBlocks[fl][sl];
+
+				if (static_cast<bool>(mSLBitmaps[fl] & (1u << sl)) != static_cast<bool>(block))
+					return false;
+
+				for (const Block* prev = nullptr; block; prev = block, block = block->nextFree)
+				{
+					const TLSFMapping map = MappingInsert(block->GetSize(), SLLog2, FLShift);
+
+					if (!block->IsFree() || block->prevFree != prev || map.fl != fl || map.sl != sl)
+						return false;
+
+					--freeNum;
+				}
+			}
+		}
+
+		return freeNum == 0u;
+	}
+}
@@ -0,0 +1,64 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Misc/StringId.hpp>
+
+#include <cstring>
+
+#include <Collections/Debug>
+
+#include <Core/Thread/SharedMutex.hpp>
+#include <Core/Containers/FlatHashMap.hpp>
+
+namespace Sa
+{
+	/// Guard intern table: read on GetString, written on first Intern of a string.
+	static SharedMutex sInternMutex;
+
+	/// Interned strings by ID (function-local: may be used during static initialization).
+	static FlatHashMap<StringId, const char8*>& GetInternTable()
+	{
+		// Never destroyed: interned strings live until the end of the program.
+		static FlatHashMap<StringId, const char8*>* const table = new FlatHashMap<StringId, const char8*>();
+
+		return *table;
+	}
+
+
+	StringId StringId::Intern(const std::string& _str)
+	{
+		const StringId id(_str);
+
+		bool bCollision = false;
+
+		{
+			RAII<SharedMutex> lock(sInternMutex);
+
+			std::pair<const char8**, bool> res = GetInternTable().Emplace(id, nullptr);
+
+			if (res.second)
+			{
+				char8* const str = new char8[_str.size() + 1u];
+				std::memcpy(str, _str.c_str(), _str.size() + 1u);
+
+				*res.first = str;
+			}
+			else if (std::strcmp(*res.first, _str.c_str()) != 0)
+				bCollision = true;
+		}
+
+		// Don't assert while locked: assertion may intern strings.
+		SA_ASSERT(!bCollision, InvalidParam, Tools, L"StringId collision between interned strings!");
+		(void)bCollision;
+
+		return id;
+	}
+
+	const char8* StringId::GetString(StringId _id)
+	{
+		RAII<SharedMutex> lock(sInternMutex, true);
+
+		const char8* const* str = GetInternTable().Find(_id);
+
+		return str ? *str : nullptr;
+	}
+}
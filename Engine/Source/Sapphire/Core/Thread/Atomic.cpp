@@ -0,0 +1,95 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <cstdint>
+
+#include <Core/Thread/Atomic.hpp>
+#include <Core/Thread/CacheLine.hpp>
+
+#include <Core/Support/Platforms.hpp>
+
+#if SA_UNIX
+
+	#include <climits>
+
+	#include <unistd.h>
+	#include <sys/syscall.h>
+	#include <linux/futex.h>
+
+#elif SA_WIN
+
+	#include <Core/Support/Windows.hpp>
+
+	#pragma comment(lib, "Synchronization.lib")
+
+#else
+
+	#include <thread>
+
+#endif
+
+namespace Sa
+{
+	namespace Internal
+	{
+		/// Number of shared wait counters (power of 2).
+		static constexpr uint32 sWaitCounterNum = 256u;
+
+		/// Wait counters used by non 32 bits atomics. One per cache line to avoid false sharing.
+		static struct alignas(CacheLineSize) WaitCounter
+		{
+			std::atomic<uint32> value{ 0u };
+		} sWaitCounters[sWaitCounterNum];
+
+
+		void AtomicWait(const void* _address, uint32 _old) noexcept
+		{
+#if SA_UNIX
+
+			syscall(SYS_futex, _address, FUTEX_WAIT_PRIVATE, _old, nullptr, nullptr, 0);
+
+#elif SA_WIN
+
+			WaitOnAddress(const_cast<void*>(_address), &_old, sizeof(uint32), INFINITE);
+
+#else
+
+			// No OS support: caller loops on the value.
+			(void)_address;
+			(void)_old;
+
+			std::this_thread::yield();
+
+#endif
+		}
+
+		void AtomicWake(const void* _address, bool _bAll) noexcept
+		{
+#if SA_UNIX
+
+			syscall(SYS_futex, _address, FUTEX_WAKE_PRIVATE, _bAll ? INT_MAX : 1, nullptr, nullptr, 0);
+
+#elif SA_WIN
+
+			if (_bAll)
+				WakeByAddressAll(const_cast<void*>(_address));
+			else
+				WakeByAddressSingle(const_cast<void*>(_address));
+
+#else
+
+			(void)_address;
+			(void)_bAll;
+
+#endif
+		}
+
+		std::atomic<uint32>& GetAtomicWaitCounter(const void* _address) noexcept
+		{
+			// Drop alignment bits then mix.
+			uint64 hash = static_cast<uint64>(reinterpret_cast<std::uintptr_t>(_address)) >> 3u;
+			hash ^= hash >> 17u;
+
+			return sWaitCounters[hash & (sWaitCounterNum - 1u)].value;
+		}
+	}
+}
@@ -0,0 +1,38 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Thread/FutexMutex.hpp>
+
+#include <Core/Thread/CpuPause.hpp>
+
+namespace Sa
+{
+	void FutexMutex::LockSlow() noexcept
+	{
+		__SA_LOCK_STAT(mStats, contendedNum);
+
+		// Short spin: the owner may release soon.
+		for (uint32 i = 0u; i < SpinNum; ++i)
+		{
+			uint32 expected = sUnlocked;
+
+			if (mHandle.Get(MemoryOrder::Relaxed) == sUnlocked &&
+				mHandle.CompareExchangeWeak(expected, sLocked, MemoryOrder::Acquire, MemoryOrder::Relaxed))
+				return;
+
+			CpuPause();
+		}
+
+		// Mark contended: the owner will wake us on Unlock().
+		// Acquiring from here keeps the contended state (other waiters may exist).
+		while (mHandle.Exchange(sContended, MemoryOrder::Acquire) != sUnlocked)
+		{
+			__SA_LOCK_STAT(mStats, sleepNum);
+			mHandle.Wait(sContended, MemoryOrder::Relaxed);
+		}
+	}
+
+	void FutexMutex::UnlockSlow() noexcept
+	{
+		mHandle.NotifyOne();
+	}
+}
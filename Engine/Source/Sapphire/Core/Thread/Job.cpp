@@ -0,0 +1,59 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Thread/Job.hpp>
+
+#include <Core/Debug/Debug.hpp>
+
+namespace Sa
+{
+	uint32 JobCounter::GetPending() const noexcept
+	{
+		return mCount.Get();
+	}
+
+	bool JobCounter::IsDone() const noexcept
+	{
+		return mCount.Get() == 0u;
+	}
+
+
+	void JobCounter::Increment(uint32 _num) noexcept
+	{
+		mCount += _num;
+	}
+
+	void JobCounter::Decrement() noexcept
+	{
+		--mCount;
+	}
+
+
+	bool Job::IsPending() const noexcept
+	{
+		return mPending.Get();
+	}
+
+	bool Job::TryClaim() noexcept
+	{
+		bool expected = false;
+
+		return mPending.CompareExchangeStrong(expected, true, MemoryOrder::Acquire, MemoryOrder::Relaxed);
+	}
+
+	void Job::Execute()
+	{
+		SA_ASSERT(mInvoke, Nullptr, Tools, L"Execute job without function: call Set() first!");
+
+		mInvoke(mData);
+		mInvoke = nullptr;
+
+		// Save counter: the job may be recycled as soon as it's no longer pending.
+		JobCounter* const counter = mCounter;
+		mCounter = nullptr;
+
+		mPending = false;
+
+		if (counter)
+			counter->Decrement();
+	}
+}
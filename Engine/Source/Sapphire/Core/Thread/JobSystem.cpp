@@ -0,0 +1,309 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <deque>
+#include <cstdio>
+
+#include <Core/Thread/JobSystem.hpp>
+
+#include <Core/Thread/Mutex.hpp>
+#include <Core/Thread/Thread.hpp>
+#include <Core/Thread/WorkStealingDeque.hpp>
+
+#include <Core/Debug/Debug.hpp>
+
+namespace Sa
+{
+	/// Per-thread worker data.
+	struct JobWorker
+	{
+		/// Pending jobs of this worker.
+		WorkStealingDeque<Job*, JobSystem::MaxJobNum> queue;
+
+		/// Pool of jobs allocated by this worker.
+		Job jobs[JobSystem::MaxJobNum];
+
+		/// Next job to allocate in jobs (wrapped).
+		uint32 jobIndex = 0u;
+
+		/// Handled thread (empty for worker 0).
+		Thread thread;
+	};
+
+	/// Index of the worker of the current thread. uint32(-1) for non-worker threads.
+	static thread_local uint32 sWorkerIndex = uint32(-1);
+
+	static JobWorker* sWorkers = nullptr;
+	static uint32 sWorkerNum = 0u;
+
+	static Atomic<bool> sRunning = false;
+
+	/// Number of jobs submitted and not yet picked for execution.
+	static Atomic<uint32> sJobNum = 0u;
+
+
+	// Jobs scheduled from non-worker threads.
+	static Mutex sExternalMutex;
+	static std::deque<Job*> sExternalQueue;
+	static Job sExternalJobs[JobSystem::MaxJobNum];
+	static uint32 sExternalJobIndex = 0u;
+	static Atomic<uint32> sExternalNum = 0u;
+
+
+	// Idle worker parking.
+	static Atomic<uint32> sSleepingNum = 0u;
+
+	/// Incremented on each wake-up request: sleeping workers Wait() on it.
+	static Atomic<uint32> sWakeCount = 0u;
+
+	/// Number of TryExecuteOne() failures before a worker goes to sleep.
+	static constexpr uint32 sSpinNum = 64u;
+
+
+	static Job* FindJob()
+	{
+		Job* job = nullptr;
+		const uint32 index = sWorkerIndex;
+
+		// Local deque first (LIFO: cache-hot).
+		if (index < sWorkerNum && sWorkers[index].queue.Pop(job))
+			return job;
+
+		// External queue.
+		if (sExternalNum.Get() > 0u)
+		{
+			RAII<Mutex> lock(sExternalMutex);
+
+			if (!sExternalQueue.empty())
+			{
+				job = sExternalQueue.front();
+				sExternalQueue.pop_front();
+				--sExternalNum;
+
+				return job;
+			}
+		}
+
+		// Steal from the other workers.
+		const uint32 start = index < sWorkerNum ? index + 1u : 0u;
+
+		for (uint32 i = 0u; i < sWorkerNum; ++i)
+		{
+			const uint32 victim = (start + i) % sWorkerNum;
+
+			if (victim != index && sWorkers[victim].queue.Steal(job))
+				return job;
+		}
+
+		return nullptr;
+	}
+
+	static void WorkerMain(uint32 _index)
+	{
+		sWorkerIndex = _index;
+
+		char name[16];
+		std::snprintf(name, sizeof(name), "Sa Worker %u", _index);
+
+		Thread::SetCurrentName(name);
+
+		while (sRunning.Get())
+		{
+			uint32 spin = 0u;
+
+			while (spin < sSpinNum)
+			{
+				if (JobSystem::TryExecuteOne())
+					spin = 0u;
+				else
+				{
+					++spin;
+					Thread::Yield();
+				}
+			}
+
+			// Sleep until new jobs are submitted.
+			const uint32 wakeCount = sWakeCount.Get(MemoryOrder::Acquire);
+
+			++sSleepingNum;
+
+			// Submit() increments sJobNum before reading sSleepingNum: either this check sees the job
+			// or the submitter sees this sleeper and changes sWakeCount.
+			if (sJobNum.Get() == 0u && sRunning.Get())
+				sWakeCount.Wait(wakeCount, MemoryOrder::Acquire);
+
+			--sSleepingNum;
+		}
+
+		// Drain jobs submitted during shutdown.
+		while (JobSystem::TryExecuteOne());
+
+		sWorkerIndex = uint32(-1);
+	}
+
+
+	void JobSystem::Init(uint32 _workerNum)
+	{
+		SA_ASSERT(!IsInit(), AlreadyCreated, Tools, L"JobSystem already initialized!");
+
+		if (_workerNum == 0u)
+			_workerNum = Thread::HardwareConcurrency();
+
+		// HardwareConcurrency() may return 0 when not computable.
+		if (_workerNum == 0u)
+			_workerNum = 1u;
+
+		sWorkers = new JobWorker[_workerNum];
+		sWorkerNum = _workerNum;
+		sRunning = true;
+
+		// Calling thread is worker 0.
+		sWorkerIndex = 0u;
+
+		for (uint32 i = 1u; i < _workerNum; ++i)
+			sWorkers[i].thread = Thread([i]() { WorkerMain(i); });
+	}
+
+	void JobSystem::UnInit()
+	{
+		SA_ASSERT(IsInit(), UnInit, Tools, L"JobSystem not initialized!");
+
+		// Help executing pending jobs.
+		while (sJobNum.Get() > 0u)
+		{
+			if (!TryExecuteOne())
+				Thread::Yield();
+		}
+
+		sRunning = false;
+
+		sWakeCount.FetchAdd(1u, MemoryOrder::Release);
+		sWakeCount.NotifyAll();
+
+		for (uint32 i = 1u; i < sWorkerNum; ++i)
+			sWorkers[i].thread.Join();
+
+		// Jobs submitted by the last running jobs.
+		while (TryExecuteOne());
+
+		delete[] sWorkers;
+		sWorkers = nullptr;
+		sWorkerNum = 0u;
+
+		sWorkerIndex = uint32(-1);
+	}
+
+
+	bool JobSystem::IsInit() noexcept
+	{
+		return sWorkerNum > 0u;
+	}
+
+	uint32 JobSystem::GetWorkerNum() noexcept
+	{
+		return sWorkerNum;
+	}
+
+	uint32 JobSystem::GetWorkerIndex() noexcept
+	{
+		return sWorkerIndex;
+	}
+
+
+	Job* JobSystem::AllocateJob()
+	{
+		const uint32 index = sWorkerIndex;
+
+		while (true)
+		{
+			// Skip slots still pending (queued or currently executing, like a job scheduling from itself).
+			if (index < sWorkerNum)
+			{
+				JobWorker& worker = sWorkers[index];
+
+				for (uint32 i = 0u; i < MaxJobNum; ++i)
+				{
+					Job* const job = &worker.jobs[worker.jobIndex++ & (MaxJobNum - 1u)];
+
+					if (job->TryClaim())
+						return job;
+				}
+			}
+			else
+			{
+				// Claim under the lock: another external thread may wrap to the same slot before Set().
+				RAII<Mutex> lock(sExternalMutex);
+
+				for (uint32 i = 0u; i < MaxJobNum; ++i)
+				{
+					Job* const job = &sExternalJobs[sExternalJobIndex++ & (MaxJobNum - 1u)];
+
+					if (job->TryClaim())
+						return job;
+				}
+			}
+
+			// Pool exhausted: help until a slot is recycled.
+			if (!TryExecuteOne())
+				Thread::Yield();
+		}
+	}
+
+	void JobSystem::Submit(Job* _job)
+	{
+		SA_ASSERT(_job, Nullptr, Tools, L"Submit nullptr job!");
+
+		const uint32 index = sWorkerIndex;
+
+		// Count before publishing: a thief may pick the job right after the push.
+		++sJobNum;
+
+		if (index < sWorkerNum)
+		{
+			// Deque full: execute inline.
+			if (!sWorkers[index].queue.Push(_job))
+			{
+				--sJobNum;
+				_job->Execute();
+				return;
+			}
+		}
+		else
+		{
+			RAII<Mutex> lock(sExternalMutex);
+
+			sExternalQueue.push_back(_job);
+			++sExternalNum;
+		}
+
+		// Wake up a sleeping worker.
+		if (sSleepingNum.Get() > 0u)
+		{
+			sWakeCount.FetchAdd(1u, MemoryOrder::Release);
+			sWakeCount.NotifyOne();
+		}
+	}
+
+
+	void JobSystem::Wait(const JobCounter& _counter)
+	{
+		while (!_counter.IsDone())
+		{
+			if (!TryExecuteOne())
+				Thread::Yield();
+		}
+	}
+
+	bool JobSystem::TryExecuteOne()
+	{
+		Job* const job = FindJob();
+
+		if (!job)
+			return false;
+
+		--sJobNum;
+
+		job->Execute();
+
+		return true;
+	}
+}
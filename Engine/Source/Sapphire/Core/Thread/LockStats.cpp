@@ -0,0 +1,13 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Thread/LockStats.hpp>
+
+namespace Sa
+{
+	void LockStats::Reset() noexcept
+	{
+		lockNum.Set(0u, MemoryOrder::Relaxed);
+		contendedNum.Set(0u, MemoryOrder::Relaxed);
+		sleepNum.Set(0u, MemoryOrder::Relaxed);
+	}
+}
@@ -0,0 +1,98 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Thread/SharedMutex.hpp>
+
+#include <Core/Thread/CpuPause.hpp>
+
+namespace Sa
+{
+	void SharedMutex::Park(uint32 _state) noexcept
+	{
+		// Register as waiter first: unlocks only wake when the bit is set.
+		if ((_state & sWaitersBit) == 0u &&
+			!mHandle.CompareExchangeStrong(_state, _state | sWaitersBit, MemoryOrder::Relaxed))
+			return;
+
+		__SA_LOCK_STAT(mStats, sleepNum);
+
+		mHandle.Wait(_state | sWaitersBit, MemoryOrder::Relaxed);
+	}
+
+	void SharedMutex::LockSlow() noexcept
+	{
+		__SA_LOCK_STAT(mStats, contendedNum);
+
+		uint32 spin = 0u;
+
+		while (true)
+		{
+			uint32 state = mHandle.Get(MemoryOrder::Relaxed);
+
+			// No reader nor writer: acquire, keep the waiters bit for other parked threads.
+			if ((state & (sWriterBit | sReaderMask)) == 0u)
+			{
+				if (mHandle.CompareExchangeWeak(state, sWriterBit | (state & sWaitersBit), MemoryOrder::Acquire, MemoryOrder::Relaxed))
+					break;
+
+				continue;
+			}
+
+			// Block new readers.
+			if ((state & sWriterWaitingBit) == 0u)
+			{
+				if (!mHandle.CompareExchangeWeak(state, state | sWriterWaitingBit, MemoryOrder::Relaxed))
+					continue;
+
+				state |= sWriterWaitingBit;
+			}
+
+			if (spin < SpinNum)
+			{
+				++spin;
+				CpuPause();
+			}
+			else
+				Park(state);
+		}
+
+		__SA_LOCK_STAT(mStats, lockNum);
+	}
+
+	void SharedMutex::Unlock() noexcept
+	{
+		const uint32 prev = mHandle.Exchange(0u, MemoryOrder::Release);
+
+		if (prev & sWaitersBit)
+			mHandle.NotifyAll();
+	}
+
+	void SharedMutex::LockSharedSlow() noexcept
+	{
+		__SA_LOCK_STAT(mStats, contendedNum);
+
+		uint32 spin = 0u;
+
+		while (true)
+		{
+			uint32 state = mHandle.Get(MemoryOrder::Relaxed);
+
+			if ((state & (sWriterBit | sWriterWaitingBit)) == 0u)
+			{
+				if (mHandle.CompareExchangeWeak(state, state + 1u, MemoryOrder::Acquire, MemoryOrder::Relaxed))
+					break;
+
+				continue;
+			}
+
+			if (spin < SpinNum)
+			{
+				++spin;
+				CpuPause();
+			}
+			else
+				Park(state);
+		}
+
+		__SA_LOCK_STAT(mStats, lockNum);
+	}
+}
@@ -0,0 +1,37 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Thread/SpinLock.hpp>
+
+#include <Core/Thread/Thread.hpp>
+#include <Core/Thread/CpuPause.hpp>
+
+namespace Sa
+{
+	void SpinLock::LockSlow() noexcept
+	{
+		__SA_LOCK_STAT(mStats, contendedNum);
+
+		uint32 backoff = 1u;
+
+		do
+		{
+			// Spin on a read: only try to acquire once the lock looks free.
+			while (mHandle.Test(MemoryOrder::Relaxed))
+			{
+				if (backoff <= MaxBackoff)
+				{
+					for (uint32 i = 0u; i < backoff; ++i)
+						CpuPause();
+
+					backoff <<= 1u;
+				}
+				else
+				{
+					__SA_LOCK_STAT(mStats, sleepNum);
+					Thread::Yield();
+				}
+			}
+		}
+		while (mHandle.TestAndSet(MemoryOrder::Acquire));
+	}
+}
@@ -0,0 +1,177 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Thread/TaskGraph.hpp>
+
+#include <Core/Time/Time.hpp>
+
+#include <Core/Debug/Debug.hpp>
+
+namespace Sa
+{
+	void TaskGraph::AddEdge(uint32 _from, uint32 _to)
+	{
+		SA_ASSERT(_from < mNodes.size(), OutOfRange, Tools, _from, 0u, static_cast<uint32>(mNodes.size()));
+		SA_ASSERT(_to < mNodes.size(), OutOfRange, Tools, _to, 0u, static_cast<uint32>(mNodes.size()));
+		SA_ASSERT(_from != _to, InvalidParam, Tools, L"Node can't depend on itself!");
+
+		mNodes[_from].successors.push_back(_to);
+		++mNodes[_to].depNum;
+
+		mIsCompiled = false;
+	}
+
+	void TaskGraph::Clear()
+	{
+		SA_ASSERT(mCounter.IsDone(), InvalidParam, Tools, L"Clear a running TaskGraph!");
+
+		mNodes.clear();
+		mRoots.clear();
+		mOrder.clear();
+		mFinishes.clear();
+		mRemainings.reset();
+
+		mIsCompiled = false;
+	}
+
+
+	void TaskGraph::Compile()
+	{
+		const uint32 nodeNum = static_cast<uint32>(mNodes.size());
+
+		mRemainings.reset(new Atomic<uint32>[nodeNum]);
+		mFinishes.resize(nodeNum);
+
+		mRoots.clear();
+		mOrder.clear();
+		mOrder.reserve(nodeNum);
+
+		// Kahn's algorithm.
+		for (uint32 i = 0u; i < nodeNum; ++i)
+		{
+			mRemainings[i] = mNodes[i].depNum;
+
+			if (mNodes[i].depNum == 0u)
+			{
+				mRoots.push_back(i);
+				mOrder.push_back(i);
+			}
+		}
+
+		for (uint32 i = 0u; i < mOrder.size(); ++i)
+		{
+			for (uint32 succ : mNodes[mOrder[i]].successors)
+			{
+				if (--mRemainings[succ] == 0u)
+					mOrder.push_back(succ);
+			}
+		}
+
+		SA_ASSERT(mOrder.size() == nodeNum, InvalidParam, Tools, L"TaskGraph has a cycle!");
+
+		mIsCompiled = true;
+	}
+
+	void TaskGraph::Run()
+	{
+		SA_ASSERT(mIsCompiled, InvalidParam, Tools, L"Run a non-compiled TaskGraph: call Compile() first!");
+		SA_ASSERT(mCounter.IsDone(), InvalidParam, Tools, L"TaskGraph already running!");
+
+		const uint32 nodeNum = static_cast<uint32>(mNodes.size());
+
+		for (uint32 i = 0u; i < nodeNum; ++i)
+			mRemainings[i] = mNodes[i].depNum;
+
+		const Tick start = Time::Ticks();
+
+		for (uint32 root : mRoots)
+			JobSystem::Run([this, root]() { ExecuteNode(root); }, &mCounter);
+
+		JobSystem::Wait(mCounter);
+
+		mDuration = Time::Ticks() - start;
+
+
+		// Critical path: longest chain of node durations in topological order.
+		Tick criticalPath;
+
+		for (uint32 i = 0u; i < nodeNum; ++i)
+			mFinishes[i] = Tick();
+
+		for (uint32 index : mOrder)
+		{
+			const Node& node = mNodes[index];
+			const Tick finish = mFinishes[index] + (node.end - node.start);
+
+			for (uint32 succ : node.successors)
+			{
+				if (finish > mFinishes[succ])
+					mFinishes[succ] = finish;
+			}
+
+			if (finish > criticalPath)
+				criticalPath = finish;
+		}
+
+		mCriticalPath = criticalPath;
+	}
+
+	void TaskGraph::ExecuteNode(uint32 _index)
+	{
+		while (_index != InvalidNode)
+		{
+			Node& node = mNodes[_index];
+
+			node.start = Time::Ticks();
+
+			node.func();
+
+			node.end = Time::Ticks();
+
+			// Dispatch ready successors, keep the last one to execute it inline.
+			uint32 next = InvalidNode;
+
+			for (uint32 succ : node.successors)
+			{
+				if (--mRemainings[succ] != 0u)
+					continue;
+
+				if (next != InvalidNode)
+					JobSystem::Run([this, next]() { ExecuteNode(next); }, &mCounter);
+
+				next = succ;
+			}
+
+			_index = next;
+		}
+	}
+
+
+	uint32 TaskGraph::GetNodeNum() const noexcept
+	{
+		return static_cast<uint32>(mNodes.size());
+	}
+
+	const char* TaskGraph::GetNodeName(uint32 _index) const
+	{
+		SA_ASSERT(_index < mNodes.size(), OutOfRange, Tools, _index, 0u, static_cast<uint32>(mNodes.size()));
+
+		return mNodes[_index].name;
+	}
+
+	Tick TaskGraph::GetNodeDuration(uint32 _index) const
+	{
+		SA_ASSERT(_index < mNodes.size(), OutOfRange, Tools, _index, 0u, static_cast<uint32>(mNodes.size()));
+
+		return mNodes[_index].end - mNodes[_index].start;
+	}
+
+	Tick TaskGraph::GetDuration() const noexcept
+	{
+		return mDuration;
+	}
+
+	Tick TaskGraph::GetCriticalPath() const noexcept
+	{
+		return mCriticalPath;
+	}
+}
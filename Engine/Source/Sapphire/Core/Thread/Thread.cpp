@@ -2,18 +2,244 @@
 
 #include <Core/Thread/Thread.hpp>
 
+#include <Core/Support/Platforms.hpp>
+
+#include <Core/Thread/Atomic.hpp>
+
+#if SA_UNIX
+
+	#include <cstdio>
+	#include <cstring>
+
+	#include <pthread.h>
+	#include <sched.h>
+
+#elif SA_WIN
+
+	#include <cstring>
+	#include <string>
+
+	#include <Core/Support/Windows.hpp>
+
+#endif
+
 namespace Sa
 {
+	/// Number of IDs already assigned.
+	static Atomic<uint32> sThreadNum = 0u;
+
+	/// ID of the calling thread.
+	static thread_local uint32 sCurrentID = Thread::InvalidID;
+
+
+	// Platform implementations on native handles.
+
+#if SA_UNIX
+
+	static bool SetNativeName(pthread_t _handle, const char* _name) noexcept
+	{
+		// Linux limit: 16 chars including null terminator.
+		char name[16]{};
+		std::strncpy(name, _name, sizeof(name) - 1u);
+
+		return pthread_setname_np(_handle, name) == 0;
+	}
+
+	static bool SetNativeAffinity(pthread_t _handle, uint64 _coreMask) noexcept
+	{
+		if (_coreMask == 0u)
+			return false;
+
+		cpu_set_t set;
+		CPU_ZERO(&set);
+
+		for (uint32 i = 0u; i < 64u; ++i)
+		{
+			if (_coreMask & (uint64(1) << i))
+				CPU_SET(i, &set);
+		}
+
+		return pthread_setaffinity_np(_handle, sizeof(set), &set) == 0;
+	}
+
+	/**
+	*	\brief Parse a sysfs cpu list ("0-3,8,10-11") into a mask.
+	*/
+	static uint64 ReadCoreList(const char* _path) noexcept
+	{
+		FILE* const file = std::fopen(_path, "r");
+
+		if (!file)
+			return 0u;
+
+		uint64 mask = 0u;
+		uint32 first = 0u;
+		uint32 last = 0u;
+
+		while (std::fscanf(file, "%u", &first) == 1)
+		{
+			last = first;
+
+			int sep = std::fgetc(file);
+
+			if (sep == '-')
+			{
+				if (std::fscanf(file, "%u", &last) != 1)
+					break;
+
+				sep = std::fgetc(file);
+			}
+
+			for (uint32 i = first; i <= last && i < 64u; ++i)
+				mask |= uint64(1) << i;
+
+			if (sep != ',')
+				break;
+		}
+
+		std::fclose(file);
+
+		return mask;
+	}
+
+	static uint64 GetNumaNodeCoreMask(uint32 _node) noexcept
+	{
+		char path[64];
+		std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", _node);
+
+		uint64 mask = ReadCoreList(path);
+
+		// No NUMA info: node 0 owns every core.
+		if (mask == 0u && _node == 0u)
+			mask = ~uint64(0);
+
+		return mask;
+	}
+
+	static bool SetNativePriority(pthread_t _handle, ThreadPriority _priority) noexcept
+	{
+		sched_param param{};
+		int policy = SCHED_OTHER;
+
+		switch (_priority)
+		{
+			case ThreadPriority::Low:
+				policy = SCHED_IDLE;
+				break;
+			case ThreadPriority::High:
+				policy = SCHED_RR;
+				param.sched_priority = sched_get_priority_min(SCHED_RR);
+				break;
+			case ThreadPriority::Critical:
+				policy = SCHED_FIFO;
+				param.sched_priority = sched_get_priority_max(SCHED_FIFO);
+				break;
+			default:
+				break;
+		}
+
+		return pthread_setschedparam(_handle, policy, &param) == 0;
+	}
+
+	static pthread_t GetCurrentNative() noexcept
+	{
+		return pthread_self();
+	}
+
+#elif SA_WIN
+
+	static bool SetNativeName(HANDLE _handle, const char* _name) noexcept
+	{
+		const std::wstring name(_name, _name + std::strlen(_name));
+
+		return SUCCEEDED(SetThreadDescription(_handle, name.c_str()));
+	}
+
+	static bool SetNativeAffinity(HANDLE _handle, uint64 _coreMask) noexcept
+	{
+		return _coreMask && SetThreadAffinityMask(_handle, static_cast<DWORD_PTR>(_coreMask)) != 0;
+	}
+
+	static uint64 GetNumaNodeCoreMask(uint32 _node) noexcept
+	{
+		ULONGLONG mask = 0u;
+
+		if (!GetNumaNodeProcessorMask(static_cast<UCHAR>(_node), &mask))
+			return 0u;
+
+		return mask;
+	}
+
+	static bool SetNativePriority(HANDLE _handle, ThreadPriority _priority) noexcept
+	{
+		static constexpr int priorities[] = {
+			THREAD_PRIORITY_LOWEST,
+			THREAD_PRIORITY_NORMAL,
+			THREAD_PRIORITY_HIGHEST,
+			THREAD_PRIORITY_TIME_CRITICAL
+		};
+
+		return SetThreadPriority(_handle, priorities[static_cast<uint32>(_priority)]) != 0;
+	}
+
+	static HANDLE GetCurrentNative() noexcept
+	{
+		return GetCurrentThread();
+	}
+
+#else
+
+	template <typename T>
+	static bool SetNativeName(T, const char*) noexcept { return false; }
+
+	template <typename T>
+	static bool SetNativeAffinity(T, uint64) noexcept { return false; }
+
+	static uint64 GetNumaNodeCoreMask(uint32) noexcept { return 0u; }
+
+	template <typename T>
+	static bool SetNativePriority(T, ThreadPriority) noexcept { return false; }
+
+	static std::thread::native_handle_type GetCurrentNative() noexcept { return {}; }
+
+#endif
+
+
+	Thread::Thread(Thread&& _other) noexcept :
+		mHandle{ Move(_other.mHandle) },
+		mID{ _other.mID }
+	{
+		_other.mID = InvalidID;
+	}
+
 	Thread::~Thread() noexcept
 	{
 		Join();
 	}
 
 
+	uint32 Thread::AllocateID() noexcept
+	{
+		return sThreadNum.FetchAdd(1u, MemoryOrder::Relaxed);
+	}
+
+	void Thread::SetCurrentID(uint32 _id) noexcept
+	{
+		sCurrentID = _id;
+	}
+
 	uint32 Thread::GetID() const noexcept
 	{
-		std::thread::id id = mHandle.get_id();
-		return reinterpret_cast<uint32&>(id);
+		return mHandle.joinable() ? mID : InvalidID;
+	}
+
+	uint32 Thread::GetCurrentID() noexcept
+	{
+		// Threads not created by Thread (main, third-party).
+		if (sCurrentID == InvalidID)
+			sCurrentID = AllocateID();
+
+		return sCurrentID;
 	}
 
 	bool Thread::IsRunning() const noexcept
@@ -34,6 +260,59 @@ namespace Sa
 	}
 
 
+	bool Thread::SetName(const char* _name) noexcept
+	{
+		return _name && mHandle.joinable() && SetNativeName(mHandle.native_handle(), _name);
+	}
+
+	bool Thread::SetAffinity(uint64 _coreMask) noexcept
+	{
+		return mHandle.joinable() && SetNativeAffinity(mHandle.native_handle(), _coreMask);
+	}
+
+	bool Thread::SetNumaNode(uint32 _node) noexcept
+	{
+		return SetAffinity(GetNumaNodeCoreMask(_node));
+	}
+
+	bool Thread::SetPriority(ThreadPriority _priority) noexcept
+	{
+		return mHandle.joinable() && SetNativePriority(mHandle.native_handle(), _priority);
+	}
+
+
+	bool Thread::SetCurrentName(const char* _name) noexcept
+	{
+		return _name && SetNativeName(GetCurrentNative(), _name);
+	}
+
+	bool Thread::SetCurrentAffinity(uint64 _coreMask) noexcept
+	{
+		return SetNativeAffinity(GetCurrentNative(), _coreMask);
+	}
+
+	bool Thread::SetCurrentNumaNode(uint32 _node) noexcept
+	{
+		return SetCurrentAffinity(GetNumaNodeCoreMask(_node));
+	}
+
+	bool Thread::SetCurrentPriority(ThreadPriority _priority) noexcept
+	{
+		return SetNativePriority(GetCurrentNative(), _priority);
+	}
+
+	uint32 Thread::GetNumaNodeNum() noexcept
+	{
+		uint32 num = 1u;
+
+		// Count consecutive nodes with cores.
+		while (num < 64u && GetNumaNodeCoreMask(num) != 0u)
+			++num;
+
+		return num;
+	}
+
+
 	uint32 Thread::HardwareConcurrency()
 	{
 		return std::thread::hardware_concurrency();
@@ -43,4 +322,16 @@ namespace Sa
 	{
 		std::this_thread::yield();
 	}
+
+
+	Thread& Thread::operator=(Thread&& _rhs) noexcept
+	{
+		// Same as std::thread: a running thread must be joined or detached first.
+		mHandle = Move(_rhs.mHandle);
+		mID = _rhs.mID;
+
+		_rhs.mID = InvalidID;
+
+		return *this;
+	}
 }
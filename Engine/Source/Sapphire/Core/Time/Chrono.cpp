@@ -8,19 +8,19 @@ namespace Sa
 {
 	void Chrono::Start() noexcept
 	{
-		mStart = Time::Ticks();
+		mStart = Time::NanoSeconds();
 	}
 
 	Tick Chrono::End() noexcept
 	{
-		return (Time::Ticks() - mStart);
+		return Tick::FromNanoSeconds(Time::NanoSeconds() - mStart);
 	}
 
 	Tick Chrono::Restart() noexcept
 	{
-		Tick temp = mStart;
-		mStart = Time::Ticks();
+		const int64 temp = mStart;
+		mStart = Time::NanoSeconds();
 
-		return (mStart - temp);
+		return Tick::FromNanoSeconds(mStart - temp);
 	}
 }
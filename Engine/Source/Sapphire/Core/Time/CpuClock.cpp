@@ -0,0 +1,169 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Time/CpuClock.hpp>
+
+#include <cstdint>
+
+#if SA_x64 && !SA_MSVC
+
+	#include <cpuid.h>
+
+#endif
+
+#include <Core/Time/Time.hpp>
+
+#include <Core/Thread/CpuPause.hpp>
+
+namespace Sa
+{
+	/// \cond Internal
+
+	namespace Internal
+	{
+		/// CPU counter to nanoseconds conversion.
+		struct CpuClockCalibration
+		{
+			/// Cycles of the reference point.
+			uint64 cyclesBase = 0u;
+
+			/// Nanoseconds of the reference point.
+			int64 nsBase = 0;
+
+			/// Nanoseconds per cycle (32.32 fixed point).
+			uint64 nsPerCycle = uint64(1u) << 32;
+
+			/// Cycles per second.
+			uint64 frequency = 1000000000u;
+		};
+
+
+		static bool QueryInvariantTsc() noexcept
+		{
+#if SA_x64
+
+			// CPUID 0x80000007 EDX bit 8: invariant TSC.
+	#if SA_MSVC
+
+			int regs[4]{};
+
+			__cpuid(regs, 0x80000000);
+
+			if (static_cast<unsigned int>(regs[0]) < 0x80000007u)
+				return false;
+
+			__cpuid(regs, 0x80000007);
+
+			return (regs[3] & (1 << 8)) != 0;
+
+	#else
+
+			unsigned int eax = 0u, ebx = 0u, ecx = 0u, edx = 0u;
+
+			if (!__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx))
+				return false;
+
+			return (edx & (1u << 8)) != 0u;
+
+	#endif
+
+#else
+
+			return false;
+
+#endif
+		}
+
+		/// Sample a (cycles, nanoseconds) pair: keep the tightest of a few clock reads.
+		static void SampleReference(uint64& _cycles, int64& _ns) noexcept
+		{
+			int64 bestWindow = INT64_MAX;
+
+			for (uint32 i = 0u; i < 5u; ++i)
+			{
+				const int64 ns0 = Time::NanoSeconds();
+				const uint64 cycles = CpuClock::CyclesSerialized();
+				const int64 ns1 = Time::NanoSeconds();
+
+				if (ns1 - ns0 < bestWindow)
+				{
+					bestWindow = ns1 - ns0;
+					_cycles = cycles;
+					_ns = ns0 + (ns1 - ns0) / 2;
+				}
+			}
+		}
+
+		static CpuClockCalibration Calibrate() noexcept
+		{
+			CpuClockCalibration calib;
+
+			uint64 cyclesBegin = 0u;
+			int64 nsBegin = 0;
+			SampleReference(cyclesBegin, nsBegin);
+
+			while (Time::NanoSeconds() - nsBegin < CpuClock::CalibrationTime)
+				CpuPause();
+
+			uint64 cyclesEnd = 0u;
+			int64 nsEnd = 0;
+			SampleReference(cyclesEnd, nsEnd);
+
+			const uint64 cycles = cyclesEnd - cyclesBegin;
+			const uint64 ns = static_cast<uint64>(nsEnd - nsBegin);
+
+			if (cycles == 0u || ns == 0u)
+				return calib;
+
+			calib.cyclesBase = cyclesEnd;
+			calib.nsBase = nsEnd;
+			calib.nsPerCycle = (ns << 32) / cycles;
+			calib.frequency = cycles * 1000000000u / ns;
+
+			return calib;
+		}
+
+		static const CpuClockCalibration& GetCalibration() noexcept
+		{
+			// Thread-safe lazy calibration.
+			static const CpuClockCalibration calib = Calibrate();
+
+			return calib;
+		}
+	}
+
+	/// \endcond Internal
+
+
+	bool CpuClock::IsSupported() noexcept
+	{
+		static const bool bSupported = Internal::QueryInvariantTsc();
+
+		return bSupported;
+	}
+
+	uint64 CpuClock::GetFrequency() noexcept
+	{
+		return Internal::GetCalibration().frequency;
+	}
+
+	int64 CpuClock::ToNanoSeconds(uint64 _cycles) noexcept
+	{
+		const Internal::CpuClockCalibration& calib = Internal::GetCalibration();
+
+		const int64 delta = static_cast<int64>(_cycles - calib.cyclesBase);
+		const uint64 absDelta = static_cast<uint64>(delta < 0 ? -delta : delta);
+
+		// Split high and low 32 bits: 64-bit fixed-point multiply without overflow.
+		const int64 ns = static_cast<int64>((absDelta >> 32) * calib.nsPerCycle + (((absDelta & 0xFFFFFFFFu) * calib.nsPerCycle) >> 32));
+
+		return delta < 0 ? calib.nsBase - ns : calib.nsBase + ns;
+	}
+
+	int64 CpuClock::NanoSeconds() noexcept
+	{
+		if (!IsSupported())
+			return Time::NanoSeconds();
+
+		return ToNanoSeconds(Cycles());
+	}
+}
@@ -0,0 +1,71 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Core/Time/FrameLimiter.hpp>
+
+#include <Core/Time/Time.hpp>
+
+namespace Sa
+{
+	FrameLimiter::FrameLimiter(float _rate, FrameLimitMode _mode) noexcept : mMode{ _mode }
+	{
+		SetTargetRate(_rate);
+	}
+
+
+	float FrameLimiter::GetTargetRate() const noexcept
+	{
+		return mPeriod ? 1000000000.0f / static_cast<float>(mPeriod) : 0.0f;
+	}
+
+	void FrameLimiter::SetTargetRate(float _rate) noexcept
+	{
+		mPeriod = _rate > 0.0f ? static_cast<int64>(1000000000.0 / static_cast<double>(_rate)) : 0;
+		mNextFrame = 0;
+	}
+
+	FrameLimitMode FrameLimiter::GetMode() const noexcept
+	{
+		return mMode;
+	}
+
+	void FrameLimiter::SetMode(FrameLimitMode _mode) noexcept
+	{
+		mMode = _mode;
+		mNextFrame = 0;
+	}
+
+	void FrameLimiter::SetSpinTime(int64 _spinTime) noexcept
+	{
+		mSpinTime = _spinTime;
+	}
+
+	void FrameLimiter::SetPresentPaced(bool _bPaced) noexcept
+	{
+		mbPresentPaced = _bPaced;
+	}
+
+
+	void FrameLimiter::Wait() noexcept
+	{
+		if (mPeriod == 0 || mMode == FrameLimitMode::None || (mMode == FrameLimitMode::WaitForPresent && mbPresentPaced))
+		{
+			mNextFrame = 0;
+			return;
+		}
+
+		const int64 now = Time::NanoSeconds();
+
+		// First frame or more than a period late: resynchronize.
+		if (mNextFrame == 0 || now - mNextFrame > mPeriod)
+			mNextFrame = now;
+		else
+			Time::SleepUntil(mNextFrame, mSpinTime);
+
+		mNextFrame += mPeriod;
+	}
+
+	void FrameLimiter::Reset() noexcept
+	{
+		mNextFrame = 0;
+	}
+}
@@ -6,55 +6,127 @@
 
 namespace Sa
 {
-	Tick::Tick(float _time) noexcept : mTime{ _time }
+	Tick::Tick(float _time) noexcept : mTime{ static_cast<int64>(static_cast<double>(_time) * ToNanoSeconds) }
 	{
 	}
 
-	Tick::Tick(uint64 _time) noexcept : mTime{ static_cast<float>(_time) }
+	Tick::Tick(uint64 _time) noexcept : mTime{ static_cast<int64>(_time) * ToNanoSeconds }
 	{
 	}
 
 
-	Tick::Tick(MilliSecond _time) noexcept : mTime{ _time.operator Sa::Tick() }
+	Tick::Tick(MilliSecond _time) noexcept : mTime{ _time.operator Sa::Tick().mTime }
 	{
 	}
 
-	Tick::Tick(Second _time) noexcept : mTime{ _time.operator Sa::Tick() }
+	Tick::Tick(Second _time) noexcept : mTime{ _time.operator Sa::Tick().mTime }
 	{
 	}
 
-	Tick::Tick(Minute _time) noexcept : mTime{ _time.operator Sa::Tick() }
+	Tick::Tick(Minute _time) noexcept : mTime{ _time.operator Sa::Tick().mTime }
 	{
 	}
 
-	Tick::Tick(Hour _time) noexcept : mTime{ _time.operator Sa::Tick() }
+	Tick::Tick(Hour _time) noexcept : mTime{ _time.operator Sa::Tick().mTime }
 	{
 	}
 
 
-	Tick::operator float() const noexcept
+	Tick Tick::FromNanoSeconds(int64 _ns) noexcept
+	{
+		Tick result;
+		result.mTime = _ns;
+
+		return result;
+	}
+
+
+	int64 Tick::GetNanoSeconds() const noexcept
 	{
 		return mTime;
 	}
 
+
+	Tick::operator float() const noexcept
+	{
+		// Split to keep precision on large values.
+		return static_cast<float>(mTime / ToNanoSeconds) + static_cast<float>(mTime % ToNanoSeconds) / static_cast<float>(ToNanoSeconds);
+	}
+
 	Tick::operator MilliSecond() const noexcept
 	{
-		return MilliSecond(mTime * ToMilliSeconds);
+		return MilliSecond(static_cast<float>(*this) * ToMilliSeconds);
 	}
 
 	Tick::operator Second() const noexcept
 	{
-		return Second(mTime * ToSeconds);
+		return Second(static_cast<float>(*this) * ToSeconds);
 	}
 
 	Tick::operator Minute() const noexcept
 	{
-		return Second(mTime * ToMinutes);
+		return Minute(static_cast<float>(*this) * ToMinutes);
 	}
 
 	Tick::operator Hour() const noexcept
 	{
-		return Second(mTime * ToHours);
+		return Hour(static_cast<float>(*this) * ToHours);
+	}
+
+
+	Tick Tick::operator+(Tick _rhs) const noexcept
+	{
+		return FromNanoSeconds(mTime + _rhs.mTime);
+	}
+
+	Tick Tick::operator-(Tick _rhs) const noexcept
+	{
+		return FromNanoSeconds(mTime - _rhs.mTime);
+	}
+
+	Tick& Tick::operator+=(Tick _rhs) noexcept
+	{
+		mTime += _rhs.mTime;
+
+		return *this;
+	}
+
+	Tick& Tick::operator-=(Tick _rhs) noexcept
+	{
+		mTime -= _rhs.mTime;
+
+		return *this;
+	}
+
+
+	bool Tick::operator==(Tick _rhs) const noexcept
+	{
+		return mTime == _rhs.mTime;
+	}
+
+	bool Tick::operator!=(Tick _rhs) const noexcept
+	{
+		return mTime != _rhs.mTime;
+	}
+
+	bool Tick::operator<(Tick _rhs) const noexcept
+	{
+		return mTime < _rhs.mTime;
+	}
+
+	bool Tick::operator<=(Tick _rhs) const noexcept
+	{
+		return mTime <= _rhs.mTime;
+	}
+
+	bool Tick::operator>(Tick _rhs) const noexcept
+	{
+		return mTime > _rhs.mTime;
+	}
+
+	bool Tick::operator>=(Tick _rhs) const noexcept
+	{
+		return mTime >= _rhs.mTime;
 	}
 
 
@@ -11,23 +11,69 @@
 
 	#include <Core/Support/Windows.hpp>
 
+	#include <timeapi.h>
+
+	#pragma comment(lib, "Winmm.lib")
+
+	// Windows 10 1803+: missing from older SDKs.
+	#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+		#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+	#endif
+
 #else
 
-	#include <unistd.h>
+	#include <cerrno>
 
 #endif
 
 #include <Core/Debug/Debug.hpp>
 
+#include <Core/Thread/CpuPause.hpp>
+
 
 namespace Sa
 {
 #if SA_WIN
+	/// Hardware counter frequency (counts per second): lazy, NanoSeconds() may be called before sInstance init.
+	static int64 GetHardwareFrequency() noexcept
+	{
+		static const int64 frequency = []()
+		{
+			LARGE_INTEGER value;
+
+			bool bSuccess = QueryPerformanceFrequency(&value); (void)bSuccess;
+			SA_ASSERT(bSuccess, NotSupported, Tools, L"High resolution time stamp not supported!");
+
+			return static_cast<int64>(value.QuadPart);
+		}();
+
+		return frequency;
+	}
+
+	/// Calling thread's high resolution waitable timer (nullptr if unsupported).
+	static HANDLE GetSleepTimer() noexcept
+	{
+		// Per thread: a timer set by two threads would wake only the last deadline.
+		struct SleepTimer
+		{
+			HANDLE handle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+			~SleepTimer()
+			{
+				if (handle)
+					CloseHandle(handle);
+			}
+		};
+
+		static thread_local SleepTimer timer;
+
+		return timer.handle;
+	}
+
 	Time Time::sInstance(Init());
 
 	Time::Time(const TimeInitializer& _initializer) noexcept :
-		mStart{ _initializer.start },
-		mHardwareFrequency{ _initializer.hardwareFrequency }
+		mStart{ _initializer.start }
 	{
 	}
 
@@ -38,19 +84,14 @@ namespace Sa
 		bool bSuccess = QueryPerformanceCounter(&start);
 		SA_ASSERT(bSuccess, NotSupported, Tools, L"High resolution time stamp not supported!");
 
-		LARGE_INTEGER frequency;
-
-		bSuccess = QueryPerformanceFrequency(&frequency);
-		SA_ASSERT(bSuccess, NotSupported, Tools, L"High resolution time stamp not supported!");
-
-		return TimeInitializer{ static_cast<uint64>(start.QuadPart), Second::ToTicks / static_cast<float>(frequency.QuadPart) };
+		return TimeInitializer{ static_cast<uint64>(start.QuadPart) };
 	}
 
 #else
 
 	Time Time::sInstance;
 
-	Time::Time() : mStart{ Ticks() }
+	Time::Time() : mStart{ NanoSeconds() }
 	{
 	}
 
@@ -70,25 +111,52 @@ namespace Sa
 		bool bSuccess = QueryPerformanceCounter(&end); (void)bSuccess;
 		SA_ASSERT(bSuccess, NotSupported, Tools, L"High resolution time stamp not supported!");
 
-		return (end.QuadPart - sInstance.mStart) * sInstance.mHardwareFrequency;
+		const int64 counts = static_cast<int64>(static_cast<uint64>(end.QuadPart) - sInstance.mStart);
+		const int64 freq = GetHardwareFrequency();
+
+		// Split seconds and remainder: no overflow nor precision loss.
+		return Tick::FromNanoSeconds((counts / freq) * 1000000000 + (counts % freq) * 1000000000 / freq);
 
 #else
 
-		struct timespec end;
+		return Tick::FromNanoSeconds(NanoSeconds() - sInstance.mStart);
 
-		int bSuccess = clock_gettime(CLOCK_MONOTONIC, &end) == 0; (void)bSuccess;
-		SA_ASSERT(bSuccess, NotSupported, Tools, L"High resolution time stamp not supported!");
+#endif
+	}
+
+	int64 Time::NanoSeconds() noexcept
+	{
+#if SA_WIN
+
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
 
+		const int64 counts = static_cast<int64>(counter.QuadPart);
+		const int64 freq = GetHardwareFrequency();
 
-		return (end.tv_sec * Second::ToTicks + end.tv_nsec / 1000.0f) - sInstance.mStart;
+		return (counts / freq) * 1000000000 + (counts % freq) * 1000000000 / freq;
+
+#else
+
+		struct timespec now;
+
+		// Never fails with a valid clock id.
+		clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+
+		return static_cast<int64>(now.tv_sec) * 1000000000 + static_cast<int64>(now.tv_nsec);
 
 #endif
 	}
 
 	DateTime Time::Date() noexcept
+	{
+		return Date(Timestamp());
+	}
+
+	DateTime Time::Date(uint64 _timestamp) noexcept
 	{
 		tm qTime; // Queried time.
-		const time_t currTime = time(nullptr);
+		const time_t currTime = static_cast<time_t>(_timestamp);
 
 #if SA_WIN
 		localtime_s(&qTime, &currTime);
@@ -131,6 +199,11 @@ namespace Sa
 		};
 	}
 
+	uint64 Time::Timestamp() noexcept
+	{
+		return static_cast<uint64>(time(nullptr));
+	}
+
 	uint64 Time::Seed() noexcept
 	{
 		return time(nullptr);
@@ -138,10 +211,60 @@ namespace Sa
 
 	void Time::Sleep(MilliSecond _ms) noexcept
 	{
+		// No spin: generic sleeps (ex: background threads) must not burn CPU for precision.
+		SleepUntil(NanoSeconds() + static_cast<int64>(static_cast<double>(static_cast<float>(_ms)) * 1000000.0), 0);
+	}
+
+	void Time::SleepUntil(int64 _deadline, int64 _spinTime) noexcept
+	{
+		const int64 remaining = _deadline - NanoSeconds();
+
+		if (remaining > _spinTime)
+		{
 #if SA_WIN
-		::Sleep(static_cast<uint32>(_ms));
+
+			const int64 sleepTime = remaining - _spinTime;
+
+			if (HANDLE timer = GetSleepTimer())
+			{
+				// Relative due time (negative, in 100 nanoseconds): floor, the rest is spinned.
+				LARGE_INTEGER dueTime;
+				dueTime.QuadPart = -(sleepTime / 100);
+
+				if (SetWaitableTimerEx(timer, &dueTime, 0, nullptr, nullptr, nullptr, 0))
+					WaitForSingleObject(timer, INFINITE);
+			}
+			else
+			{
+				// Default ~15.6 ms scheduler tick: raise the resolution during the sleep.
+				timeBeginPeriod(1u);
+
+				::Sleep(static_cast<DWORD>(sleepTime / 1000000));
+
+				timeEndPeriod(1u);
+			}
+
 #else
-		usleep(Tick(_ms));
+
+			// clock_nanosleep can't use CLOCK_MONOTONIC_RAW: convert the deadline to CLOCK_MONOTONIC.
+			struct timespec now;
+			clock_gettime(CLOCK_MONOTONIC, &now);
+
+			const int64 wakeUp = static_cast<int64>(now.tv_sec) * 1000000000 + static_cast<int64>(now.tv_nsec) + remaining - _spinTime;
+
+			struct timespec target;
+			target.tv_sec = static_cast<time_t>(wakeUp / 1000000000);
+			target.tv_nsec = static_cast<long>(wakeUp % 1000000000);
+
+			// Absolute: resume on signal interruption without accumulating error.
+			while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR)
+			{
+			}
+
 #endif
+		}
+
+		while (NanoSeconds() < _deadline)
+			CpuPause();
 	}
 }
@@ -15,6 +15,7 @@ namespace Sa
 		// === Main Subpass ===
 		{
 			SubPassDescriptor& mainSubpassDesc = result.subPassDescs.emplace_back();
+			mainSubpassDesc.name = "Forward";
 			mainSubpassDesc.sampling = SampleBits::Sample8Bits;
 
 			mainSubpassDesc.attachmentDescs.reserve(2u);
@@ -42,6 +43,7 @@ namespace Sa
 		// === PBR Subpass ===
 		{
 			SubPassDescriptor& pbrSubpassDesc = result.subPassDescs.emplace_back();
+			pbrSubpassDesc.name = "GBuffer";
 			pbrSubpassDesc.sampling = SampleBits::Sample8Bits;
 
 			// Deferred position attachment.
@@ -72,6 +74,7 @@ namespace Sa
 		// === Present Subpass ===
 		{
 			SubPassDescriptor& presentSubpassDesc = result.subPassDescs.emplace_back();
+			presentSubpassDesc.name = "LitComposition";
 			presentSubpassDesc.sampling = SampleBits::Sample8Bits;
 
 			SubPassAttachmentDescriptor& presentAttachDesc = presentSubpassDesc.attachmentDescs.emplace_back();
@@ -2,6 +2,8 @@
 
 #include <Rendering/Vulkan/Buffers/VkBuffer.hpp>
 
+#include <Core/Algorithms/MemStream.hpp>
+
 #include <Rendering/Vulkan/System/VkMacro.hpp>
 #include <Rendering/Vulkan/System/Device/VkDevice.hpp>
 
@@ -68,7 +70,8 @@ namespace Sa::Vk
 			void* deviceData;
 			vkMapMemory(_device, mDeviceMemory, 0, _size, 0, &deviceData);
 
-			std::memcpy(deviceData, _data, _size);
+			// Mapped host visible memory may be write-combined: stream without polluting caches.
+			MemStreamCopy(_data, deviceData, _size);
 
 			vkUnmapMemory(_device, mDeviceMemory);
 		}
@@ -124,7 +127,7 @@ namespace Sa::Vk
 
 		vkMapMemory(_device, mDeviceMemory, _offset, _size, 0, &bufferData);
 
-		std::memcpy(bufferData, _data, _size);
+		MemStreamCopy(_data, bufferData, _size);
 
 		vkUnmapMemory(_device, mDeviceMemory);
 	}
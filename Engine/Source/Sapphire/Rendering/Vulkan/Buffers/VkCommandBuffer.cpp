@@ -3,6 +3,8 @@
 #include <Rendering/Vulkan/Buffers/VkCommandBuffer.hpp>
 
 #include <Core/Algorithms/SizeOf.hpp>
+#include <Core/Memory/ScratchArena.hpp>
+#include <Core/Memory/ArenaAllocator.hpp>
 
 #include <Rendering/Vulkan/System/VkMacro.hpp>
 #include <Rendering/Vulkan/System/Device/VkDevice.hpp>
@@ -48,8 +50,8 @@ namespace Sa::Vk
 		std::vector<CommandBuffer> result;
 		result.resize(_num, CommandBuffer(_poolIndex, _queueType));
 
-		std::vector<VkCommandBuffer> vkCommandBuffers;
-		vkCommandBuffers.resize(_num);
+		ScratchScope scratch;
+		ScratchVector<VkCommandBuffer> vkCommandBuffers(_num, ScratchScope::GetArena());
 
 		VkCommandBufferAllocateInfo commandBufferAllocInfo{};
 		commandBufferAllocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
@@ -81,8 +83,8 @@ namespace Sa::Vk
 	{
 		const uint32 num = SizeOf(_buffers);
 
-		std::vector<VkCommandBuffer> vkCommandBuffers;
-		vkCommandBuffers.resize(num);
+		ScratchScope scratch;
+		ScratchVector<VkCommandBuffer> vkCommandBuffers(num, ScratchScope::GetArena());
 
 		for (uint32 i = 0; i < num; ++i)
 		{
@@ -131,6 +133,7 @@ namespace Sa::Vk
 		VkQueue vkQueue = _device.queueMgr.GetQueueFromType(_commandBuffer.mQueueType).GetHandle(_commandBuffer.GetPoolIndex());
 
 		vkQueueSubmit(vkQueue, 1, &submitInfo, VK_NULL_HANDLE);
+		FlightRecorder::RecordGpuSubmit("SingleTimeCommands");
 		vkQueueWaitIdle(vkQueue);
 
 
@@ -5,6 +5,7 @@
 #include <Core/Algorithms/SizeOf.hpp>
 
 #include <Rendering/Vulkan/System/VkMacro.hpp>
+#include <Rendering/Vulkan/System/VkGpuProfiler.hpp>
 #include <Rendering/Vulkan/System/VkRenderPass.hpp>
 #include <Rendering/Vulkan/System/Device/VkDevice.hpp>
 
@@ -30,6 +31,8 @@ namespace Sa::Vk
 
 		for (auto subIt = _rpDescriptor.subPassDescs.begin(); subIt != _rpDescriptor.subPassDescs.end(); ++subIt)
 		{
+			mSubpassNames.push_back(subIt->name);
+
 			for (auto attIt = subIt->attachmentDescs.begin(); attIt != subIt->attachmentDescs.end(); ++attIt)
 			{
 				imageInfos.format = attIt->format;
@@ -120,6 +123,8 @@ namespace Sa::Vk
 			it->Destroy(_device);
 
 		mInputAttachments.clear();
+
+		mSubpassNames.clear();
 	}
 
 	void FrameBuffer::Begin()
@@ -136,6 +141,10 @@ namespace Sa::Vk
 		SA_VK_ASSERT(vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo),
 			LibCommandFailed, Rendering, L"Failed to begin command buffer!");
 
+		// Query reset must be recorded outside of the render pass.
+		if (mGpuProfiler)
+			mGpuProfiler->BeginCommands(commandBuffer);
+
 
 		// === Start RenderPass record ===
 		VkRenderPassBeginInfo renderPassBeginInfo{};
@@ -148,16 +157,26 @@ namespace Sa::Vk
 		renderPassBeginInfo.pClearValues = mClearValues.data();
 
 		vkCmdBeginRenderPass(commandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+
+		mSubpassIndex = 0u;
+		BeginGpuScope(mSubpassNames[mSubpassIndex]);
 	}
 
 	void FrameBuffer::NextSubpass()
 	{
+		EndGpuScope();
+
 		vkCmdNextSubpass(commandBuffer, VK_SUBPASS_CONTENTS_INLINE);
+
+		++mSubpassIndex;
+		BeginGpuScope(mSubpassIndex < mSubpassNames.size() ? mSubpassNames[mSubpassIndex] : "Subpass");
 	}
 
 	void FrameBuffer::End()
 	{
 		// === End RenderPass record ===
+		EndGpuScope();
+
 		vkCmdEndRenderPass(commandBuffer);
 
 
@@ -167,6 +186,24 @@ namespace Sa::Vk
 	}
 
 
+	void FrameBuffer::BeginGpuScope(const char* _name)
+	{
+		if (mGpuProfiler)
+			mGpuProfiler->BeginScope(commandBuffer, _name);
+	}
+
+	void FrameBuffer::EndGpuScope()
+	{
+		if (mGpuProfiler)
+			mGpuProfiler->EndScope(commandBuffer);
+	}
+
+	void FrameBuffer::SetGpuProfiler(GpuProfiler* _profiler) noexcept
+	{
+		mGpuProfiler = _profiler;
+	}
+
+
 	void FrameBuffer::AddClearColor(Format _format, const Color& _clearColor)
 	{
 		if (IsDepthFormat(_format))
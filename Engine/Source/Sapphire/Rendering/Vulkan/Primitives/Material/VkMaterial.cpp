@@ -3,7 +3,10 @@
 #include <Rendering/Vulkan/Primitives/Material/VkMaterial.hpp>
 
 #include <Core/Algorithms/SizeOf.hpp>
+#include <Core/Debug/Profiler.hpp>
 #include <Core/Types/Variadics/Pair.hpp>
+#include <Core/Memory/ScratchArena.hpp>
+#include <Core/Containers/FixedVector.hpp>
 
 #include <Rendering/Vulkan/System/VkRenderInstance.hpp>
 
@@ -34,6 +37,8 @@ namespace Sa::Vk
 
 	void Material::Bind(const RenderFrame& _frame, const IPipeline& _pipeline)
 	{
+		SA_PROFILE_SCOPE("Material::Bind");
+
 		Vk::CommandBuffer& commandBuffer = _frame.buffer.As<Vk::FrameBuffer>().commandBuffer;
 
 		const Pipeline& vkPipeline = _pipeline.As<Pipeline>();
@@ -45,8 +50,7 @@ namespace Sa::Vk
 
 	void Material::CreateDescriptorPool(const Device& _device, const MaterialCreateInfos& _infos)
 	{
-		std::vector<VkDescriptorPoolSize> poolSizes;
-		poolSizes.resize(4u);
+		FixedVector<VkDescriptorPoolSize, 4u> poolSizes(4u);
 
 		poolSizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
 		poolSizes[1].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
@@ -72,7 +76,7 @@ namespace Sa::Vk
 		{
 			if (poolSizes[i].descriptorCount == 0)
 			{
-				poolSizes.erase(poolSizes.begin() + i);
+				poolSizes.Erase(i);
 				--i;
 			}
 		}
@@ -83,7 +87,7 @@ namespace Sa::Vk
 		descriptorPoolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
 		descriptorPoolInfo.maxSets = _infos.descriptorSetNum;
 		descriptorPoolInfo.poolSizeCount = SizeOf(poolSizes);
-		descriptorPoolInfo.pPoolSizes = poolSizes.data();
+		descriptorPoolInfo.pPoolSizes = poolSizes.Data();
 
 		SA_VK_ASSERT(vkCreateDescriptorPool(_device, &descriptorPoolInfo, nullptr, &mDescriptorPool),
 			CreationFailed, Rendering, L"Failed to create descriptor pool!");
@@ -101,7 +105,9 @@ namespace Sa::Vk
 		const Pipeline& vkPipeline = _infos.pipeline.As<Pipeline>();
 
 		mDescriptorSets.resize(_infos.descriptorSetNum);
-		std::vector<VkDescriptorSetLayout> descriptorSetLayouts(_infos.descriptorSetNum, vkPipeline.GetDescriptorSetLayout());
+
+		ScratchScope scratch;
+		ScratchVector<VkDescriptorSetLayout> descriptorSetLayouts(_infos.descriptorSetNum, vkPipeline.GetDescriptorSetLayout(), ScratchScope::GetArena());
 
 		VkDescriptorSetAllocateInfo descriptorSetAllocInfo{};
 		descriptorSetAllocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
@@ -126,14 +132,16 @@ namespace Sa::Vk
 		for (auto it = _bindings.begin(); it != _bindings.end(); ++it)
 			CountDescriptors(*it, bufferDescSize, imageDescSize);
 
-		// Allocate.
-		std::vector<VkDescriptorBufferInfo> bufferDescs;
+		// Allocate (scratch: pointer bump only).
+		ScratchScope scratch;
+
+		ScratchVector<VkDescriptorBufferInfo> bufferDescs(ScratchScope::GetArena());
 		bufferDescs.reserve(bufferDescSize);
 
-		std::vector<VkDescriptorImageInfo> imageDescs;
+		ScratchVector<VkDescriptorImageInfo> imageDescs(ScratchScope::GetArena());
 		imageDescs.reserve(imageDescSize);
 
-		std::vector<VkWriteDescriptorSet> descWrites;
+		ScratchVector<VkWriteDescriptorSet> descWrites(ScratchScope::GetArena());
 		descWrites.reserve(bufferDescSize + imageDescSize);
 
 		for (auto it = _bindings.begin(); it != _bindings.end(); ++it)
@@ -160,9 +168,9 @@ namespace Sa::Vk
 	}
 
 	void Material::FillDescriptorWrites(const MaterialBindingInfos& _binding,
-		std::vector<VkDescriptorBufferInfo>& _bufferDescs,
-		std::vector<VkDescriptorImageInfo>& _imageDescs,
-		std::vector<VkWriteDescriptorSet>& _descWrites,
+		ScratchVector<VkDescriptorBufferInfo>& _bufferDescs,
+		ScratchVector<VkDescriptorImageInfo>& _imageDescs,
+		ScratchVector<VkWriteDescriptorSet>& _descWrites,
 		uint32 _descIndex) const noexcept
 	{
 		// Selected descriptor index.
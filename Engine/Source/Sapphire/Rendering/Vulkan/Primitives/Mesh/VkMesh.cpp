@@ -3,6 +3,7 @@
 #include <Rendering/Vulkan/Primitives/Mesh/VkMesh.hpp>
 
 #include <Core/Algorithms/SizeOf.hpp>
+#include <Core/Debug/Profiler.hpp>
 
 #include <Rendering/Vulkan/System/VkRenderInstance.hpp>
 #include <Rendering/Vulkan/Buffers/VkFrameBuffer.hpp>
@@ -45,6 +46,8 @@ namespace Sa::Vk
 
 	void Mesh::Draw(const RenderFrame& _frame, const MeshDrawInfos& _infos) const
 	{
+		SA_PROFILE_SCOPE("Mesh::Draw");
+
 		const CommandBuffer& commandBuffer = _frame.buffer.As<FrameBuffer>().commandBuffer;
 
 		VkDeviceSize offsets[] = { 0 };
@@ -3,6 +3,7 @@
 #include <Rendering/Vulkan/Primitives/Pipeline/VkPipeline.hpp>
 
 #include <Core/Algorithms/SizeOf.hpp>
+#include <Core/Memory/ScratchArena.hpp>
 
 #include <Rendering/Vulkan/System/VkRenderPass.hpp>
 #include <Rendering/Vulkan/System/VkRenderInstance.hpp>
@@ -16,7 +17,7 @@ namespace Sa::Vk
 		VkPipelineMultisampleStateCreateInfo multisamplingInfos{};
 		VkPipelineDepthStencilStateCreateInfo depthStencilInfo{};
 
-		std::vector<VkPipelineColorBlendAttachmentState> colorBlendAttachments;
+		ScratchVector<VkPipelineColorBlendAttachmentState> colorBlendAttachments{ ScratchScope::GetArena() };
 		VkPipelineColorBlendStateCreateInfo colorBlendingInfo{};
 	};
 
@@ -56,7 +57,8 @@ namespace Sa::Vk
 	void Pipeline::CreateDescriptorSetLayout(const Device& _device, const PipelineCreateInfos& _infos)
 	{
 		// Fill descriptor set layout bindings.
-		std::vector<VkDescriptorSetLayoutBinding> layoutBindings;
+		ScratchScope scratch;
+		ScratchVector<VkDescriptorSetLayoutBinding> layoutBindings(ScratchScope::GetArena());
 		layoutBindings.reserve(_infos.bindings.size());
 
 		for (auto it = _infos.bindings.begin(); it != _infos.bindings.end(); ++it)
@@ -115,7 +117,10 @@ namespace Sa::Vk
 
 	void Pipeline::CreatePipelineHandle(const Device& _device, const PipelineCreateInfos& _infos)
 	{
-		std::vector<VkPipelineShaderStageCreateInfo> shaderStages;
+		// Temporary create infos (scratch: pointer bump only).
+		ScratchScope scratch;
+
+		ScratchVector<VkPipelineShaderStageCreateInfo> shaderStages(ScratchScope::GetArena());
 		FillShaderStages(shaderStages, _infos.shaders);
 
 
@@ -210,7 +215,7 @@ namespace Sa::Vk
 	}
 
 
-	void Pipeline::FillShaderStages(std::vector<VkPipelineShaderStageCreateInfo>& _stages, const std::vector<PipelineShaderInfos>& _shaders)
+	void Pipeline::FillShaderStages(ScratchVector<VkPipelineShaderStageCreateInfo>& _stages, const std::vector<PipelineShaderInfos>& _shaders)
 	{
 		_stages.reserve(_shaders.size());
 
@@ -4,6 +4,7 @@
 
 #include <Collections/Debug>
 #include <Core/Algorithms/SizeOf.hpp>
+#include <Core/Containers/SmallVector.hpp>
 
 #include <Rendering/Vulkan/System/VkRenderInstance.hpp>
 #include <Rendering/Vulkan/System/Surface/VkRenderSurface.hpp>
@@ -12,7 +13,7 @@
 
 namespace Sa::Vk
 {
-	std::vector<const char*> GetRequiredExtensions(QueueType _families)
+	SmallVector<const char*, 4u> GetRequiredExtensions(QueueType _families)
 	{
 		// Present requiered extensions.
 		static constexpr const char* presentRequieredExtensions[] =
@@ -21,10 +22,10 @@ namespace Sa::Vk
 		};
 
 
-		std::vector<const char*> result;
+		SmallVector<const char*, 4u> result;
 
 		if (static_cast<uint8>(_families) & static_cast<uint8>(QueueType::Present))
-			result.insert(result.end(), presentRequieredExtensions, presentRequieredExtensions + SizeOf(presentRequieredExtensions));
+			result.Append(presentRequieredExtensions, SizeOf(presentRequieredExtensions));
 
 		return result;
 	}
@@ -37,7 +38,7 @@ namespace Sa::Vk
 		std::vector<VkExtensionProperties> availableExtensions(extensionCount);
 		vkEnumerateDeviceExtensionProperties(_device, nullptr, &extensionCount, availableExtensions.data());
 
-		std::vector<const char*> requieredExtensions = GetRequiredExtensions(_families);
+		SmallVector<const char*, 4u> requieredExtensions = GetRequiredExtensions(_families);
 
 		// Check each asked supported.
 		for (uint32 i = 0; i < SizeOf(requieredExtensions); ++i)
@@ -121,7 +122,7 @@ namespace Sa::Vk
 		physicalDeviceFeatures.sampleRateShading = VK_TRUE;
 		physicalDeviceFeatures.samplerAnisotropy = VK_TRUE;
 
-		std::vector<const char*> extensions = GetRequiredExtensions(_infos.familyTypes);
+		SmallVector<const char*, 4u> extensions = GetRequiredExtensions(_infos.familyTypes);
 		std::vector<VkDeviceQueueCreateInfo> queueCreateInfos = _infos.GetDeviceCreateInfos();
 
 		// TODO: Implement.
@@ -137,7 +138,7 @@ namespace Sa::Vk
 		deviceCreateInfo.enabledLayerCount = 0u;
 		deviceCreateInfo.ppEnabledLayerNames = nullptr;
 		deviceCreateInfo.enabledExtensionCount = SizeOf(extensions);
-		deviceCreateInfo.ppEnabledExtensionNames = extensions.data();
+		deviceCreateInfo.ppEnabledExtensionNames = extensions.Data();
 		deviceCreateInfo.pEnabledFeatures = &physicalDeviceFeatures;
 
 #if SA_VK_VALIDATION_LAYERS
@@ -17,6 +17,11 @@ namespace Sa::Vk
 		return mSwapChain.GetFormat();
 	}
 
+	bool RenderSurface::IsPresentPaced() const noexcept
+	{
+		return mSwapChain.IsPresentPaced();
+	}
+
 
 	void RenderSurface::Create(const IRenderInstance& _instance)
 	{
@@ -3,6 +3,10 @@
 #include <Rendering/Vulkan/System/Surface/VkSwapChain.hpp>
 
 #include <Core/Algorithms/SizeOf.hpp>
+#include <Core/Debug/Profiler.hpp>
+#include <Core/Debug/FrameStats.hpp>
+
+#include <Core/Time/Time.hpp>
 
 #include <Rendering/Vulkan/System/VkMacro.hpp>
 #include <Rendering/Vulkan/System/Device/VkDevice.hpp>
@@ -15,6 +19,11 @@ namespace Sa::Vk
 		return mFormat;
 	}
 
+	bool SwapChain::IsPresentPaced() const noexcept
+	{
+		return mPresentMode == VK_PRESENT_MODE_FIFO_KHR || mPresentMode == VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+	}
+
 	void SwapChain::CreateSwapChainKHR(const Device& _device, const RenderSurface& _surface)
 	{
 		// Query infos.
@@ -24,6 +33,7 @@ namespace Sa::Vk
 		mExtent = RenderSurface::ChooseSwapExtent(details);
 
 		mFormat = API_FromFormat(surfaceFormat.format);
+		mPresentMode = presentMode;
 
 		// Min image count to avoid driver blocking.
 		mImageNum = details.capabilities.minImageCount + 1;
@@ -117,39 +127,90 @@ namespace Sa::Vk
 		mFramesSynch.clear();
 	}
 
+	void SwapChain::RecordGpuLatency(Synchronisation& _synch, int64 _now)
+	{
+		if (_synch.submitTime == 0)
+			return;
+
+		FrameStats::Record(FrameStat::GpuLatency, _now - _synch.submitTime);
+		_synch.submitTime = 0;
+	}
+
+	void SwapChain::PollGpuLatencies(const Device& _device)
+	{
+		// Non-blocking: observe fences signaled since the last poll (includes the delay until the poll).
+		for (auto it = mFramesSynch.begin(); it != mFramesSynch.end(); ++it)
+		{
+			if (it->submitTime != 0 && vkGetFenceStatus(_device, it->fence) == VK_SUCCESS)
+				RecordGpuLatency(*it, Time::NanoSeconds());
+		}
+	}
+
 	void SwapChain::Create(const Device& _device, const RenderSurface& _surface)
 	{
 		CreateSwapChainKHR(_device, _surface);
 		CreateSynchronisation(_device);
+
+		mFrameArena.Create(FrameArenaCapacity, mImageNum < FrameArena::MaxBufferNum ? mImageNum : FrameArena::MaxBufferNum);
+
+#if SA_PROFILING
+		mGpuProfiler.Create(_device, mImageNum);
+#endif
 	}
 
 	void SwapChain::Destroy(const Device& _device)
 	{
 		DestroyFrameBuffers(_device);
 
+		mGpuProfiler.Destroy(_device);
+
+		mFrameArena.Destroy();
+
 		DestroySynchronisation(_device);
 		DestroySwapChainKHR(_device);
 	}
 
 	RenderFrame SwapChain::Begin(const Device& _device)
 	{
+		SA_PROFILE_FRAME();
+		SA_PROFILE_SCOPE("SwapChain::Begin");
+
+		FlightRecorder::RecordFrame();
+		FrameStats::NewFrame();
+
 		// Wait current Fence.
+		const int64 fenceBegin = Time::NanoSeconds();
+
 		vkWaitForFences(_device, 1, &mFramesSynch[mFrameIndex].fence, true, UINT64_MAX);
 
+		const int64 fenceEnd = Time::NanoSeconds();
+		FrameStats::Record(FrameStat::FenceWait, fenceEnd - fenceBegin);
+		RecordGpuLatency(mFramesSynch[mFrameIndex], fenceEnd);
+
 		// Reset current Fence.
 		vkResetFences(_device, 1, &mFramesSynch[mFrameIndex].fence);
 
+		// Previous use of the frame is over: recycle its temporary allocations and read back its GPU timestamps.
+		mFrameArena.BeginFrame();
+		mGpuProfiler.NewFrame(_device, mFrameIndex);
+
+		const int64 acquireBegin = Time::NanoSeconds();
+
 		SA_VK_ASSERT(vkAcquireNextImageKHR(_device, mHandle, UINT64_MAX, mFramesSynch[mFrameIndex].acquireSemaphore, VK_NULL_HANDLE, &mImageIndex),
 			LibCommandFailed, Rendering, L"Failed to aquire next image!");
 
+		FrameStats::Record(FrameStat::AcquireWait, Time::NanoSeconds() - acquireBegin);
+
 
 		mFrameBuffers[mFrameIndex]->Begin();
 
-		return RenderFrame{ mFrameIndex, *mFrameBuffers[mFrameIndex] };
+		return RenderFrame{ mFrameIndex, *mFrameBuffers[mFrameIndex], mFrameArena };
 	}
 	
 	void SwapChain::End(const Device& _device)
 	{
+		SA_PROFILE_SCOPE("SwapChain::End");
+
 		mFrameBuffers[mFrameIndex]->End();
 
 
@@ -170,6 +231,11 @@ namespace Sa::Vk
 		SA_VK_ASSERT(vkQueueSubmit(_device.queueMgr.graphics.GetHandle(mFrameIndex), 1, &submitInfo, mFramesSynch[mFrameIndex].fence),
 			LibCommandFailed, Rendering, L"Failed to submit graphics queue!");
 
+		FlightRecorder::RecordGpuSubmit("Graphics");
+
+		mFramesSynch[mFrameIndex].submitTime = Time::NanoSeconds();
+		PollGpuLatencies(_device);
+
 
 		// Submit present.
 		VkPresentInfoKHR presentInfo{};
@@ -197,11 +263,15 @@ namespace Sa::Vk
 		vkGetSwapchainImagesKHR(_device, mHandle, &mImageNum, swapChainImages.data());
 
 		mFrameBuffers.reserve(mImageNum);
+		mFrameBufferPool.Reserve(mImageNum);
 
 		for (uint32 i = 0u; i < mImageNum; ++i)
 		{
-			FrameBuffer* frameBuffer = mFrameBuffers.emplace_back(new FrameBuffer());
+			FrameBuffer* frameBuffer = mFrameBuffers.emplace_back(mFrameBufferPool.New());
 			frameBuffer->Create(_device, _renderPass, _renderPassDesc, mExtent, i, swapChainImages[i]);
+
+			if (mGpuProfiler.IsSupported())
+				frameBuffer->SetGpuProfiler(&mGpuProfiler);
 		}
 
 		if (_size)
@@ -215,7 +285,7 @@ namespace Sa::Vk
 		for (auto it = mFrameBuffers.begin(); it != mFrameBuffers.end(); ++it)
 		{
 			(*it)->Destroy(_device);
-			delete* it;
+			mFrameBufferPool.Delete(*it);
 		}
 
 		mFrameBuffers.clear();
@@ -0,0 +1,200 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include <Rendering/Vulkan/System/VkGpuProfiler.hpp>
+
+#include <Core/Debug/Profiler.hpp>
+
+#include <Rendering/Vulkan/System/VkMacro.hpp>
+#include <Rendering/Vulkan/System/Device/VkDevice.hpp>
+#include <Rendering/Vulkan/Buffers/VkCommandBuffer.hpp>
+
+#if SA_RENDERING_API == SA_VULKAN
+
+namespace Sa::Vk
+{
+	bool GpuProfiler::IsSupported() const noexcept
+	{
+		return mbSupported;
+	}
+
+	void GpuProfiler::Create(const Device& _device, uint32 _frameNum)
+	{
+		// Query timestamp support of the graphics queue.
+		VkPhysicalDeviceProperties properties{};
+		vkGetPhysicalDeviceProperties(_device, &properties);
+
+		uint32 familyNum = 0u;
+		vkGetPhysicalDeviceQueueFamilyProperties(_device, &familyNum, nullptr);
+
+		std::vector<VkQueueFamilyProperties> families(familyNum);
+		vkGetPhysicalDeviceQueueFamilyProperties(_device, &familyNum, families.data());
+
+		const uint32 graphicsFamily = _device.queueMgr.graphics.GetFamilyIndex();
+		const uint32 validBits = graphicsFamily < familyNum ? families[graphicsFamily].timestampValidBits : 0u;
+
+		mbSupported = validBits != 0u && properties.limits.timestampPeriod > 0.0f;
+
+		if (!mbSupported)
+		{
+			SA_LOG("GPU timestamps not supported by the graphics queue: GPU profiling disabled.", Warning, Rendering);
+			return;
+		}
+
+		mTimestampPeriod = static_cast<double>(properties.limits.timestampPeriod);
+		mTimestampMask = validBits >= 64u ? ~uint64() : (uint64(1u) << validBits) - 1u;
+
+
+		// Create query pools.
+		VkQueryPoolCreateInfo queryPoolCreateInfo{};
+		queryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		queryPoolCreateInfo.pNext = nullptr;
+		queryPoolCreateInfo.flags = 0u;
+		queryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		queryPoolCreateInfo.queryCount = MaxScopeNum * 2u;
+		queryPoolCreateInfo.pipelineStatistics = 0u;
+
+		mFrames.resize(_frameNum);
+
+		for (auto it = mFrames.begin(); it != mFrames.end(); ++it)
+		{
+			SA_VK_ASSERT(vkCreateQueryPool(_device, &queryPoolCreateInfo, nullptr, &it->pool),
+				CreationFailed, Rendering, L"Failed to create query pool!");
+
+			it->scopes.reserve(MaxScopeNum);
+		}
+
+		mOpenScopes.reserve(MaxScopeNum);
+		mResults.resize(MaxScopeNum * 2u);
+
+		Calibrate(_device);
+
+		mTrack = Profiler::CreateTrack("GPU");
+	}
+
+	void GpuProfiler::Destroy(const Device& _device)
+	{
+		for (auto it = mFrames.begin(); it != mFrames.end(); ++it)
+			vkDestroyQueryPool(_device, it->pool, nullptr);
+
+		mFrames.clear();
+		mOpenScopes.clear();
+
+		Profiler::DestroyTrack(mTrack);
+		mTrack = Profiler::NoTrack;
+
+		mbSupported = false;
+	}
+
+	void GpuProfiler::Calibrate(const Device& _device)
+	{
+		// Blocking: write a single timestamp and match it with the CPU time around the submit.
+		const VkQueryPool pool = mFrames[0].pool;
+
+		CommandBuffer commandBuffer = CommandBuffer::BeginSingleTimeCommands(_device, QueueType::Graphics);
+
+		vkCmdResetQueryPool(commandBuffer, pool, 0u, 1u);
+		vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, pool, 0u);
+
+		const uint64 cpuBegin = Profiler::GetTime();
+
+		CommandBuffer::EndSingleTimeCommands(_device, commandBuffer);
+
+		const uint64 cpuEnd = Profiler::GetTime();
+
+		uint64 gpuTicks = 0u;
+
+		SA_VK_ASSERT(vkGetQueryPoolResults(_device, pool, 0u, 1u, sizeof(uint64), &gpuTicks, sizeof(uint64),
+			VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT), LibCommandFailed, Rendering, L"Failed to get query pool results!");
+
+		mGpuReference = gpuTicks & mTimestampMask;
+		mCpuReference = cpuBegin + (cpuEnd - cpuBegin) / 2u;
+	}
+
+	uint64 GpuProfiler::ToProfilerTime(uint64 _ticks) const noexcept
+	{
+		const uint64 delta = (_ticks - mGpuReference) & mTimestampMask;
+
+		return mCpuReference + static_cast<uint64>(static_cast<double>(delta) * mTimestampPeriod);
+	}
+
+	void GpuProfiler::NewFrame(const Device& _device, uint32 _frameIndex)
+	{
+		if (!mbSupported)
+			return;
+
+		SA_ASSERT(_frameIndex < mFrames.size(), OutOfRange, Rendering, _frameIndex, 0u, static_cast<uint32>(mFrames.size()));
+
+		mFrameIndex = _frameIndex;
+		mOpenScopes.clear();
+
+		FrameQueries& frame = mFrames[_frameIndex];
+
+		if (frame.scopes.empty())
+			return;
+
+		const uint32 queryNum = static_cast<uint32>(frame.scopes.size()) * 2u;
+
+		// No wait bit: never block (VK_NOT_READY drops the frame).
+		const VkResult result = vkGetQueryPoolResults(_device, frame.pool, 0u, queryNum, queryNum * sizeof(uint64),
+			mResults.data(), sizeof(uint64), VK_QUERY_RESULT_64_BIT);
+
+		if (result == VK_SUCCESS)
+		{
+			for (uint32 i = 0u; i < frame.scopes.size(); ++i)
+			{
+				const Scope& scope = frame.scopes[i];
+
+				Profiler::PushTrackZone(mTrack, scope.name,
+					ToProfilerTime(mResults[2u * i]), ToProfilerTime(mResults[2u * i + 1u]), scope.depth);
+			}
+		}
+
+		frame.scopes.clear();
+	}
+
+	void GpuProfiler::BeginCommands(const CommandBuffer& _commandBuffer)
+	{
+		if (!mbSupported)
+			return;
+
+		vkCmdResetQueryPool(_commandBuffer, mFrames[mFrameIndex].pool, 0u, MaxScopeNum * 2u);
+	}
+
+	void GpuProfiler::BeginScope(const CommandBuffer& _commandBuffer, const char* _name)
+	{
+		if (!mbSupported)
+			return;
+
+		FrameQueries& frame = mFrames[mFrameIndex];
+
+		// Too many scopes: drop (keep begin / end pairing).
+		if (frame.scopes.size() >= MaxScopeNum)
+		{
+			mOpenScopes.push_back(~uint32());
+			return;
+		}
+
+		const uint32 index = static_cast<uint32>(frame.scopes.size());
+
+		frame.scopes.push_back(Scope{ _name, static_cast<uint32>(mOpenScopes.size()) });
+		mOpenScopes.push_back(index);
+
+		vkCmdWriteTimestamp(_commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, frame.pool, 2u * index);
+	}
+
+	void GpuProfiler::EndScope(const CommandBuffer& _commandBuffer)
+	{
+		if (!mbSupported)
+			return;
+
+		SA_ASSERT(!mOpenScopes.empty(), InvalidParam, Rendering, L"GPU profile scope ended without begin!");
+
+		const uint32 index = mOpenScopes.back();
+		mOpenScopes.pop_back();
+
+		if (index != ~uint32())
+			vkCmdWriteTimestamp(_commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, mFrames[mFrameIndex].pool, 2u * index + 1u);
+	}
+}
+
+#endif
@@ -115,7 +115,7 @@ namespace Sa::Vk
 		VkSurfaceKHR vkSurface = _window.CreateRenderSurface(*this);
 
 		// Register.
-		RenderSurface& renderSurface = mSurfaces.emplace_back(new RenderSurface(vkSurface))->As<RenderSurface>();
+		RenderSurface& renderSurface = mSurfaces.emplace_back(mSurfacePool.New(vkSurface))->As<RenderSurface>();
 
 		// TODO: FIX.
 		//// Init resize event.
@@ -149,6 +149,8 @@ namespace Sa::Vk
 
 				vkDestroySurfaceKHR(mHandle, (*it)->As<RenderSurface>(), nullptr);
 
+				mSurfacePool.Delete(&(*it)->As<RenderSurface>());
+
 				mSurfaces.erase(it);
 
 				break;
@@ -5,6 +5,9 @@
 #include <filesystem>
 #include <fstream>
 
+#include <Core/Memory/MemoryTag.hpp>
+#include <Core/Debug/Profiler.hpp>
+
 namespace Sa
 {
 	IAsset::IAsset(AssetType _assetType) noexcept : assetType{ _assetType }
@@ -14,6 +17,10 @@ namespace Sa
 
 	bool IAsset::Load(const std::string& _filePath)
 	{
+		SA_PROFILE_SCOPE("IAsset::Load");
+
+		MemoryTagScope memTag(SA_MEMORY_TAG(SDK_Asset));
+
 		std::fstream fStream(_filePath, std::ios::binary | std::ios_base::in);
 
 		if (!fStream.is_open())
@@ -70,6 +77,8 @@ namespace Sa
 
 	int32 IAsset::TryLoadImport(const std::string& _filePath, const std::string& _resourcePath, const IAssetImportInfos& _importInfos)
 	{
+		MemoryTagScope memTag(SA_MEMORY_TAG(SDK_Asset));
+
 		if (Load(_filePath))
 			return 1;
 
@@ -6,6 +6,7 @@
 #include <fstream>
 
 #include <Core/Algorithms/SizeOf.hpp>
+#include <Core/Debug/Profiler.hpp>
 
 namespace Sa
 {
@@ -129,6 +130,8 @@ namespace Sa
 
 	bool ShaderAsset::Import(const std::string& _resourcePath, const IAssetImportInfos& _importInfos)
 	{
+		SA_PROFILE_SCOPE("ShaderAsset::Import");
+
 		(void)_importInfos;
 
 		std::string tempPath = GenerateTempPath(_resourcePath);
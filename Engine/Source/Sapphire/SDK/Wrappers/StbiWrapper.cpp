@@ -10,6 +10,8 @@
 
 #include <Collections/Debug>
 
+#include <Core/Debug/Profiler.hpp>
+
 #include <Rendering/Framework/Primitives/Texture/Mipmap.hpp>
 #include <Rendering/Framework/Primitives/Texture/RawTexture.hpp>
 #include <Rendering/Framework/Primitives/Texture/RawCubemap.hpp>
@@ -57,6 +59,8 @@ namespace Sa
 
 	bool StbiWrapper::Import(const std::string& _resourcePath, RawTexture& _outTexture, const TextureImportInfos& _importInfos)
 	{
+		SA_PROFILE_SCOPE("StbiWrapper::Import");
+
 		stbi_set_flip_vertically_on_load(true);
 
 		uint32 channelNum = 0u;
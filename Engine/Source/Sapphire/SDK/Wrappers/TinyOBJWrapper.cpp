@@ -2,8 +2,6 @@
 
 #include <SDK/Wrappers/TinyOBJWrapper.hpp>
 
-#include <unordered_map>
-
 // TODO: CLEAN LATER.
 #include <iostream>
 
@@ -12,56 +10,14 @@
 
 #include <Collections/Debug>
 
+#include <Core/Debug/Profiler.hpp>
+
 #include <Core/Algorithms/Move.hpp>
-#include <Core/Algorithms/SizeOf.hpp>
+#include <Core/Containers/FlatHashMap.hpp>
 
 #include <SDK/Assets/Mesh/MeshAsset.hpp>
 
 
-template <class T>
-inline void hash_combine(std::size_t& seed, const T& v)
-{
-	std::hash<T> hasher;
-	seed ^= hasher(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-	//seed ^= hasher(v) + 0x11111111 + (seed << 6) + (seed >> 2);
-}
-namespace std
-{
-	template <>
-	struct hash<Sa::Vec2f>
-	{
-		size_t operator()(const Sa::Vec2f& v) const
-		{
-			size_t h = std::hash<float>()(v.x);
-			hash_combine(h, v.y);
-			return h;
-		}
-	};
-	template <>
-	struct hash<Sa::Vec3f>
-	{
-		size_t operator()(const Sa::Vec3f& v) const
-		{
-			size_t h = std::hash<float>()(v.x);
-			hash_combine(h, v.y);
-			hash_combine(h, v.z);
-			return h;
-		}
-	};
-	template <>
-	struct hash<Sa::Vertex<Sa::VertexComp::Default>>
-	{
-		size_t operator()(const Sa::Vertex<Sa::VertexComp::Default>& v) const
-		{
-			size_t h = std::hash<Sa::Vec3f>()(v.position);
-			hash_combine(h, v.normal);
-			hash_combine(h, v.texture);
-			return h;
-		}
-	};
-}
-
-
 namespace Sa
 {
 	struct TinyOBJWrapper::Callback
@@ -79,7 +35,7 @@ namespace Sa
 		std::vector<Vec2f> vertexText;
 
 		std::shared_ptr<VertexLayout> vertexLayout;
-		std::unordered_map<Vertex<VertexComp::Default>, uint32> vertexIndexMap;
+		FlatHashMap<Vertex<VertexComp::Default>, uint32> vertexIndexMap;
 
 
 		tinyobj::callback_t Tiny()
@@ -122,28 +78,16 @@ namespace Sa
 				vertexText[_indice.texcoord_index - 1]
 			};
 
-			auto find = vertexIndexMap.find(vertex);
+			// Single probe: find or insert with the next index (index start at 0: query before insert).
+			const std::pair<uint32*, bool> res = vertexIndexMap.Emplace(vertex, static_cast<uint32>(vertexIndexMap.Size()));
 
-			// Vertex found.
-			if (find != vertexIndexMap.end())
-			{
-				// Only add vertex index.
+			index = *res.first;
+			rawMesh.indices.push_back(index);
 
-				index = find->second;
-				rawMesh.indices.push_back(find->second);
-			}
-			else
-			{
-				// Insert new vertex and index.
-				index = SizeOf(vertexIndexMap); // index start at 0: query before insert.
-
-				rawMesh.indices.push_back(index);
+			// New vertex.
+			if (res.second)
 				rawMesh.vertices.insert(rawMesh.vertices.end(), reinterpret_cast<const char*>(&vertex), reinterpret_cast<const char*>(&vertex) + sizeof(vertex));
 
-				// Save vertex index.
-				vertexIndexMap.insert({ vertex, index });
-			}
-
 			return index;
 		}
 
@@ -249,7 +193,7 @@ namespace Sa
 			if (cb.importIndex != uint32(-1) && cb.meshIndex != cb.importIndex)
 				return;
 
-			cb.vertexIndexMap.clear();
+			cb.vertexIndexMap.Clear();
 			cb.rawMeshes.emplace_back();
 		}
 
@@ -262,6 +206,8 @@ namespace Sa
 
 	bool TinyOBJWrapper::Import_Internal(Callback& _cb, const std::string& _resourcePath)
 	{
+		SA_PROFILE_SCOPE("TinyOBJWrapper::ImportOBJ");
+
 		std::string warn; std::string error;
 		std::ifstream fstream(_resourcePath.c_str());
 		//tinyobj::MaterialFileReader matFileReader(IAsset::GetAssetDir(_resourcePath));
@@ -361,6 +307,8 @@ namespace Sa
 
 	bool TinyOBJWrapper::ImportMTL(const std::string& _resourcePath, ModelAsset& _result, const RenderMaterialImportInfos& _importInfos)
 	{
+		SA_PROFILE_SCOPE("TinyOBJWrapper::ImportMTL");
+
 		std::map<std::string, int> matMap;
 		std::vector<tinyobj::material_t> materials;
 		std::ifstream stream(_resourcePath);
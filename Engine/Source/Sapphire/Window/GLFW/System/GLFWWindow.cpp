@@ -71,6 +71,7 @@ namespace Sa::GLFW
 		SA_ASSERT(mHandle, Nullptr, Window, L"Window handle nulltpr! Try to destroy a non-created window, call Create() first.");
 
 		//onResizeEvent.Clear();
+		mResizeEvents.Clear();
 
 		glfwDestroyWindow(mHandle);
 
@@ -86,6 +87,14 @@ namespace Sa::GLFW
 		glfwPollEvents();
 	}
 
+	void Window::DispatchEvents()
+	{
+		mResizeEvents.Dispatch([this](const ResizeEvent& _event)
+		{
+			onResizeEvent(*this, _event.width, _event.height);
+		});
+	}
+
 	bool Window::ShouldClose() const
 	{
 		return glfwWindowShouldClose(mHandle);
@@ -114,10 +123,10 @@ namespace Sa::GLFW
 	{
 		SA_ASSERT(_handle, Nullptr, Window, L"Window handle nulltpr!");
 
-		// Resize callback event.
-		IWindow* window = reinterpret_cast<IWindow*>(glfwGetWindowUserPointer(_handle));
+		// Resize callback event: deferred to DispatchEvents().
+		Window* window = reinterpret_cast<Window*>(glfwGetWindowUserPointer(_handle));
 
-		window->onResizeEvent(*window, static_cast<uint32>(_width), static_cast<uint32>(_height));
+		window->mResizeEvents.Push(ResizeEvent{ static_cast<uint32>(_width), static_cast<uint32>(_height) });
 	}
 
 
@@ -0,0 +1,106 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_BENCHES_MEM_COPY_GUARD
+#define SAPPHIRE_BENCHES_MEM_COPY_GUARD
+
+#include "../../../Benchmark.hpp"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+#include <Sapphire/Core/Algorithms/MemCopy.hpp>
+#include <Sapphire/Core/Algorithms/MemFill.hpp>
+
+namespace Sa
+{
+	/// Log bandwidth of a run of _size bytes in _time microseconds.
+	void LogBandwidth(uint64 _size, float _time)
+	{
+		LOG("\t\t\t" << static_cast<double>(_size) / (static_cast<double>(_time) * 1000.0) << " GB/s");
+	}
+
+	/// Human readable size.
+	std::string SizeName(uint64 _size)
+	{
+		if (_size >= (1u << 20))
+			return std::to_string(_size >> 20) + " MB";
+
+		if (_size >= (1u << 10))
+			return std::to_string(_size >> 10) + " KB";
+
+		return std::to_string(_size) + " B";
+	}
+
+	void Bench()
+	{
+		constexpr uint64 maxSize = 256ull << 20;
+
+		// Values not 0: force page commit before first run.
+		std::vector<uint8> src(maxSize, 1u);
+		std::vector<uint8> dest(maxSize, 2u);
+
+		LOG("\n=== MemStream ISA: " << GetMemStreamISA() << " ===");
+
+		for (uint64 size = 64u; size <= maxSize; size *= 4u)
+		{
+			// ~1 GB moved per benchmark.
+			const uint32 iterNum = static_cast<uint32>(std::max<uint64>((1ull << 30) / size, 3u));
+
+			// Offset sources: avoid always aligned copies.
+			const uint8* const srcData = src.data() + 1u;
+			uint8* const destData = dest.data() + 3u;
+			const uint64 num = size - 3u;
+
+			LOG("\n=== " << SizeName(size) << " ===");
+
+			LogBandwidth(size, Benchmark::Run("std::memcpy", iterNum, [&]() {
+				std::memcpy(destData, srcData, num);
+				Benchmark::DoNotOptimize(destData);
+			}));
+
+			LogBandwidth(size, Benchmark::Run("MemCopy", iterNum, [&]() {
+				MemCopy(srcData, destData, num);
+				Benchmark::DoNotOptimize(destData);
+			}));
+
+			LogBandwidth(size, Benchmark::Run("MemCopyUnchecked", iterNum, [&]() {
+				MemCopyUnchecked(srcData, destData, num);
+				Benchmark::DoNotOptimize(destData);
+			}));
+
+			LogBandwidth(size, Benchmark::Run("MemCopyStream", iterNum, [&]() {
+				MemCopyStream(srcData, destData, num);
+				Benchmark::DoNotOptimize(destData);
+			}));
+
+			LogBandwidth(size, Benchmark::Run("std::memset", iterNum, [&]() {
+				std::memset(destData, 7, num);
+				Benchmark::DoNotOptimize(destData);
+			}));
+
+			LogBandwidth(size, Benchmark::Run("MemFillStream (uint8)", iterNum, [&]() {
+				MemFillStream(destData, uint8(7u), num);
+				Benchmark::DoNotOptimize(destData);
+			}));
+
+			uint32* const dest32 = reinterpret_cast<uint32*>(dest.data() + 4u);
+			const uint64 num32 = num / sizeof(uint32);
+
+			LogBandwidth(size, Benchmark::Run("MemFill (uint32)", iterNum, [&]() {
+				MemFill(dest32, 0xdeadbeefu, num32);
+				Benchmark::DoNotOptimize(dest32);
+			}));
+
+			LogBandwidth(size, Benchmark::Run("MemFillStream (uint32)", iterNum, [&]() {
+				MemFillStream(dest32, 0xdeadbeefu, num32);
+				Benchmark::DoNotOptimize(dest32);
+			}));
+		}
+	}
+}
+
+#endif // GUARD
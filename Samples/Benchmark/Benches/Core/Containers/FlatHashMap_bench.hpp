@@ -0,0 +1,146 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_BENCHES_FLAT_HASH_MAP_GUARD
+#define SAPPHIRE_BENCHES_FLAT_HASH_MAP_GUARD
+
+#include "../../../Benchmark.hpp"
+
+#include <vector>
+#include <unordered_map>
+
+#include <Sapphire/Core/Containers/FlatHashMap.hpp>
+
+#include <Sapphire/Rendering/Framework/Primitives/Mesh/Vertex/Vertex.hpp>
+
+namespace Sa
+{
+	using BenchVertex = Vertex<VertexComp::Default>;
+
+	/// Previous OBJ import hash (std::hash<float> + boost-like combine).
+	struct LegacyVertexHash
+	{
+		static void Combine(std::size_t& _seed, float _value)
+		{
+			_seed ^= std::hash<float>()(_value) + 0x9e3779b9 + (_seed << 6) + (_seed >> 2);
+		}
+
+		std::size_t operator()(const BenchVertex& _v) const
+		{
+			std::size_t h = std::hash<float>()(_v.position.x);
+
+			Combine(h, _v.position.y);
+			Combine(h, _v.position.z);
+			Combine(h, _v.normal.x);
+			Combine(h, _v.normal.y);
+			Combine(h, _v.normal.z);
+			Combine(h, _v.texture.x);
+			Combine(h, _v.texture.y);
+
+			return h;
+		}
+	};
+
+	/// Triangle corners of a gridSize x gridSize quad mesh (OBJ-like: 6 corners per quad, 4 unique vertices).
+	std::vector<BenchVertex> MakeGridCorners(uint32 _gridSize)
+	{
+		std::vector<BenchVertex> corners;
+		corners.reserve(6u * _gridSize * _gridSize);
+
+		auto vertex = [](uint32 _x, uint32 _y)
+		{
+			return BenchVertex{ Vec3f(float(_x), 0.0f, float(_y)), Vec3f::Up, Vec3f::Zero, Vec2f(_x * 0.01f, _y * 0.01f) };
+		};
+
+		for (uint32 y = 0u; y < _gridSize; ++y)
+		{
+			for (uint32 x = 0u; x < _gridSize; ++x)
+			{
+				corners.push_back(vertex(x, y));
+				corners.push_back(vertex(x + 1u, y));
+				corners.push_back(vertex(x + 1u, y + 1u));
+
+				corners.push_back(vertex(x, y));
+				corners.push_back(vertex(x + 1u, y + 1u));
+				corners.push_back(vertex(x, y + 1u));
+			}
+		}
+
+		return corners;
+	}
+
+	void Bench()
+	{
+		// ~1M triangles.
+		const std::vector<BenchVertex> corners = MakeGridCorners(708u);
+
+		std::vector<uint32> indices;
+		indices.reserve(corners.size());
+
+		LOG("\n=== OBJ vertex dedup (" << corners.size() / 3u << " triangles) ===");
+
+		SA_BENCH("std::unordered_map (legacy hash)", 5u,
+			std::unordered_map<BenchVertex, uint32, LegacyVertexHash> map;
+			indices.clear();
+
+			for (const BenchVertex& vertex : corners)
+			{
+				auto find = map.find(vertex);
+
+				if (find != map.end())
+					indices.push_back(find->second);
+				else
+				{
+					const uint32 index = static_cast<uint32>(map.size());
+
+					indices.push_back(index);
+					map.insert({ vertex, index });
+				}
+			}
+
+			Benchmark::DoNotOptimize(indices.data());
+		);
+
+		SA_BENCH("FlatHashMap", 5u,
+			FlatHashMap<BenchVertex, uint32> map;
+			indices.clear();
+
+			for (const BenchVertex& vertex : corners)
+				indices.push_back(*map.Emplace(vertex, static_cast<uint32>(map.Size())).first);
+
+			Benchmark::DoNotOptimize(indices.data());
+		);
+
+
+		LOG("\n=== uint64 keys: 1M inserts + 1M lookups ===");
+
+		SA_BENCH("std::unordered_map", 5u,
+			std::unordered_map<uint64, uint64> map;
+			uint64 sum = 0u;
+
+			for (uint64 i = 0u; i < 1000000u; ++i)
+				map[i * 0x9e3779b97f4a7c15ull] = i;
+
+			for (uint64 i = 0u; i < 1000000u; ++i)
+				sum += map.find(i * 0x9e3779b97f4a7c15ull)->second;
+
+			Benchmark::DoNotOptimize(sum);
+		);
+
+		SA_BENCH("FlatHashMap", 5u,
+			FlatHashMap<uint64, uint64> map;
+			uint64 sum = 0u;
+
+			for (uint64 i = 0u; i < 1000000u; ++i)
+				map[i * 0x9e3779b97f4a7c15ull] = i;
+
+			for (uint64 i = 0u; i < 1000000u; ++i)
+				sum += *map.Find(i * 0x9e3779b97f4a7c15ull);
+
+			Benchmark::DoNotOptimize(sum);
+		);
+	}
+}
+
+#endif // GUARD
@@ -0,0 +1,104 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_BENCHES_CLOCK_GUARD
+#define SAPPHIRE_BENCHES_CLOCK_GUARD
+
+#include "../../../Benchmark.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+#include <Sapphire/Core/Time/Time.hpp>
+#include <Sapphire/Core/Time/CpuClock.hpp>
+
+#include <Sapphire/Core/Debug/Profiler.hpp>
+
+namespace Sa
+{
+	/// Log cost of a call from a run average in microseconds.
+	void LogCallCost(float _time)
+	{
+		LOG("\t\t\t" << _time * 1000.0f << " ns/call");
+	}
+
+	/// Smallest non-zero difference between two consecutive reads (in nanoseconds).
+	template <typename F>
+	int64 MeasureResolution(F&& _now)
+	{
+		int64 resolution = INT64_MAX;
+
+		for (uint32 i = 0u; i < 1000u; ++i)
+		{
+			const int64 begin = _now();
+			int64 end = _now();
+
+			while (end == begin)
+				end = _now();
+
+			if (end - begin < resolution)
+				resolution = end - begin;
+		}
+
+		return resolution;
+	}
+
+	void Bench()
+	{
+		constexpr uint32 iterNum = 10000000u;
+
+		LOG("\n=== CpuClock: invariant TSC " << (CpuClock::IsSupported() ? "supported" : "not supported") <<
+			", " << CpuClock::GetFrequency() / 1000000u << " MHz ===");
+
+		LOG("\n=== Per-call cost ===");
+
+		LogCallCost(Benchmark::Run("std::chrono::steady_clock", iterNum, []() {
+			Benchmark::DoNotOptimize(std::chrono::steady_clock::now());
+		}));
+
+		LogCallCost(Benchmark::Run("Time::Ticks", iterNum, []() {
+			Benchmark::DoNotOptimize(Time::Ticks());
+		}));
+
+		LogCallCost(Benchmark::Run("Time::NanoSeconds", iterNum, []() {
+			Benchmark::DoNotOptimize(Time::NanoSeconds());
+		}));
+
+		LogCallCost(Benchmark::Run("CpuClock::Cycles (rdtsc)", iterNum, []() {
+			Benchmark::DoNotOptimize(CpuClock::Cycles());
+		}));
+
+		LogCallCost(Benchmark::Run("CpuClock::CyclesSerialized (rdtscp)", iterNum, []() {
+			Benchmark::DoNotOptimize(CpuClock::CyclesSerialized());
+		}));
+
+		LogCallCost(Benchmark::Run("CpuClock::NanoSeconds", iterNum, []() {
+			Benchmark::DoNotOptimize(CpuClock::NanoSeconds());
+		}));
+
+		LogCallCost(Benchmark::Run("Profiler::GetTime", iterNum, []() {
+			Benchmark::DoNotOptimize(Profiler::GetTime());
+		}));
+
+
+		LOG("\n=== Resolution ===");
+
+		LOG("Time::NanoSeconds:\t" << MeasureResolution([]() { return Time::NanoSeconds(); }) << " ns");
+		LOG("CpuClock::NanoSeconds:\t" << MeasureResolution([]() { return CpuClock::NanoSeconds(); }) << " ns");
+
+
+		LOG("\n=== Drift over 1s (CpuClock - Time::NanoSeconds) ===");
+		{
+			const int64 begin = CpuClock::NanoSeconds() - Time::NanoSeconds();
+
+			Time::Sleep(1000_ms);
+
+			const int64 end = CpuClock::NanoSeconds() - Time::NanoSeconds();
+
+			LOG("Drift:\t\t" << end - begin << " ns");
+		}
+	}
+}
+
+#endif // GUARD
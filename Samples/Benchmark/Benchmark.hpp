@@ -0,0 +1,97 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_BENCHMARK_GUARD
+#define SAPPHIRE_BENCHMARK_GUARD
+
+#include <iostream>
+
+#include <Core/Types/Int.hpp>
+#include <Core/Support/Compilers.hpp>
+
+#include <Core/Time/Chrono.hpp>
+
+#if SA_MSVC
+	#include <intrin.h>
+#endif
+
+#define LOG(_str) std::cout << _str << std::endl;
+
+namespace Sa
+{
+	/**
+	*	\file Benchmark.hpp
+	*
+	*	\brief \b Definition of Sapphire's Benchmarking tool.
+	*
+	*	\ingroup Tools
+	*	\{
+	*/
+
+	/**
+	*	\brief Sapphire's Benchmarking tool class.
+	*/
+	class Benchmark
+	{
+	public:
+		/**
+		*	\brief Prevent the compiler from optimizing out a computed value.
+		*
+		*	\param[in] _value	Value to keep.
+		*/
+		template <typename T>
+		static void DoNotOptimize(const T& _value) noexcept
+		{
+#if SA_MSVC
+			(void)_value;
+			_ReadWriteBarrier();
+#else
+			asm volatile("" : : "r,m"(_value) : "memory");
+#endif
+		}
+
+		/**
+		*	\brief Run a function _iterNum times (after a warm-up run) and log the average time.
+		*
+		*	\param[in] _name		Name of the benchmark.
+		*	\param[in] _iterNum		Number of runs.
+		*	\param[in] _func		Function to benchmark.
+		*
+		*	\return average time of a run in microseconds.
+		*/
+		template <typename F>
+		static float Run(const char* _name, uint32 _iterNum, F&& _func)
+		{
+			// Warm-up: caches and lazy allocations.
+			_func();
+
+			Chrono chrono;
+			chrono.Start();
+
+			for (uint32 i = 0u; i < _iterNum; ++i)
+				_func();
+
+			const float avg = static_cast<float>(chrono.End()) / static_cast<float>(_iterNum);
+
+			LOG("Bench:\t\t" << _name << " -- " << avg << " us");
+
+			return avg;
+		}
+	};
+
+
+	/**	\} */
+}
+
+
+/**
+*	\brief Run a \e Benchmark: average time of _iterNum runs of the code.
+*
+*	\param[in] _name		Name of the benchmark.
+*	\param[in] _iterNum		Number of runs.
+*	\param[in] ...			Code to benchmark.
+*/
+#define SA_BENCH(_name, _iterNum, ...) Sa::Benchmark::Run(_name, _iterNum, [&]() { __VA_ARGS__; })
+
+#endif // GUARD
@@ -0,0 +1,19 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#include "Benchmark.hpp"
+
+#include "Benches/Core/Time/Clock_bench.hpp"
+using namespace Sa;
+
+int main()
+{
+	LOG("=== Start ===");
+
+
+	Bench();
+
+
+	LOG("\n=== End ===");
+
+	return 0;
+}
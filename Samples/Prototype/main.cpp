@@ -1,10 +1,14 @@
 // Copyright 2020 Sapphire development team. All Rights Reserved.
 
 #include <string>
+#include <cstring>
 #include <iostream>
 
 #include <Collections/Thread>
 #include <Core/Time/Chrono.hpp>
+#include <Core/Time/FrameLimiter.hpp>
+#include <Core/Debug/FrameStats.hpp>
+#include <Core/Debug/Profiler.hpp>
 
 #include <Rendering/Vulkan/System/VkRenderInstance.hpp>
 #include <Rendering/Vulkan/System/VkRenderPass.hpp>
@@ -714,12 +718,44 @@ struct SphereRender
 SphereRender sphereRender;
 
 
+#if defined(__SA_TRAVIS) && SA_PROFILING
+
+// Number of frames run on CI: GPU timestamps are read back when a frame slot is reused.
+constexpr uint32 travisFrameNum = 8u;
+
+// Find the subpass zones with non-zero durations on the "GPU" track of the last profiled frame.
+void FindGpuZones(bool& _bGBuffer, bool& _bLitComposition)
+{
+	for (const ProfileNode& node : Profiler::GetLastFrame().nodes)
+	{
+		const char* const thread = Profiler::GetThreadName(node.thread);
+
+		if (!thread || std::strcmp(thread, "GPU") != 0 || node.totalTime == 0u)
+			continue;
+
+		if (std::strcmp(node.name, "GBuffer") == 0)
+			_bGBuffer = true;
+		else if (std::strcmp(node.name, "LitComposition") == 0)
+			_bLitComposition = true;
+	}
+}
+
+#elif defined(__SA_TRAVIS)
+
+constexpr uint32 travisFrameNum = 1u;
+
+#endif
+
+
 int main()
 {
+	int result = 0;
+
 	LOG("=== Start ===\n");
 
 
 	LOG("=== Init ===");
+	JobSystem::Init();
 	IRenderInstance::Init();
 	IWindow::Init();
 
@@ -746,21 +782,16 @@ int main()
 	float speed = 0.1f;
 
 
-	LOG("=== Loop ===");
+	// Frame graph: camera update overlaps with image acquisition and command recording.
+	TaskGraph frameGraph;
 
-#ifndef __SA_TRAVIS
-	while (!window.ShouldClose())
-#endif
+	const uint32 updateNode = frameGraph.AddNode("Update", [&instance]()
 	{
-		float deltaTime = chrono.Restart() * 0.00005f;
-
-
-		window.Update();
-
-		window.TEST(mainRender.camTr, lightPos, deltaTime * speed);
 		mainRender.Update(instance);
+	});
 
-
+	const uint32 recordNode = frameGraph.AddNode("Record", [&instance, &surface]()
+	{
 		// Begin Surface.
 		RenderFrame frame = surface.Begin(instance);
 
@@ -780,11 +811,87 @@ int main()
 		vkCmdDraw(frame.buffer.As<Vk::FrameBuffer>().commandBuffer.Get(), 4u, 1u, 0u, 0u);
 
 
-		mainRender.unlitPipeline.Bind(frame);
-		cubeRender.Draw(frame);
+		{
+			SA_GPU_PROFILE_SCOPE(frame.buffer, "Unlit cube");
+
+			mainRender.unlitPipeline.Bind(frame);
+			cubeRender.Draw(frame);
+		}
+	});
 
+	const uint32 submitNode = frameGraph.AddNode("Submit", [&instance, &surface]()
+	{
 		// End Surface.
 		surface.End(instance);
+	});
+
+	frameGraph.AddEdge(updateNode, submitNode);
+	frameGraph.AddEdge(recordNode, submitNode);
+
+	frameGraph.Compile();
+
+
+	// Cap at 144 FPS unless the presentation already paces frames.
+	FrameLimiter frameLimiter(144.0f, FrameLimitMode::WaitForPresent);
+	frameLimiter.SetPresentPaced(surface.IsPresentPaced());
+
+
+	LOG("=== Loop ===");
+
+#if defined(__SA_TRAVIS) && SA_PROFILING
+	bool bGpuGBuffer = false;
+	bool bGpuLitComposition = false;
+#endif
+
+#ifndef __SA_TRAVIS
+	while (!window.ShouldClose())
+#else
+	for (uint32 frameNum = 0u; frameNum < travisFrameNum; ++frameNum)
+#endif
+	{
+		float deltaTime = chrono.Restart() * 0.00005f;
+
+
+		// GLFW events must be polled on the main thread.
+		window.Update();
+
+		// Sync point: dispatch window events before the frame reads render state.
+		window.DispatchEvents();
+
+		window.TEST(mainRender.camTr, lightPos, deltaTime * speed);
+
+		frameGraph.Run();
+
+#if defined(__SA_TRAVIS) && SA_PROFILING
+		FindGpuZones(bGpuGBuffer, bGpuLitComposition);
+#endif
+
+		frameLimiter.Wait();
+	}
+
+#if defined(__SA_TRAVIS) && SA_PROFILING
+	// GPU profiler check (lavapipe on CI): both subpasses must be timed.
+	if (!bGpuGBuffer || !bGpuLitComposition)
+	{
+		LOG("GPU profiler check failed: GBuffer " << bGpuGBuffer << ", LitComposition " << bGpuLitComposition);
+		result = 1;
+	}
+#endif
+
+
+	// Frame pacing summary.
+	{
+		const char* const statNames[] = { "CPU frame", "Fence wait", "Acquire wait", "GPU latency" };
+
+		for (uint32 i = 0u; i < static_cast<uint32>(FrameStat::Count); ++i)
+		{
+			const FrameStatSummary summary = FrameStats::GetSummary(static_cast<FrameStat>(i));
+
+			LOG(statNames[i] << " (ms):\tmin " << summary.min * 1e-6 << "\tavg " << summary.avg * 1e-6 <<
+				"\tp95 " << summary.p95 * 1e-6 << "\tp99 " << summary.p99 * 1e-6 << "\tmax " << summary.max * 1e-6);
+		}
+
+		LOG("Stutters: " << FrameStats::GetStutterNum() << " / " << FrameStats::GetFrameNum() << " frames");
 	}
 
 	
@@ -808,9 +915,10 @@ int main()
 	LOG("=== UnInit ===");
 	IWindow::UnInit();
 	IRenderInstance::UnInit();
+	JobSystem::UnInit();
 
 
 	LOG("\n=== End ===");
 
-	return 0;
+	return result;
 }
@@ -0,0 +1,104 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_TESTS_FIXED_VECTOR_GUARD
+#define SAPPHIRE_TESTS_FIXED_VECTOR_GUARD
+
+#include <string>
+
+#include "../../../UnitTest.hpp"
+
+#include <Sapphire/Core/Algorithms/Move.hpp>
+#include <Sapphire/Core/Containers/FixedVector.hpp>
+
+namespace Sa
+{
+	/// Element counting its live instances (detect leaks and double destructions).
+	struct Tracked
+	{
+		static int32 liveNum;
+
+		std::string value;
+
+		Tracked(std::string _value = std::string()) : value{ Move(_value) } { ++liveNum; }
+		Tracked(Tracked&& _other) : value{ Move(_other.value) } { ++liveNum; }
+		Tracked(const Tracked& _other) : value{ _other.value } { ++liveNum; }
+		~Tracked() { --liveNum; }
+
+		Tracked& operator=(Tracked&&) = default;
+		Tracked& operator=(const Tracked&) = default;
+	};
+
+	int32 Tracked::liveNum = 0;
+
+	/// Long enough to defeat the small string optimization: moved-from strings are emptied.
+	std::string MakeValue(uint32 _index)
+	{
+		return "FixedVector test value number " + std::to_string(_index);
+	}
+
+	void Test()
+	{
+		LOG("\n=== Elements ===");
+		{
+			FixedVector<Tracked, 4u> vec;
+
+			SA_TEST(vec.IsEmpty(), == , true);
+
+			for (uint32 i = 0u; i < 3u; ++i)
+				vec.EmplaceBack(MakeValue(i));
+
+			// Element of this vector: no relocation in fixed storage.
+			vec.PushBack(vec[0]);
+
+			SA_TEST(vec.IsFull(), == , true);
+			SA_TEST(vec[3].value, == , MakeValue(0u));
+			SA_TEST(Tracked::liveNum, == , 4);
+
+			vec.Erase(1u);
+
+			SA_TEST(vec.Size(), == , 3u);
+			SA_TEST(vec[1].value, == , MakeValue(2u));
+			SA_TEST(vec[2].value, == , MakeValue(0u));
+			SA_TEST(Tracked::liveNum, == , 3);
+
+			vec.PopBack();
+			vec.Resize(4u);
+
+			SA_TEST(vec[3].value, == , std::string());
+			SA_TEST(Tracked::liveNum, == , 4);
+
+			vec.Clear();
+
+			SA_TEST(Tracked::liveNum, == , 0);
+		}
+
+
+		LOG("\n=== Move ===");
+		{
+			FixedVector<Tracked, 4u> vec{ Tracked(MakeValue(0u)), Tracked(MakeValue(1u)) };
+
+			FixedVector<Tracked, 4u> moved = Move(vec);
+
+			SA_TEST(moved.Size(), == , 2u);
+			SA_TEST(moved[1].value, == , MakeValue(1u));
+			SA_TEST(vec.Size(), == , 0u);
+			SA_TEST(Tracked::liveNum, == , 2);
+
+			FixedVector<Tracked, 4u> copy = moved;
+
+			SA_TEST(copy[0].value, == , MakeValue(0u));
+
+			copy = Move(moved);
+
+			SA_TEST(copy.Size(), == , 2u);
+			SA_TEST(moved.Size(), == , 0u);
+			SA_TEST(Tracked::liveNum, == , 2);
+		}
+
+		SA_TEST(Tracked::liveNum, == , 0);
+	}
+}
+
+#endif // GUARD
@@ -0,0 +1,209 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_TESTS_FLAT_HASH_MAP_GUARD
+#define SAPPHIRE_TESTS_FLAT_HASH_MAP_GUARD
+
+#include <string>
+
+#include "../../../UnitTest.hpp"
+
+#include <Sapphire/Core/Algorithms/Move.hpp>
+#include <Sapphire/Core/Containers/FlatHashMap.hpp>
+
+#include <Sapphire/Maths/Space/Vector3.hpp>
+
+namespace Sa
+{
+	/// Every key in the same probe sequence: long chains across groups.
+	struct CollideHash
+	{
+		uint64 operator()(uint32 _key) const noexcept { return _key & 0x3u; }
+	};
+
+	void Test()
+	{
+		LOG("\n=== Insert ===");
+		{
+			FlatHashMap<uint32, uint32> map;
+
+			SA_TEST(map.IsEmpty(), == , true);
+			SA_TEST(map.Find(0u) == nullptr, == , true);
+
+			bool bInserted = true;
+
+			for (uint32 i = 0u; i < 1000u; ++i)
+				bInserted &= map.Insert(i, i * 3u);
+
+			SA_TEST(bInserted, == , true);
+			SA_TEST(map.Size(), == , 1000u);
+
+			// Existing key: not replaced.
+			SA_TEST(map.Insert(10u, 0u), == , false);
+			SA_TEST(*map.Find(10u), == , 30u);
+
+			const std::pair<uint32*, bool> res = map.Emplace(2000u, 7u);
+
+			SA_TEST(res.second, == , true);
+			SA_TEST(*res.first, == , 7u);
+			SA_TEST(map.Emplace(2000u, 8u).second, == , false);
+
+			map[3000u] += 5u;
+
+			SA_TEST(map[3000u], == , 5u);
+			SA_TEST(map.Size(), == , 1002u);
+
+			bool bFound = true;
+
+			for (uint32 i = 0u; i < 1000u; ++i)
+				bFound &= map.Find(i) && *map.Find(i) == i * 3u;
+
+			SA_TEST(bFound, == , true);
+			SA_TEST(map.Contains(1000u), == , false);
+
+			uint64 iterNum = 0u;
+
+			for (auto& pair : map)
+				iterNum += map.Contains(pair.first);
+
+			SA_TEST(iterNum, == , map.Size());
+		}
+
+
+		LOG("\n=== Erase ===");
+		{
+			FlatHashMap<std::string, uint32> map;
+
+			for (uint32 i = 0u; i < 200u; ++i)
+				map.Insert(std::to_string(i), i);
+
+			bool bRemoved = true;
+
+			for (uint32 i = 0u; i < 200u; i += 2u)
+				bRemoved &= map.Remove(std::to_string(i));
+
+			SA_TEST(bRemoved, == , true);
+			SA_TEST(map.Remove("0"), == , false);
+			SA_TEST(map.Size(), == , 100u);
+			SA_TEST(map.Contains("10"), == , false);
+			SA_TEST(*map.Find("11"), == , 11u);
+
+			map.Clear();
+
+			SA_TEST(map.IsEmpty(), == , true);
+			SA_TEST(map.Contains("11"), == , false);
+		}
+
+
+		LOG("\n=== Tombstones ===");
+		{
+			FlatHashMap<uint32, uint32, CollideHash> map;
+
+			// 4 probe sequences of 20 keys: chains span several groups.
+			for (uint32 i = 0u; i < 80u; ++i)
+				map.Insert(i, i);
+
+			const uint64 capacity = map.GetCapacity();
+
+			// Erase the chain heads: lookups must probe past the tombstones.
+			for (uint32 i = 0u; i < 40u; ++i)
+				map.Remove(i);
+
+			bool bFound = true;
+
+			for (uint32 i = 40u; i < 80u; ++i)
+				bFound &= map.Find(i) && *map.Find(i) == i;
+
+			SA_TEST(bFound, == , true);
+			SA_TEST(map.Contains(0u), == , false);
+
+			// Tombstones are reused.
+			for (uint32 i = 0u; i < 40u; ++i)
+				map.Insert(i, i + 1u);
+
+			SA_TEST(map.Size(), == , 80u);
+			SA_TEST(map.GetCapacity(), == , capacity);
+			SA_TEST(*map.Find(0u), == , 1u);
+		}
+
+
+		LOG("\n=== Tombstone cleanup ===");
+		{
+			FlatHashMap<uint32, uint32> map;
+
+			// Insert / remove cycles of a small live set: tombstones must not grow the table.
+			for (uint32 i = 0u; i < 100000u; ++i)
+			{
+				map.Insert(i, i);
+
+				if (i >= 8u)
+					map.Remove(i - 8u);
+			}
+
+			SA_TEST(map.Size(), == , 8u);
+			SA_TEST(map.GetCapacity(), <= , 32u);
+			SA_TEST(*map.Find(99999u), == , 99999u);
+		}
+
+
+		LOG("\n=== Rehash ===");
+		{
+			FlatHashMap<uint32, uint32> map;
+
+			map.Reserve(1000u);
+
+			const uint64 capacity = map.GetCapacity();
+
+			for (uint32 i = 0u; i < 1000u; ++i)
+				map.Insert(i, i);
+
+			// Reserved: no rehash.
+			SA_TEST(map.GetCapacity(), == , capacity);
+
+			// Growth keeps every element.
+			for (uint32 i = 1000u; i < 10000u; ++i)
+				map.Insert(i, i);
+
+			bool bFound = true;
+
+			for (uint32 i = 0u; i < 10000u; ++i)
+				bFound &= map.Find(i) && *map.Find(i) == i;
+
+			SA_TEST(bFound, == , true);
+			SA_TEST(map.GetCapacity(), > , capacity);
+
+			FlatHashMap<uint32, uint32> copy = map;
+
+			SA_TEST(copy.Size(), == , 10000u);
+			SA_TEST(*copy.Find(9999u), == , 9999u);
+
+			FlatHashMap<uint32, uint32> moved = Move(copy);
+
+			SA_TEST(moved.Size(), == , 10000u);
+			SA_TEST(copy.Size(), == , 0u);
+			SA_TEST(*moved.Find(5000u), == , 5000u);
+		}
+
+
+		LOG("\n=== Float keys ===");
+		{
+			FlatHashMap<float, uint32> map;
+
+			// -0.0 == 0.0: same key.
+			map.Insert(0.0f, 1u);
+
+			SA_TEST(map.Insert(-0.0f, 2u), == , false);
+			SA_TEST(*map.Find(-0.0f), == , 1u);
+
+			FlatHashMap<Vec3f, uint32> vecMap;
+
+			vecMap.Insert(Vec3f(0.0f, 1.0f, -0.0f), 1u);
+
+			SA_TEST(vecMap.Contains(Vec3f(-0.0f, 1.0f, 0.0f)), == , true);
+			SA_TEST(vecMap.Contains(Vec3f(1.0f, 0.0f, 0.0f)), == , false);
+		}
+	}
+}
+
+#endif // GUARD
@@ -0,0 +1,101 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_TESTS_SLOT_MAP_GUARD
+#define SAPPHIRE_TESTS_SLOT_MAP_GUARD
+
+#include "../../../UnitTest.hpp"
+
+#include <Sapphire/Core/Containers/SlotMap.hpp>
+
+namespace Sa
+{
+	void Test()
+	{
+		LOG("\n=== Handles ===");
+		{
+			SlotMap<uint32> map;
+
+			const SlotHandle h0 = map.Insert(10u);
+			const SlotHandle h1 = map.Insert(11u);
+			const SlotHandle h2 = map.Insert(12u);
+
+			SA_TEST(map.Size(), == , 3u);
+			SA_TEST(h1.GetIndex(), == , 1u);
+			SA_TEST(h1.GetGeneration(), == , 0u);
+			SA_TEST(SlotHandle().IsSet(), == , false);
+			SA_TEST(map.IsValid(SlotHandle()), == , false);
+
+			SA_TEST(*map.Get(h0), == , 10u);
+			SA_TEST(map[h2], == , 12u);
+		}
+
+
+		LOG("\n=== Stale handle ===");
+		{
+			SlotMap<uint32> map;
+
+			const SlotHandle h0 = map.Insert(10u);
+			const SlotHandle h1 = map.Insert(11u);
+			const SlotHandle h2 = map.Insert(12u);
+
+			SA_TEST(map.Remove(h0), == , true);
+
+			SA_TEST(map.IsValid(h0), == , false);
+			SA_TEST(map.Get(h0) == nullptr, == , true);
+			SA_TEST(map.Remove(h0), == , false);
+			SA_TEST(map.Size(), == , 2u);
+
+			// Last element moved into the hole: other handles still resolve.
+			SA_TEST(map[h1], == , 11u);
+			SA_TEST(map[h2], == , 12u);
+			SA_TEST(map.GetHandle(0u).value, == , h2.value);
+
+			// Free-list reuse: same slot, new generation, old handle still rejected.
+			const SlotHandle h3 = map.Insert(13u);
+
+			SA_TEST(h3.GetIndex(), == , h0.GetIndex());
+			SA_TEST(h3.GetGeneration(), == , h0.GetGeneration() + 1u);
+			SA_TEST(map.IsValid(h0), == , false);
+			SA_TEST(map[h3], == , 13u);
+
+			map.Clear();
+
+			SA_TEST(map.IsEmpty(), == , true);
+			SA_TEST(map.IsValid(h1), == , false);
+			SA_TEST(map.IsValid(h3), == , false);
+		}
+
+
+		LOG("\n=== Generation wrap ===");
+		{
+			SlotMap<uint32> map;
+
+			const SlotHandle first = map.Insert(0u);
+			SlotHandle handle = first;
+
+			// Reuse the single slot until the generation is about to wrap.
+			for (uint32 i = 0u; i < SlotHandle::GenerationMask; ++i)
+			{
+				map.Remove(handle);
+				handle = map.Insert(i + 1u);
+			}
+
+			SA_TEST(handle.GetIndex(), == , first.GetIndex());
+			SA_TEST(handle.GetGeneration(), == , SlotHandle::GenerationMask);
+			SA_TEST(handle.IsSet(), == , true);
+			SA_TEST(map.IsValid(first), == , false);
+
+			map.Remove(handle);
+			handle = map.Insert(42u);
+
+			// Generation wrapped to 0: documented aliasing of the first handle.
+			SA_TEST(handle.GetGeneration(), == , 0u);
+			SA_TEST(handle.value, == , first.value);
+			SA_TEST(map[first], == , 42u);
+		}
+	}
+}
+
+#endif // GUARD
@@ -0,0 +1,239 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_TESTS_SMALL_VECTOR_GUARD
+#define SAPPHIRE_TESTS_SMALL_VECTOR_GUARD
+
+#include <string>
+
+#include "../../../UnitTest.hpp"
+
+#include <Sapphire/Core/Algorithms/Move.hpp>
+#include <Sapphire/Core/Containers/SmallVector.hpp>
+#include <Sapphire/Core/Memory/ArenaAllocator.hpp>
+
+namespace Sa
+{
+	/// Element counting its live instances (detect leaks and double destructions).
+	struct Tracked
+	{
+		static int32 liveNum;
+
+		std::string value;
+
+		Tracked(std::string _value = std::string()) : value{ Move(_value) } { ++liveNum; }
+		Tracked(Tracked&& _other) : value{ Move(_other.value) } { ++liveNum; }
+		Tracked(const Tracked& _other) : value{ _other.value } { ++liveNum; }
+		~Tracked() { --liveNum; }
+
+		Tracked& operator=(Tracked&&) = default;
+		Tracked& operator=(const Tracked&) = default;
+	};
+
+	int32 Tracked::liveNum = 0;
+
+	/// Long enough to defeat the small string optimization: moved-from strings are emptied.
+	std::string MakeValue(uint32 _index)
+	{
+		return "SmallVector test value number " + std::to_string(_index);
+	}
+
+	void Test()
+	{
+		LOG("\n=== Spill ===");
+		{
+			SmallVector<Tracked, 4u> vec;
+
+			SA_TEST(vec.IsInline(), == , true);
+			SA_TEST(vec.GetCapacity(), == , 4u);
+
+			for (uint32 i = 0u; i < 4u; ++i)
+				vec.EmplaceBack(MakeValue(i));
+
+			SA_TEST(vec.IsInline(), == , true);
+
+			// Inline -> heap: elements are moved.
+			vec.EmplaceBack(MakeValue(4u));
+
+			SA_TEST(vec.IsInline(), == , false);
+			SA_TEST(vec.GetCapacity(), == , 8u);
+			SA_TEST(vec.Size(), == , 5u);
+
+			bool bValues = true;
+
+			for (uint32 i = 0u; i < vec.Size(); ++i)
+				bValues &= vec[i].value == MakeValue(i);
+
+			SA_TEST(bValues, == , true);
+			SA_TEST(Tracked::liveNum, == , 5);
+
+			vec.Resize(2u);
+
+			SA_TEST(Tracked::liveNum, == , 2);
+			SA_TEST(vec.Back().value, == , MakeValue(1u));
+
+			vec.Clear();
+
+			SA_TEST(Tracked::liveNum, == , 0);
+		}
+
+
+		LOG("\n=== Move ===");
+		{
+			// From inline storage: elements are moved one by one.
+			SmallVector<Tracked, 4u> inlineVec{ Tracked(MakeValue(0u)), Tracked(MakeValue(1u)) };
+
+			SmallVector<Tracked, 4u> fromInline = Move(inlineVec);
+
+			SA_TEST(fromInline.IsInline(), == , true);
+			SA_TEST(fromInline.Size(), == , 2u);
+			SA_TEST(fromInline[1].value, == , MakeValue(1u));
+			SA_TEST(inlineVec.Size(), == , 0u);
+			SA_TEST(Tracked::liveNum, == , 2);
+
+			// From heap storage: the buffer is stolen.
+			SmallVector<Tracked, 4u> heapVec;
+
+			for (uint32 i = 0u; i < 6u; ++i)
+				heapVec.EmplaceBack(MakeValue(i));
+
+			const Tracked* const heapData = heapVec.Data();
+
+			SmallVector<Tracked, 4u> fromHeap = Move(heapVec);
+
+			SA_TEST(fromHeap.Data() == heapData, == , true);
+			SA_TEST(fromHeap.Size(), == , 6u);
+			SA_TEST(heapVec.IsInline(), == , true);
+			SA_TEST(heapVec.Size(), == , 0u);
+
+			// Move operator= in both directions.
+			fromInline = Move(fromHeap);
+
+			SA_TEST(fromInline.Data() == heapData, == , true);
+			SA_TEST(fromInline[5].value, == , MakeValue(5u));
+
+			heapVec.EmplaceBack(MakeValue(7u));
+			fromInline = Move(heapVec);
+
+			SA_TEST(fromInline.IsInline(), == , true);
+			SA_TEST(fromInline.Size(), == , 1u);
+			SA_TEST(fromInline[0].value, == , MakeValue(7u));
+
+			// Copy.
+			SmallVector<Tracked, 4u> copy = fromInline;
+
+			SA_TEST(copy[0].value, == , MakeValue(7u));
+			SA_TEST(Tracked::liveNum, == , 2);
+
+			// Reused moved-from vector.
+			heapVec.EmplaceBack(MakeValue(8u));
+
+			SA_TEST(heapVec[0].value, == , MakeValue(8u));
+		}
+
+		SA_TEST(Tracked::liveNum, == , 0);
+
+
+		LOG("\n=== Aliasing ===");
+		{
+			SmallVector<Tracked, 2u> vec;
+
+			vec.EmplaceBack(MakeValue(0u));
+			vec.EmplaceBack(MakeValue(1u));
+
+			// Full: the referenced element is relocated by the spill.
+			vec.EmplaceBack(vec[0]);
+			vec.PushBack(vec[1]);
+
+			SA_TEST(vec.Size(), == , 4u);
+			SA_TEST(vec[2].value, == , MakeValue(0u));
+			SA_TEST(vec[3].value, == , MakeValue(1u));
+
+			// Append its own elements while growing.
+			vec.Append(vec.Data(), vec.Size());
+
+			SA_TEST(vec.Size(), == , 8u);
+			SA_TEST(vec[6].value, == , MakeValue(0u));
+			SA_TEST(vec[7].value, == , MakeValue(1u));
+		}
+
+		SA_TEST(Tracked::liveNum, == , 0);
+
+
+		LOG("\n=== Erase ===");
+		{
+			SmallVector<Tracked, 4u> vec;
+
+			for (uint32 i = 0u; i < 6u; ++i)
+				vec.EmplaceBack(MakeValue(i));
+
+			vec.Erase(0u);
+			vec.Erase(2u);
+			vec.Erase(vec.Size() - 1u);
+
+			SA_TEST(vec.Size(), == , 3u);
+			SA_TEST(vec[0].value, == , MakeValue(1u));
+			SA_TEST(vec[1].value, == , MakeValue(2u));
+			SA_TEST(vec[2].value, == , MakeValue(4u));
+			SA_TEST(Tracked::liveNum, == , 3);
+
+			vec.PopBack();
+
+			SA_TEST(Tracked::liveNum, == , 2);
+		}
+
+		SA_TEST(Tracked::liveNum, == , 0);
+
+
+		LOG("\n=== Arena allocators ===");
+		{
+			LinearArena arena(4096u);
+
+			{
+				ScratchSmallVector<uint32, 4u> vec{ ArenaAllocator<uint32, LinearArena>(arena) };
+
+				for (uint32 i = 0u; i < 4u; ++i)
+					vec.PushBack(i);
+
+				// Inline: no arena allocation.
+				SA_TEST(arena.GetUsedSize(), == , 0u);
+
+				vec.PushBack(4u);
+
+				SA_TEST(arena.GetUsedSize(), >= , 8u * sizeof(uint32));
+				SA_TEST(vec[4], == , 4u);
+
+				// Heap move: arena storage is stolen.
+				const uint64 usedSize = arena.GetUsedSize();
+				const uint32* const data = vec.Data();
+
+				ScratchSmallVector<uint32, 4u> moved = Move(vec);
+
+				SA_TEST(moved.Data() == data, == , true);
+				SA_TEST(arena.GetUsedSize(), == , usedSize);
+
+				// Grow from the same arena.
+				for (uint32 i = 5u; i < 16u; ++i)
+					moved.PushBack(i);
+
+				SA_TEST(arena.GetUsedSize(), > , usedSize);
+				SA_TEST(moved[15], == , 15u);
+			}
+
+			FrameArena frameArena(4096u);
+
+			{
+				FrameSmallVector<uint32, 2u> vec{ ArenaAllocator<uint32, FrameArena>(frameArena) };
+
+				for (uint32 i = 0u; i < 16u; ++i)
+					vec.PushBack(i);
+
+				SA_TEST(frameArena.GetUsedSize(), > , 0u);
+				SA_TEST(vec[15], == , 15u);
+			}
+		}
+	}
+}
+
+#endif // GUARD
@@ -0,0 +1,123 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_TESTS_POOL_ALLOCATOR_GUARD
+#define SAPPHIRE_TESTS_POOL_ALLOCATOR_GUARD
+
+#include "../../../UnitTest.hpp"
+
+#include <Sapphire/Core/Memory/PoolAllocator.hpp>
+
+namespace Sa
+{
+	/// Element counting its live instances (detect missing destructions).
+	struct PoolElem
+	{
+		static int32 liveNum;
+
+		uint64 value = 0u;
+
+		PoolElem(uint64 _value) : value{ _value } { ++liveNum; }
+		~PoolElem() { --liveNum; }
+	};
+
+	int32 PoolElem::liveNum = 0;
+
+	void Test()
+	{
+		LOG("\n=== New / Delete ===");
+		{
+			PoolAllocator<PoolElem, 4u> pool;
+
+			PoolElem* const e0 = pool.New(1u);
+
+			SA_TEST(e0->value, == , 1u);
+			SA_TEST(pool.GetSize(), == , 1u);
+			SA_TEST(pool.GetCapacity(), == , 4u);
+			SA_TEST(PoolElem::liveNum, == , 1);
+
+			pool.Delete(e0);
+
+			SA_TEST(pool.GetSize(), == , 0u);
+			SA_TEST(PoolElem::liveNum, == , 0);
+
+			// Freed block is reused first, no new chunk.
+			PoolElem* const e1 = pool.New(2u);
+
+			SA_TEST(e1 == e0, == , true);
+			SA_TEST(e1->value, == , 2u);
+			SA_TEST(pool.GetCapacity(), == , 4u);
+
+			pool.Delete(e1);
+
+			// Null is ignored.
+			pool.Delete(nullptr);
+
+			SA_TEST(pool.GetSize(), == , 0u);
+		}
+
+
+		LOG("\n=== Chunks ===");
+		{
+			PoolAllocator<PoolElem, 4u> pool;
+
+			PoolElem* elems[6] = {};
+
+			for (uint32 i = 0u; i < 6u; ++i)
+				elems[i] = pool.New(i);
+
+			SA_TEST(pool.GetSize(), == , 6u);
+			SA_TEST(pool.GetCapacity(), == , 8u);
+
+			// Allocations follow the memory order in a chunk.
+			SA_TEST(elems[1] == elems[0] + 1, == , true);
+
+			bool bDistinct = true;
+
+			for (uint32 i = 0u; i < 6u; ++i)
+			{
+				for (uint32 j = i + 1u; j < 6u; ++j)
+					bDistinct &= elems[i] != elems[j];
+			}
+
+			SA_TEST(bDistinct, == , true);
+
+			// LIFO free-list: last freed block is allocated first.
+			pool.Delete(elems[2]);
+			pool.Delete(elems[4]);
+
+			SA_TEST(pool.New(10u) == elems[4], == , true);
+			SA_TEST(pool.New(11u) == elems[2], == , true);
+			SA_TEST(pool.GetCapacity(), == , 8u);
+
+			for (uint32 i = 0u; i < 6u; ++i)
+				pool.Delete(elems[i]);
+
+			SA_TEST(pool.GetSize(), == , 0u);
+			SA_TEST(PoolElem::liveNum, == , 0);
+		}
+
+
+		LOG("\n=== Reserve ===");
+		{
+			PoolAllocator<PoolElem, 4u> pool;
+
+			pool.Reserve(9u);
+
+			SA_TEST(pool.GetCapacity(), == , 12u);
+			SA_TEST(pool.GetSize(), == , 0u);
+
+			PoolElem* const elem = pool.Allocate();
+
+			SA_TEST(pool.GetSize(), == , 1u);
+			SA_TEST(pool.GetCapacity(), == , 12u);
+
+			pool.Deallocate(elem);
+
+			SA_TEST(pool.GetSize(), == , 0u);
+		}
+	}
+}
+
+#endif // GUARD
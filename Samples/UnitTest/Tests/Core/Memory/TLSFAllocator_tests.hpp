@@ -0,0 +1,230 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_TESTS_TLSF_ALLOCATOR_GUARD
+#define SAPPHIRE_TESTS_TLSF_ALLOCATOR_GUARD
+
+#include <vector>
+
+#include "../../../UnitTest.hpp"
+
+#include <Sapphire/Core/Memory/Heap.hpp>
+#include <Sapphire/Core/Memory/TLSFAllocator.hpp>
+
+namespace Sa
+{
+	/// Small pools to reach exhaustion quickly.
+	constexpr uint64 testPoolSize = 64u * 1024u;
+
+	void Test()
+	{
+		LOG("\n=== Split ===");
+		{
+			TLSFAllocator allocator(testPoolSize);
+
+			SA_TEST(allocator.GetReservedSize(), == , 0u);
+
+			void* const a = allocator.Allocate(100u);
+			void* const b = allocator.Allocate(200u);
+
+			SA_TEST(allocator.GetReservedSize(), == , testPoolSize);
+			SA_TEST(TLSFAllocator::GetAllocationSize(a), == , 112u);
+			SA_TEST(TLSFAllocator::GetAllocationSize(b), == , 208u);
+			SA_TEST(allocator.GetUsedSize(), == , 320u);
+
+			// b is split from the remainder of a: right after a and its header.
+			SA_TEST(static_cast<uint8*>(b) - static_cast<uint8*>(a), == , 112 + 16);
+
+			// Requests below MinBlockSize still hold the free-list links.
+			void* const c = allocator.Allocate(1u);
+
+			SA_TEST(TLSFAllocator::GetAllocationSize(c), == , TLSFAllocator::MinBlockSize);
+			SA_TEST(allocator.Validate(), == , true);
+
+			allocator.Free(a);
+			allocator.Free(b);
+			allocator.Free(c);
+
+			SA_TEST(allocator.GetUsedSize(), == , 0u);
+			SA_TEST(allocator.Validate(), == , true);
+		}
+
+
+		LOG("\n=== Merge ===");
+		{
+			TLSFAllocator allocator(testPoolSize);
+
+			// Merged size (1008 + 16 + 1024 + 16 + 1008) on a size class boundary: found without round-up.
+			void* const a = allocator.Allocate(1008u);
+			void* const b = allocator.Allocate(1024u);
+			void* const c = allocator.Allocate(1008u);
+			void* const guard = allocator.Allocate(1024u);
+
+			// b merges with both free neighbours.
+			allocator.Free(a);
+			allocator.Free(c);
+			allocator.Free(b);
+
+			SA_TEST(allocator.Validate(), == , true);
+
+			// One block of a + b + c (and 2 absorbed headers).
+			void* const abc = allocator.Allocate(3072u);
+
+			SA_TEST(abc, == , a);
+			SA_TEST(TLSFAllocator::GetAllocationSize(abc), == , 3072u);
+
+			allocator.Free(abc);
+			allocator.Free(guard);
+
+			// Scrambled free order: everything merges back into the initial block.
+			std::vector<void*> ptrs;
+
+			for (uint32 i = 0u; i < 64u; ++i)
+				ptrs.push_back(allocator.Allocate(64u + (i % 7u) * 48u));
+
+			for (uint32 i = 0u; i < 64u; ++i)
+				allocator.Free(ptrs[(i * 37u) % 64u]);
+
+			SA_TEST(allocator.Validate(), == , true);
+			SA_TEST(allocator.GetUsedSize(), == , 0u);
+
+			void* const big = allocator.Allocate(60000u);
+
+			SA_TEST(big, != , nullptr);
+			SA_TEST(allocator.GetReservedSize(), == , testPoolSize);
+
+			allocator.Free(big);
+		}
+
+
+		LOG("\n=== Alignment ===");
+		{
+			TLSFAllocator allocator(testPoolSize);
+
+			std::vector<void*> ptrs;
+			bool bAligned = true;
+
+			for (uint64 alignment = 16u; alignment <= 4096u; alignment <<= 1u)
+			{
+				for (uint64 size : { 1u, 40u, 100u, 1000u })
+				{
+					void* const ptr = allocator.Allocate(size, alignment);
+
+					bAligned &= reinterpret_cast<uint64>(ptr) % alignment == 0u;
+					bAligned &= TLSFAllocator::GetAllocationSize(ptr) >= size;
+
+					ptrs.push_back(ptr);
+				}
+			}
+
+			SA_TEST(bAligned, == , true);
+
+			// Front gaps were given back as free blocks.
+			SA_TEST(allocator.Validate(), == , true);
+
+			for (void* ptr : ptrs)
+				allocator.Free(ptr);
+
+			SA_TEST(allocator.GetUsedSize(), == , 0u);
+			SA_TEST(allocator.Validate(), == , true);
+		}
+
+
+		LOG("\n=== Exhaustion ===");
+		{
+			TLSFAllocator allocator(testPoolSize);
+
+			std::vector<void*> ptrs;
+
+			// Fill the first pool.
+			while (allocator.GetReservedSize() <= testPoolSize)
+				ptrs.push_back(allocator.Allocate(1024u));
+
+			SA_TEST(ptrs.back(), != , nullptr);
+			SA_TEST(allocator.GetReservedSize(), == , 2u * testPoolSize);
+			SA_TEST(allocator.Validate(), == , true);
+
+			// Bigger than a pool: dedicated pool.
+			void* const big = allocator.Allocate(4u * testPoolSize);
+
+			SA_TEST(big, != , nullptr);
+			SA_TEST(TLSFAllocator::GetAllocationSize(big), >= , 4u * testPoolSize);
+			SA_TEST(allocator.GetReservedSize(), > , 6u * testPoolSize);
+
+			ptrs.push_back(big);
+
+			for (void* ptr : ptrs)
+				allocator.Free(ptr);
+
+			SA_TEST(allocator.GetUsedSize(), == , 0u);
+			SA_TEST(allocator.Validate(), == , true);
+		}
+
+
+		LOG("\n=== Free-list reuse ===");
+		{
+			TLSFAllocator allocator(testPoolSize);
+
+			void* const a = allocator.Allocate(256u);
+			void* const guard = allocator.Allocate(256u);
+
+			allocator.Free(a);
+
+			// Same size class, remainder too small to split: a is reused as is.
+			void* const b = allocator.Allocate(240u);
+
+			SA_TEST(b, == , a);
+			SA_TEST(TLSFAllocator::GetAllocationSize(b), == , 256u);
+
+			allocator.Free(b);
+
+			void* const c = allocator.Allocate(256u);
+
+			SA_TEST(c, == , a);
+
+			allocator.Free(c);
+			allocator.Free(guard);
+
+			SA_TEST(allocator.Validate(), == , true);
+		}
+
+
+		LOG("\n=== Tags ===");
+		{
+			TLSFAllocator allocator(testPoolSize);
+
+			const MemoryTag tag = MemoryTags::Register(L"TLSF_Tests");
+			const MemoryTagStats& stats = MemoryTags::GetStats(tag);
+
+			const uint64 liveSize = stats.liveSize.Get();
+
+			void* const ptr = allocator.Allocate(500u, TLSFAllocator::Alignment, tag);
+
+			SA_TEST(static_cast<uint32>(TLSFAllocator::GetAllocationTag(ptr)), == , static_cast<uint32>(tag));
+			SA_TEST(stats.liveSize.Get() - liveSize, == , TLSFAllocator::GetAllocationSize(ptr));
+
+			allocator.Free(ptr);
+
+			SA_TEST(stats.liveSize.Get(), == , liveSize);
+
+			// Global heap: current tag by default.
+			void* heapPtr = nullptr;
+
+			{
+				MemoryTagScope scope(tag);
+
+				heapPtr = Heap::Allocate(64u);
+			}
+
+			SA_TEST(static_cast<uint32>(TLSFAllocator::GetAllocationTag(heapPtr)), == , static_cast<uint32>(tag));
+			SA_TEST(Heap::GetUsedSize(), >= , 64u);
+
+			Heap::Free(heapPtr);
+
+			SA_TEST(stats.liveSize.Get(), == , liveSize);
+		}
+	}
+}
+
+#endif // GUARD
@@ -0,0 +1,165 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_TESTS_MPMC_QUEUE_GUARD
+#define SAPPHIRE_TESTS_MPMC_QUEUE_GUARD
+
+#include <vector>
+
+#include "../../../UnitTest.hpp"
+
+#include <Sapphire/Core/Time/Chrono.hpp>
+#include <Sapphire/Core/Thread/Atomic.hpp>
+#include <Sapphire/Core/Thread/Thread.hpp>
+#include <Sapphire/Core/Thread/MPMCQueue.hpp>
+
+namespace Sa
+{
+	constexpr uint32 producerNum = 4u;
+	constexpr uint32 consumerNum = 4u;
+
+	/**
+	*	\brief Run producerNum producers and consumerNum consumers pushing / popping _elemNum values each.
+	*
+	*	\return elapsed time.
+	*/
+	template <typename Queue>
+	Tick RunProducersConsumers(Queue& _queue, uint64 _elemNum, uint32 _batchSize, uint64& _sum)
+	{
+		Atomic<uint64> sum = 0u;
+		Atomic<uint64> popNum = 0u;
+
+		std::vector<Thread> threads;
+
+		Chrono chrono;
+		chrono.Start();
+
+		for (uint32 p = 0u; p < producerNum; ++p)
+		{
+			threads.emplace_back([&_queue, _elemNum, _batchSize, p]()
+			{
+				uint64 values[64];
+
+				for (uint64 i = 0u; i < _elemNum;)
+				{
+					uint32 num = 0u;
+
+					for (; num < _batchSize && i + num < _elemNum; ++num)
+						values[num] = p * _elemNum + i + num;
+
+					const uint32 pushed = _batchSize == 1u ? (_queue.Push(values[0]) ? 1u : 0u) : _queue.PushBatch(values, num);
+
+					if (pushed)
+						i += pushed;
+					else
+						Thread::Yield();
+				}
+			});
+		}
+
+		for (uint32 c = 0u; c < consumerNum; ++c)
+		{
+			threads.emplace_back([&_queue, &sum, &popNum, _elemNum, _batchSize]()
+			{
+				uint64 values[64];
+				uint64 localSum = 0u;
+
+				while (popNum.Get() < producerNum * _elemNum)
+				{
+					const uint32 popped = _batchSize == 1u ? (_queue.Pop(values[0]) ? 1u : 0u) : _queue.PopBatch(values, _batchSize);
+
+					if (!popped)
+					{
+						Thread::Yield();
+						continue;
+					}
+
+					for (uint32 i = 0u; i < popped; ++i)
+						localSum += values[i];
+
+					popNum += popped;
+				}
+
+				sum += localSum;
+			});
+		}
+
+		for (Thread& thread : threads)
+			thread.Join();
+
+		const Tick time = chrono.End();
+
+		_sum = sum.Get();
+
+		return time;
+	}
+
+	void Test()
+	{
+		LOG("\n=== Single thread ===");
+		{
+			MPMCQueue<uint32, 8u> queue;
+
+			SA_TEST(queue.IsEmpty(), == , true);
+
+			for (uint32 i = 0u; i < 8u; ++i)
+				queue.Push(i);
+
+			SA_TEST(queue.Size(), == , 8u);
+			SA_TEST(queue.Push(8u), == , false);
+
+			uint32 value = 0u;
+
+			SA_TEST(queue.Pop(value), == , true);
+			SA_TEST(value, == , 0u);
+
+			const uint32 batch[4]{ 8u, 9u, 10u, 11u };
+
+			SA_TEST(queue.PushBatch(batch, 4u), == , 1u);
+
+			uint32 popped[16]{};
+
+			SA_TEST(queue.PopBatch(popped, 16u), == , 8u);
+			SA_TEST(popped[0], == , 1u);
+			SA_TEST(popped[7], == , 8u);
+			SA_TEST(queue.Pop(value), == , false);
+		}
+
+
+		LOG("\n=== Stress ===");
+		{
+			constexpr uint64 elemNum = 250000u;
+			constexpr uint64 total = producerNum * elemNum;
+
+			MPMCQueue<uint64, 1024u> queue;
+			uint64 sum = 0u;
+
+			RunProducersConsumers(queue, elemNum, 1u, sum);
+			SA_TEST(sum, == , total * (total - 1u) / 2u);
+
+			RunProducersConsumers(queue, elemNum, 16u, sum);
+			SA_TEST(sum, == , total * (total - 1u) / 2u);
+
+			SA_TEST(queue.IsEmpty(), == , true);
+		}
+
+
+		LOG("\n=== Benchmark ===");
+		{
+			constexpr uint64 elemNum = 2500000u;
+			constexpr uint64 total = producerNum * elemNum;
+
+			MPMCQueue<uint64, 4096u> queue;
+			uint64 sum = 0u;
+
+			const float time = RunProducersConsumers(queue, elemNum, 1u, sum);
+			LOG("Single:\t" << total / (time / 1000000.0f) / 1000000.0f << " Mops/s");
+
+			const float batchTime = RunProducersConsumers(queue, elemNum, 64u, sum);
+			LOG("Batch:\t" << total / (batchTime / 1000000.0f) / 1000000.0f << " Mops/s");
+		}
+	}
+}
+
+#endif // GUARD
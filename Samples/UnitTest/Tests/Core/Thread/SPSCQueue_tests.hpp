@@ -0,0 +1,190 @@
+// Copyright 2020 Sapphire development team. All Rights Reserved.
+
+#pragma once
+
+#ifndef SAPPHIRE_TESTS_SPSC_QUEUE_GUARD
+#define SAPPHIRE_TESTS_SPSC_QUEUE_GUARD
+
+#include "../../../UnitTest.hpp"
+
+#include <Sapphire/Core/Time/Chrono.hpp>
+#include <Sapphire/Core/Thread/Thread.hpp>
+#include <Sapphire/Core/Thread/SPSCQueue.hpp>
+
+namespace Sa
+{
+	void Test()
+	{
+		LOG("\n=== Single thread ===");
+		{
+			SPSCQueue<uint32, 8u> queue;
+
+			SA_TEST(queue.IsEmpty(), == , true);
+
+			for (uint32 i = 0u; i < 8u; ++i)
+				queue.Push(i);
+
+			SA_TEST(queue.Size(), == , 8u);
+			SA_TEST(queue.Push(8u), == , false);
+
+			uint32 value = 0u;
+
+			SA_TEST(queue.Pop(value), == , true);
+			SA_TEST(value, == , 0u);
+
+			const uint32 batch[4]{ 8u, 9u, 10u, 11u };
+
+			SA_TEST(queue.PushBatch(batch, 4u), == , 1u);
+
+			uint32 popped[16]{};
+
+			SA_TEST(queue.PopBatch(popped, 16u), == , 8u);
+			SA_TEST(popped[0], == , 1u);
+			SA_TEST(popped[7], == , 8u);
+			SA_TEST(queue.Pop(value), == , false);
+		}
+
+
+		LOG("\n=== Stress ===");
+		{
+			constexpr uint64 elemNum = 1000000u;
+
+			SPSCQueue<uint64, 1024u> queue;
+
+			bool bOrdered = true;
+			uint64 sum = 0u;
+
+			Thread consumer([&queue, &bOrdered, &sum]()
+			{
+				uint64 expected = 0u;
+				uint64 popped[64];
+
+				while (expected < elemNum)
+				{
+					// Alternate single and batch pop.
+					if (expected & 1u)
+					{
+						const uint32 num = queue.PopBatch(popped, 64u);
+
+						for (uint32 i = 0u; i < num; ++i)
+						{
+							bOrdered &= popped[i] == expected++;
+							sum += popped[i];
+						}
+					}
+					else if (queue.Pop(popped[0]))
+					{
+						bOrdered &= popped[0] == expected++;
+						sum += popped[0];
+					}
+					else
+						Thread::Yield();
+				}
+			});
+
+			uint64 pushed = 0u;
+			uint64 batch[32];
+
+			while (pushed < elemNum)
+			{
+				if (pushed & 1u)
+				{
+					uint32 num = 0u;
+
+					for (; num < 32u && pushed + num < elemNum; ++num)
+						batch[num] = pushed + num;
+
+					pushed += queue.PushBatch(batch, num);
+				}
+				else if (queue.Push(pushed))
+					++pushed;
+				else
+					Thread::Yield();
+			}
+
+			consumer.Join();
+
+			SA_TEST(bOrdered, == , true);
+			SA_TEST(sum, == , elemNum * (elemNum - 1u) / 2u);
+			SA_TEST(queue.IsEmpty(), == , true);
+		}
+
+
+		LOG("\n=== Benchmark ===");
+		{
+			constexpr uint64 elemNum = 10000000u;
+
+			SPSCQueue<uint64, 4096u> queue;
+
+			Chrono chrono;
+			chrono.Start();
+
+			Thread consumer([&queue]()
+			{
+				uint64 value = 0u;
+
+				for (uint64 i = 0u; i < elemNum;)
+				{
+					if (queue.Pop(value))
+						++i;
+					else
+						Thread::Yield();
+				}
+			});
+
+			for (uint64 i = 0u; i < elemNum;)
+			{
+				if (queue.Push(i))
+					++i;
+				else
+					Thread::Yield();
+			}
+
+			consumer.Join();
+
+			const float time = chrono.End();
+
+			LOG("Single:\t" << elemNum / (time / 1000000.0f) / 1000000.0f << " Mops/s");
+
+
+			constexpr uint32 batchSize = 64u;
+
+			chrono.Start();
+
+			Thread batchConsumer([&queue]()
+			{
+				uint64 values[batchSize];
+
+				for (uint64 i = 0u; i < elemNum;)
+				{
+					const uint32 num = queue.PopBatch(values, batchSize);
+
+					if (num)
+						i += num;
+					else
+						Thread::Yield();
+				}
+			});
+
+			uint64 values[batchSize]{};
+
+			for (uint64 i = 0u; i < elemNum;)
+			{
+				const uint32 num = queue.PushBatch(values, elemNum - i < batchSize ? static_cast<uint32>(elemNum - i) : batchSize);
+
+				if (num)
+					i += num;
+				else
+					Thread::Yield();
+			}
+
+			batchConsumer.Join();
+
+			const float batchTime = chrono.End();
+
+			LOG("Batch:\t" << elemNum / (batchTime / 1000000.0f) / 1000000.0f << " Mops/s");
+		}
+	}
+}
+
+#endif // GUARD